@@ -0,0 +1,798 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <string>
+#include <sys/resource.h>
+#include <thread>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+#include "arena.hpp"
+#include "dump.hpp"
+#include "error.hpp"
+#include "parser.hpp"
+#include "prefix_file.hpp"
+#include "preprocess.hpp"
+#include "scan.hpp"
+#include "thread_pool.hpp"
+#include "tokenize.hpp"
+
+
+static unsigned long malloc_calls;
+
+#ifdef __GLIBC__
+extern "C" void *__libc_malloc(size_t size);
+
+// Count all heap allocations (operator new ends up here as well)
+extern "C" void *malloc(size_t size)
+{
+    malloc_calls++;
+    return __libc_malloc(size);
+}
+#endif
+
+
+struct bench_input
+{
+    std::string name;
+    std::string source;
+};
+
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+
+static long peak_rss_kb(void)
+{
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    return ru.ru_maxrss;
+}
+
+
+/**
+ * Generates a translation unit consisting of the given number of classes,
+ * typedefs and functions.
+ */
+static std::string synthetic_source(int units)
+{
+    std::string src =
+        "extern int printf(const char *format, ...);\n"
+        "template<typename T> class box\n"
+        "{\n"
+        "    public:\n"
+        "        T value;\n"
+        "};\n";
+
+    for (int i = 0; i < units; i++)
+    {
+        char buf[1024];
+        snprintf(buf, sizeof(buf),
+            "class c%i\n"
+            "{\n"
+            "    public:\n"
+            "        int a%i;\n"
+            "        int get(int x) { return a%i * x + (x << 2) - 3; }\n"
+            "};\n"
+            "typedef c%i t%i;\n"
+            "int f%i(int a, int b)\n"
+            "{\n"
+            "    t%i k;\n"
+            "    box<int> bx;\n"
+            "    int y = a * b + (a - b) / 3 + k.get(a);\n"
+            "    if (y > 2) y = y %% 7; else y = -y;\n"
+            "    for (int j = 0; j < b; j++) y += j;\n"
+            "    return y;\n"
+            "}\n",
+            i, i, i, i, i, i, i);
+
+        src += buf;
+    }
+
+    return src;
+}
+
+
+/**
+ * Generates a translation unit declaring the given number of typedef names,
+ * each of which is used right away.
+ */
+static std::string names_source(int names)
+{
+    std::string src;
+
+    for (int i = 0; i < names; i++)
+    {
+        char buf[128];
+        snprintf(buf, sizeof(buf), "typedef int t%i;\nstatic t%i v%i = %i;\n", i, i, i, i);
+        src += buf;
+    }
+
+    return src;
+}
+
+
+/**
+ * Writes the given number of guarded headers to the directory dir, each of
+ * which includes a few of the ones before it; returns a translation unit
+ * including all of them.
+ */
+static std::string write_headers(const std::string &dir, int headers)
+{
+    std::string unit;
+
+    for (int i = 0; i < headers; i++)
+    {
+        char buf[256];
+        std::string header;
+
+        snprintf(buf, sizeof(buf), "#ifndef HEADER_%i\n#define HEADER_%i\n", i, i);
+        header += buf;
+        for (int dep: {i - 1, i / 2, i / 3})
+        {
+            if (dep < 0)
+                continue;
+            snprintf(buf, sizeof(buf), "#include \"header-%i.h\"\n", dep);
+            header += buf;
+        }
+        snprintf(buf, sizeof(buf), "typedef int t%i;\nstruct s%i { t%i a, b; };\n#endif\n", i, i, i);
+        header += buf;
+
+        snprintf(buf, sizeof(buf), "%s/header-%i.h", dir.c_str(), i);
+        FILE *fp = fopen(buf, "w");
+        fputs(header.c_str(), fp);
+        fclose(fp);
+
+        snprintf(buf, sizeof(buf), "#include <header-%i.h>\n", i);
+        unit += buf;
+    }
+
+    return unit + "int main;\n";
+}
+
+
+/**
+ * Generates lookup tables of integer, float, char and string literals with
+ * the given total number of entries.
+ */
+static std::string tables_source(int entries)
+{
+    std::string src;
+
+    for (int t = 0; t * 1000 < entries; t++)
+    {
+        char buf[128];
+        snprintf(buf, sizeof(buf), "static const unsigned long itab%i[] = {\n", t);
+        src += buf;
+        for (int i = 0; i < 250; i++)
+        {
+            snprintf(buf, sizeof(buf), "    %uu, 0x%08xUL,\n", (t * 250 + i) * 2654435761u, (t * 250 + i) * 40503u);
+            src += buf;
+        }
+        src += "};\n";
+
+        snprintf(buf, sizeof(buf), "static const double ftab%i[] = {\n", t);
+        src += buf;
+        for (int i = 0; i < 250; i++)
+        {
+            snprintf(buf, sizeof(buf), "    %.6f, %.3fe-%if,\n", (t * 250 + i) * 0.7071, i * 1.5, i % 30);
+            src += buf;
+        }
+        src += "};\n";
+
+        snprintf(buf, sizeof(buf), "static const char ctab%i[] = {\n", t);
+        src += buf;
+        for (int i = 0; i < 125; i++)
+            src += "    'a', '\\n', 'z', '\\x41',\n";
+        src += "};\n";
+
+        snprintf(buf, sizeof(buf), "static const char *stab%i[] = {\n", t);
+        src += buf;
+        for (int i = 0; i < 250; i++)
+            src += "    \"entry\", \"with an \\\"escape\\\"\\n\",\n";
+        src += "};\n";
+    }
+
+    return src;
+}
+
+
+/**
+ * Generates an array of the given number of integer literals of all bases,
+ * sizes and suffixes.
+ */
+static std::string integers_source(int literals)
+{
+    static const char *const suffixes[] = {"", "u", "l", "UL", "ll", "ull"};
+    std::string src = "static const unsigned long long itab[] = {\n";
+    unsigned long long x = 1;
+
+    for (int i = 0; i < literals; i++)
+    {
+        // Spread the values over all magnitudes
+        x = x * 6364136223846793005ull + 1442695040888963407ull;
+        unsigned long long v = x >> (x % 61);
+
+        char buf[64];
+        switch (i % 3)
+        {
+            case 0: snprintf(buf, sizeof(buf), "    %llu%s,\n",  v >> 1, suffixes[i % 6]); break;
+            case 1: snprintf(buf, sizeof(buf), "    0x%llx%s,\n", v,      suffixes[i % 6]); break;
+            case 2: snprintf(buf, sizeof(buf), "    0%llo%s,\n",  v,      suffixes[i % 6]); break;
+        }
+        src += buf;
+    }
+
+    return src + "};\n";
+}
+
+
+/**
+ * Runs the given function in a child process so that its peak RSS and
+ * allocation count are not influenced by others.
+ */
+static void run_isolated(void (*bench)(const bench_input &), const bench_input &in)
+{
+    fflush(stdout);
+
+    pid_t pid = fork();
+    if (!pid)
+    {
+        malloc_calls = 0;
+        bench(in);
+        fflush(stdout);
+        _exit(0);
+    }
+
+    int status;
+    waitpid(pid, &status, 0);
+}
+
+
+struct parse_stats
+{
+    size_t tokens;
+    double tokenize_time, parse_time;
+    unsigned long mallocs;
+    size_t arena_bytes, token_bytes;
+};
+
+
+static bool measure_parse(const std::string &source, parse_stats *stats)
+{
+    try
+    {
+        double start = now();
+        unsigned long start_mallocs = malloc_calls;
+
+        arena tu_arena;
+        token_stream token_list = tokenize(source.c_str());
+        double tokenized = now();
+
+        build_syntax_tree(token_list, &tu_arena);
+        double parsed = now();
+
+        stats->tokens = token_list.size();
+        stats->tokenize_time = tokenized - start;
+        stats->parse_time = parsed - tokenized;
+        stats->mallocs = malloc_calls - start_mallocs;
+        stats->arena_bytes = tu_arena.bytes_used();
+        stats->token_bytes = token_list.bytes_used();
+
+        return true;
+    }
+    catch (error *err)
+    {
+        err->emit();
+        delete err;
+        return false;
+    }
+}
+
+
+static void bench_parse(const bench_input &in)
+{
+    parse_stats st;
+    if (!measure_parse(in.source, &st))
+        return;
+
+    printf("parse     %-24s %8zu bytes %8zu tokens  tokenize %8.2f ms  parse %9.2f ms  %9lu mallocs  tokens %6zu kB  arena %7zu kB  peak RSS %7li kB\n",
+           in.name.c_str(), in.source.length(), st.tokens, st.tokenize_time * 1e3, st.parse_time * 1e3,
+           st.mallocs, st.token_bytes / 1024, st.arena_bytes / 1024, peak_rss_kb());
+}
+
+
+static void bench_tokenize(const bench_input &in)
+{
+    try
+    {
+        // Compare all scan kernel sets the CPU supports
+        for (const scan_kernels *const *k = supported_scan_kernels(); *k; k++)
+        {
+            scan = *k;
+
+            // Repeat for at least half a second for a stable result
+            double start = now(), end;
+            size_t tokens = 0;
+            int runs = 0;
+
+            do
+            {
+                tokens = tokenize(in.source.c_str()).size();
+                runs++;
+                end = now();
+            }
+            while (end - start < .5);
+
+            double per_run = (end - start) / runs;
+            printf("tokenize  %-24s %-6s %8zu bytes %8zu tokens  %8.2f ms  %7.1f MB/s  %6.1f ns/token\n",
+                   in.name.c_str(), (*k)->name, in.source.length(), tokens, per_run * 1e3,
+                   in.source.length() / per_run / 1e6, per_run * 1e9 / tokens);
+        }
+    }
+    catch (error *err)
+    {
+        err->emit();
+        delete err;
+    }
+}
+
+
+static void bench_decode(const bench_input &in)
+{
+    try
+    {
+        token_stream tokens = tokenize(in.source.c_str());
+        size_t literals = 0;
+        long double sum = 0;
+
+        double start = now();
+        for (token_index i = 0; i < tokens.size(); i++)
+        {
+            switch (tokens.type(i))
+            {
+                case token::LIT_INTEGER: sum += tokens.integer_value(i).value.s; literals++; break;
+                case token::LIT_FLOAT:   sum += tokens.float_value(i).value;     literals++; break;
+                default: break;
+            }
+        }
+        double end = now();
+
+        printf("decode    %-24s %8zu literals  %8.2f ms  %6.1f ns/literal  (checksum %Lg)\n",
+               in.name.c_str(), literals, (end - start) * 1e3, (end - start) * 1e9 / literals, sum);
+    }
+    catch (error *err)
+    {
+        err->emit();
+        delete err;
+    }
+}
+
+
+static void bench_names(const bench_input &in)
+{
+    parse_stats st;
+    if (!measure_parse(in.source, &st))
+        return;
+
+    printf("names     %-24s %8zu tokens  parse %9.2f ms  %7.1f ns/token\n",
+           in.name.c_str(), st.tokens, st.parse_time * 1e3, st.parse_time * 1e9 / st.tokens);
+}
+
+
+// Tokenizes and parses one after the other, pulling tokens while parsing,
+// and with the tokenizer pipelined on a thread of its own
+static void bench_pipeline(const bench_input &in)
+{
+    static const char *const modes[] = {"serial", "streamed", "pipelined"};
+    double serial = 0;
+
+    try
+    {
+        for (int mode = 0; mode < 3; mode++)
+        {
+            // Repeat for at least half a second for a stable result
+            double start = now(), end;
+            int runs = 0;
+
+            do
+            {
+                arena tu_arena;
+                if (mode == 0)
+                {
+                    token_stream token_list = tokenize(in.source.c_str());
+                    build_syntax_tree(token_list, &tu_arena);
+                }
+                else
+                {
+                    token_source source(in.source.c_str());
+                    if (mode == 2)
+                        source.run_pipelined();
+                    build_syntax_tree(source, &tu_arena);
+                }
+
+                runs++;
+                end = now();
+            }
+            while (end - start < .5);
+
+            double per_run = (end - start) / runs;
+            if (!mode)
+                serial = per_run;
+
+            printf("pipeline  %-24s %-9s %8zu bytes  %9.2f ms  speedup %5.2f\n",
+                   in.name.c_str(), modes[mode], in.source.length(), per_run * 1e3, serial / per_run);
+        }
+    }
+    catch (error *err)
+    {
+        err->emit();
+        delete err;
+    }
+}
+
+
+// Dumps the tokens and syntax tree the way the driver does (to /dev/null),
+// compared to parsing
+static void bench_dump(const bench_input &in)
+{
+    try
+    {
+        arena tu_arena;
+        double start = now();
+        token_stream token_list = tokenize(in.source.c_str());
+        syntax_tree_node *root = build_syntax_tree(token_list, &tu_arena);
+        double parsed = now();
+
+        int fd = open("/dev/null", O_WRONLY);
+        fd_sink sink(fd);
+        unsigned long start_mallocs = malloc_calls;
+        {
+            dump_buffer out(&sink);
+            for (token_index tok = 0; tok < token_list.size(); tok++)
+                dump_token(&out, token_list, tok, 16);
+            dump_syntax_tree(&out, token_list, root);
+        }
+        double dumped = now();
+        close(fd);
+
+        printf("dump      %-24s %8zu tokens  parse %9.2f ms  dump %9.2f ms  %5lu mallocs\n",
+               in.name.c_str(), token_list.size(), (parsed - start) * 1e3, (dumped - parsed) * 1e3,
+               malloc_calls - start_mallocs);
+    }
+    catch (error *err)
+    {
+        err->emit();
+        delete err;
+    }
+}
+
+
+static void run_parse(const std::vector<bench_input> &inputs)
+{
+    for (const bench_input &in: inputs)
+        run_isolated(bench_parse, in);
+}
+
+
+static void run_tokenize(const std::vector<bench_input> &inputs)
+{
+    for (const bench_input &in: inputs)
+        run_isolated(bench_tokenize, in);
+}
+
+
+// Preprocessing with an empty include cache and a filled one (in.name is the
+// directory of the headers)
+static void bench_includes(const bench_input &in)
+{
+    static const int WARM_UNITS = 20;
+
+    include_cache cache;
+    pp_options options;
+    options.include_paths.push_back(in.name);
+
+    double cold = 0, warm = 0;
+    size_t tokens = 0;
+
+    for (int unit = 0; unit <= WARM_UNITS; unit++)
+    {
+        double start = now();
+        preprocessor pp(&cache, &options);
+
+        try
+        {
+            pp.run("unit.cpp", in.source.c_str());
+        }
+        catch (error *err)
+        {
+            err->emit();
+            delete err;
+            return;
+        }
+
+        (unit ? warm : cold) += now() - start;
+        tokens = pp.tokens.size();
+    }
+
+    printf("includes  %8zu tokens  cold %8.2f ms  warm %8.2f ms  %5lu read  %6lu cached  %6lu elided\n",
+           tokens, cold * 1e3, warm / WARM_UNITS * 1e3, cache.misses.load(), cache.hits.load(), cache.elided.load());
+}
+
+
+// Parsing a small unit after the input (as its header) from scratch, and from
+// a snapshot of the parser after the header
+static void bench_prefix(const bench_input &in)
+{
+    static const int UNITS = 5;
+    static const char unit[] = "t0 unit_t; box<int> unit_b;\nint unit_f(int a) { return f0(a, a) >> 1; }\n";
+
+    char path[] = "/tmp/pegi-bench-XXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0)
+    {
+        perror("mkstemp");
+        return;
+    }
+
+    try
+    {
+        std::string whole = in.source + "\n" + unit;
+        double full = 0, prefixed = 0;
+
+        for (int i = 0; i < UNITS; i++)
+        {
+            double start = now();
+            arena tu_arena;
+            token_stream token_list = tokenize(whole.c_str());
+            build_syntax_tree(token_list, &tu_arena);
+            full += now() - start;
+        }
+
+        double start = now();
+        {
+            arena prefix_arena;
+            token_stream header = tokenize(in.source.c_str());
+            parse_prefix prefix;
+            build_prefix(header, &prefix_arena, &prefix);
+            if (!write_prefix_file(fd, "header.hpp", header, prefix, ""))
+                perror("write_prefix_file");
+        }
+        double written = now();
+
+        prefix_file pf;
+        if (!pf.load(path))
+        {
+            perror("prefix_file::load");
+            close(fd);
+            unlink(path);
+            return;
+        }
+        double loaded = now();
+
+        token_stream unit_tokens = tokenize(unit);
+        for (int i = 0; i < UNITS; i++)
+        {
+            double unit_start = now();
+            arena tu_arena;
+            prefixed_unit pu;
+            pf.start_unit("unit.cpp", unit_tokens, &tu_arena, &pu);
+            build_syntax_tree(pu.tokens, &tu_arena, &pu.prefix);
+            prefixed += now() - unit_start;
+        }
+
+        printf("prefix    %-24s %8zu bytes  full %8.2f ms  write %8.2f ms  %7llu kB  load %6.2f ms  prefixed %8.2f ms\n",
+               in.name.c_str(), in.source.length(), full / UNITS * 1e3, (written - start) * 1e3,
+               static_cast<unsigned long long>(lseek(fd, 0, SEEK_END)) / 1024, (loaded - written) * 1e3,
+               prefixed / UNITS * 1e3);
+    }
+    catch (error *err)
+    {
+        err->emit();
+        delete err;
+    }
+
+    close(fd);
+    unlink(path);
+}
+
+
+// Parses the given number of copies of each input on a thread pool of the
+// given size; returns the wall-clock time taken
+static double parse_on_pool(const std::vector<bench_input> &inputs, int copies, int workers)
+{
+    thread_pool pool(workers);
+    size_t units = inputs.size() * copies;
+
+    double start = now();
+    pool.run(units, [&](size_t unit, int) {
+        try
+        {
+            arena tu_arena;
+            token_stream token_list = tokenize(inputs[unit % inputs.size()].source.c_str());
+            build_syntax_tree(token_list, &tu_arena);
+        }
+        catch (error *err)
+        {
+            delete err;
+        }
+    });
+
+    return now() - start;
+}
+
+
+// Scaling of parsing many translation units with the -j thread pool
+static void run_jobs(const std::vector<bench_input> &inputs)
+{
+    static const int COPIES = 32;
+    int cpus = std::max(1u, std::thread::hardware_concurrency());
+    double single = 0;
+
+    for (int workers = 1; ; workers = std::min(workers * 2, cpus))
+    {
+        double t = parse_on_pool(inputs, COPIES, workers);
+        if (workers == 1)
+            single = t;
+
+        printf("jobs      %2i workers %4zu units  %9.2f ms  speedup %5.2f\n",
+               workers, inputs.size() * COPIES, t * 1e3, single / t);
+
+        if (workers == cpus)
+            break;
+    }
+}
+
+
+// Latency of single large translation units with a pipelined tokenizer
+static void run_pipeline(const std::vector<bench_input> &inputs)
+{
+    for (const bench_input &in: inputs)
+        run_isolated(bench_pipeline, in);
+    run_isolated(bench_pipeline, {"synthetic-5000", synthetic_source(5000)});
+}
+
+
+// Time taken by the driver's dumps
+static void run_dump(const std::vector<bench_input> &inputs)
+{
+    for (const bench_input &in: inputs)
+        run_isolated(bench_dump, in);
+}
+
+
+// Tokenizer throughput and literal decoding speed on literal-heavy tables
+static void run_literals(const std::vector<bench_input> &)
+{
+    bench_input tables = {"tables-100k", tables_source(100000)};
+
+    run_isolated(bench_tokenize, tables);
+    run_isolated(bench_decode, tables);
+}
+
+
+// Integer literal decoding on literals of all bases and sizes
+static void run_integers(const std::vector<bench_input> &)
+{
+    run_isolated(bench_decode, {"integers-100k", integers_source(100000)});
+}
+
+
+// Parse time per token must not depend on the number of declared names
+static void run_names(const std::vector<bench_input> &)
+{
+    for (int names = 100; names <= 100000; names *= 10)
+        run_isolated(bench_names, {std::to_string(names) + " names", names_source(names)});
+}
+
+
+// Cost of headers included by every unit
+static void run_includes(const std::vector<bench_input> &)
+{
+    char dir[] = "/tmp/pegi-bench-XXXXXX";
+    if (!mkdtemp(dir))
+    {
+        perror("mkdtemp");
+        return;
+    }
+
+    static const int HEADERS = 500;
+    run_isolated(bench_includes, {dir, write_headers(dir, HEADERS)});
+
+    for (int i = 0; i < HEADERS; i++)
+        unlink((std::string(dir) + "/header-" + std::to_string(i) + ".h").c_str());
+    rmdir(dir);
+}
+
+
+static void run_prefix(const std::vector<bench_input> &)
+{
+    for (int units: {500, 2000})
+        run_isolated(bench_prefix, {"synthetic-" + std::to_string(units), synthetic_source(units)});
+}
+
+
+static const struct
+{
+    const char *name;
+    void (*run)(const std::vector<bench_input> &inputs);
+} benchmarks[] = {
+    {"tokenize", run_tokenize},
+    {"parse", run_parse},
+    {"names", run_names},
+    {"literals", run_literals},
+    {"integers", run_integers},
+    {"jobs", run_jobs},
+    {"pipeline", run_pipeline},
+    {"dump", run_dump},
+    {"includes", run_includes},
+    {"prefix", run_prefix},
+};
+
+
+int main(int argc, char *argv[])
+{
+    std::vector<bench_input> inputs;
+    std::vector<void (*)(const std::vector<bench_input> &)> selected;
+    int units = 50;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "-n") && (i + 1 < argc))
+        {
+            units = atoi(argv[++i]);
+            continue;
+        }
+
+        bool is_benchmark = false;
+        for (const auto &b: benchmarks)
+        {
+            if (!strcmp(argv[i], b.name))
+            {
+                selected.push_back(b.run);
+                is_benchmark = true;
+            }
+        }
+
+        if (is_benchmark)
+            continue;
+
+        FILE *fp = fopen(argv[i], "r");
+        if (!fp)
+        {
+            fprintf(stderr, "%s: Could not open %s: %s\n", argv[0], argv[i], strerror(errno));
+            return 1;
+        }
+
+        std::string source;
+        char buf[65536];
+        size_t len;
+        while ((len = fread(buf, 1, sizeof(buf), fp)) > 0)
+            source.append(buf, len);
+        fclose(fp);
+
+        inputs.push_back({argv[i], source});
+    }
+
+    if (inputs.empty())
+        inputs.push_back({"synthetic-" + std::to_string(units), synthetic_source(units)});
+
+    if (selected.empty())
+        for (const auto &b: benchmarks)
+            selected.push_back(b.run);
+
+    for (auto run: selected)
+        run(inputs);
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <cstddef>
+#include <vector>
+
+
+/**
+ * Bump allocator. Memory is only released all at once (when the arena is
+ * destroyed) or by rolling back to an earlier mark, which releases everything
+ * allocated after that mark. Destructors of objects allocated here are never
+ * called.
+ */
+class arena
+{
+    public:
+        struct mark
+        {
+            size_t chunk, offset;
+        };
+
+        arena(size_t chunk_size = 1 << 20);
+        ~arena(void);
+
+        arena(const arena &) = delete;
+        arena &operator=(const arena &) = delete;
+
+        void *alloc(size_t size, size_t alignment = alignof(std::max_align_t));
+        char *strndup(const char *str, size_t length);
+
+        mark get_mark(void) const { return {current, offset}; }
+        void rollback(const mark &m);
+        bool allocated_since(const mark &m, const void *ptr) const;
+
+        size_t bytes_used(void) const;
+
+    private:
+        struct chunk
+        {
+            char *base;
+            size_t size;
+        };
+
+        std::vector<chunk> chunks;
+        size_t current, offset, chunk_size;
+};
+
+
+/**
+ * Allocator for standard containers, taking memory from an arena.
+ * Deallocation does nothing.
+ */
+template<typename T> class arena_allocator
+{
+    public:
+        typedef T value_type;
+
+        arena *source;
+
+        arena_allocator(arena *a): source(a) {}
+        template<typename U> arena_allocator(const arena_allocator<U> &other): source(other.source) {}
+
+        T *allocate(size_t n) { return static_cast<T *>(source->alloc(n * sizeof(T), alignof(T))); }
+        void deallocate(T *, size_t) {}
+
+        template<typename U> bool operator==(const arena_allocator<U> &other) const { return source == other.source; }
+        template<typename U> bool operator!=(const arena_allocator<U> &other) const { return source != other.source; }
+};
+
+#endif
@@ -0,0 +1,151 @@
+#ifndef AST_FILE_HPP
+#define AST_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "parser.hpp"
+#include "tokenize.hpp"
+
+
+/*
+ * Binary syntax tree files, for tools that want to use a syntax tree without
+ * parsing anything: the file is laid out exactly like the structures below
+ * (in host byte order), so it can be mapped and used right away.
+ *
+ *   ast_file_header
+ *   ast_file_node[node_count]      nodes in breadth-first order (the root is
+ *                                  node 0, all children of a node are
+ *                                  consecutive)
+ *   ast_file_token[token_count]
+ *   uint32_t[kind_count]           offsets of the node kind names (as in
+ *                                  parser_type_names) in the string section
+ *   char[]                         string section
+ *   char[source_length + 1]        the source text, null-terminated
+ *
+ * Every section starts at a multiple of 8 bytes, at the offset given in the
+ * header. Files of other versions are rejected; new versions may add fields
+ * and sections, but never move the ones in here.
+ */
+
+static const uint32_t AST_FILE_VERSION = 1;
+
+// Node or token index meaning "none"
+static const uint32_t AST_NONE = UINT32_MAX;
+
+
+struct ast_file_header
+{
+    char magic[8];  // "PEGIAST" and a null byte
+    uint32_t version;
+
+    uint32_t node_count, token_count, kind_count;
+    uint64_t source_length;
+
+    uint64_t nodes_offset, tokens_offset, kind_names_offset, strings_offset, source_offset;
+};
+
+
+struct ast_file_node
+{
+    uint32_t kind;  // syntax_tree_node::sv_type
+    uint32_t parent;
+    uint32_t first_child, child_count;
+    // The token of token nodes
+    uint32_t token;
+    // For typedef-name, class-name, template-name and original-namespace-name
+    // nodes: the node of their declaration (if it is part of the tree)
+    uint32_t declaration;
+};
+
+
+struct ast_file_token
+{
+    uint8_t type;     // token::token_type
+    uint8_t subtype;  // lit_integer::integer_type or lit_float::float_type
+    uint16_t reserved;
+
+    // Spelling in the source text
+    uint32_t offset, length;
+    uint32_t line, column;
+    uint32_t reserved2;
+
+    // Decoded value of integer (u for unsigned types, s for signed ones),
+    // float (long double literals rounded to double), bool and char literals
+    union
+    {
+        uint64_t u;
+        int64_t s;
+        double f;
+    } value;
+};
+
+
+/**
+ * Writes the syntax tree below root and the tokens it refers to to fd in a
+ * single write. Returns false and sets errno on failure.
+ */
+bool write_ast_file(int fd, const token_stream &tokens, const syntax_tree_node *root);
+
+
+// Part of a file written by write_sections()
+struct file_section
+{
+    const void *data;
+    size_t length;
+    // Where to store the section's offset in the file (may be nullptr)
+    uint64_t *offset;
+};
+
+/**
+ * Writes the given sections to fd in a single write, each starting at a
+ * multiple of 8 bytes. Their offsets are stored before anything is written,
+ * so they may point into the first section (the header). Returns false and
+ * sets errno on failure.
+ */
+bool write_sections(int fd, const file_section *sections, size_t count);
+
+/**
+ * Maps all of the given file read-only (for munmap() to release). Returns
+ * nullptr and sets errno on failure (EINVAL if it is empty or not a regular
+ * file).
+ */
+const char *map_file(const char *path, size_t *size);
+
+
+/**
+ * A read-only mapping of a syntax tree file.
+ */
+class ast_file
+{
+    public:
+        ast_file(void): data(nullptr), size(0) {}
+        ~ast_file(void);
+
+        ast_file(const ast_file &) = delete;
+        ast_file &operator=(const ast_file &) = delete;
+
+        // Maps the given file, replacing what has been loaded before. Returns
+        // false and sets errno on failure (EINVAL if it is not a syntax tree
+        // file of this version).
+        bool load(const char *path);
+
+        const ast_file_header &header(void) const { return *reinterpret_cast<const ast_file_header *>(data); }
+        const ast_file_node *nodes(void) const { return section<ast_file_node>(header().nodes_offset); }
+        const ast_file_token *tokens(void) const { return section<ast_file_token>(header().tokens_offset); }
+        const char *source(void) const { return section<char>(header().source_offset); }
+
+        const char *kind_name(uint32_t kind) const
+        { return section<char>(header().strings_offset) + section<uint32_t>(header().kind_names_offset)[kind]; }
+
+    private:
+        const char *data;
+        size_t size;
+
+        template<typename T> const T *section(uint64_t offset) const { return reinterpret_cast<const T *>(data + offset); }
+
+        void release(void);
+        bool valid(void) const;
+};
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef ATOMS_HPP
+#define ATOMS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+
+// Interned spelling of an identifier or operator: two tokens are spelled the
+// same iff their atoms are equal.
+typedef uint32_t atom_t;
+
+enum predefined_atom: atom_t
+{
+    ATOM_NONE,
+
+#define ATOM(name, spelling) ATOM_##name,
+#include "predefined_atoms.hpp"
+#undef ATOM
+
+    PREDEFINED_ATOM_COUNT
+};
+
+
+atom_t intern(const char *spelling, size_t length);
+const char *atom_spelling(atom_t a);
+// Number of atoms (one more than the greatest atom)
+size_t atom_count(void);
+
+#endif
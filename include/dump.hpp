@@ -0,0 +1,104 @@
+#ifndef DUMP_HPP
+#define DUMP_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include "parser.hpp"
+#include "tokenize.hpp"
+
+
+/**
+ * Where a dump_buffer's contents end up.
+ */
+class dump_sink
+{
+    public:
+        virtual ~dump_sink(void) {}
+
+        // Returns false and sets errno on failure
+        virtual bool write(const char *data, size_t length) = 0;
+};
+
+
+// Writes to a file descriptor (which stays open)
+class fd_sink: public dump_sink
+{
+    public:
+        fd_sink(int f): fd(f) {}
+
+        bool write(const char *data, size_t length) override;
+
+    private:
+        int fd;
+};
+
+
+// Collects everything in memory
+class memory_sink: public dump_sink
+{
+    public:
+        std::vector<char> contents;
+
+        bool write(const char *data, size_t length) override;
+};
+
+
+/**
+ * Output buffer for dumps, with formatting for everything they consist of.
+ * The sink only sees large chunks: the buffer is passed on when it is full
+ * and on flush() (or destruction) only, and is reused afterwards.
+ */
+class dump_buffer
+{
+    public:
+        dump_buffer(dump_sink *s, size_t size = 65536);
+        ~dump_buffer(void);
+
+        dump_buffer(const dump_buffer &) = delete;
+        dump_buffer &operator=(const dump_buffer &) = delete;
+
+        // Passes everything on to the sink. Returns false and sets errno if
+        // this or anything before has failed (whatever could not be written
+        // is dropped).
+        bool flush(void);
+
+        void put(char c) { if (used == capacity) drain(); buffer[used++] = c; }
+        void put(const char *s, size_t length);
+        void put(const char *s) { put(s, strlen(s)); }
+        void put_spaces(size_t count);
+
+        // Like printf()'s %*llu, %*lli and %Lg
+        void put_unsigned(unsigned long long v, int width = 0);
+        void put_signed(long long v, int width = 0);
+        void put_float(long double v);
+
+    private:
+        dump_sink *sink;
+        char *buffer;
+        size_t used, capacity;
+
+        // Whether the sink has failed, and the errno it did so with
+        bool failed;
+        int failure;
+
+        void drain(void);
+        // Room for length bytes (at most capacity) at the end of the buffer
+        char *reserve(size_t length) { if (capacity - used < length) drain(); return buffer + used; }
+};
+
+
+/**
+ * Dumps a token in a line of its own: its kind (padded to spacing
+ * characters), optionally its position and its value.
+ */
+void dump_token(dump_buffer *out, const token_stream &tokens, token_index tok, int spacing, bool positions = false);
+
+/**
+ * Dumps the syntax tree below node, one node per line, indented by two
+ * spaces per level.
+ */
+void dump_syntax_tree(dump_buffer *out, const token_stream &tokens, const syntax_tree_node *node, bool positions = false);
+
+#endif
@@ -1,17 +1,24 @@
 #ifndef ERRORS_HPP
 #define ERRORS_HPP
 
+#include <cstdio>
+
 class error
 {
     public:
         int line, column;
         char *msg;
 
+        // For positions outside of the translation unit's own text (as in
+        // included files): the name and text of their file
+        const char *file, *text;
+
         error(int line, int column, char *message);
         error(char *message);
         ~error(void);
 
         void emit(const char *prg, const char *tu, const char *source) const;
+        void emit(FILE *fp, const char *prg, const char *tu, const char *source) const;
         void emit(void) const;
 };
 
@@ -0,0 +1,206 @@
+TOKEN,
+
+TRANSLATION_UNIT,
+PRIMARY_EXPRESSION,
+LITERAL,
+ID_EXPRESSION,
+UNQUALIFIED_ID,
+QUALIFIED_ID,
+NESTED_NAME_SPECIFIER_REPEATABLE,
+NESTED_NAME_SPECIFIER_START,
+NESTED_NAME_SPECIFIER,
+LAMBDA_EXPRESSION,
+LAMBDA_INTRODUCER,
+LAMBDA_CAPTURE,
+CAPTURE_DEFAULT,
+CAPTURE_LIST,
+CAPTURE,
+LAMBDA_DECLARATOR,
+POSTFIX_EXPRESSION_REPEATABLE,
+POSTFIX_EXPRESSION_START,
+POSTFIX_EXPRESSION,
+EXPRESSION_LIST,
+PSEUDO_DESTRUCTOR_NAME,
+UNARY_EXPRESSION,
+UNARY_OPERATOR,
+NEW_EXPRESSION,
+NEW_PLACEMENT,
+NEW_TYPE_ID,
+NEW_DECLARATOR,
+NOPTR_NEW_DECLARATOR,
+NEW_INITIALIZER,
+DELETE_EXPRESSION,
+NOEXCEPT_EXPRESSION,
+CAST_EXPRESSION,
+PM_OPERATOR,
+PM_EXPRESSION,
+MULTIPLICATIVE_OPERATOR,
+MULTIPLICATIVE_EXPRESSION,
+ADDITIVE_OPERATOR,
+ADDITIVE_EXPRESSION,
+SHIFT_OPERATOR,
+SHIFT_EXPRESSION,
+RELATIONAL_OPERATOR,
+RELATIONAL_EXPRESSION,
+EQUALITY_OPERATOR,
+EQUALITY_EXPRESSION,
+AND_EXPRESSION,
+EXCLUSIVE_OR_EXPRESSION,
+INCLUSIVE_OR_EXPRESSION,
+LOGICAL_AND_EXPRESSION,
+LOGICAL_OR_EXPRESSION,
+CONDITIONAL_EXPRESSION,
+ASSIGNMENT_EXPRESSION,
+ASSIGNMENT_OPERATOR,
+EXPRESSION,
+CONSTANT_EXPRESSION,
+STATEMENT,
+LABELED_STATEMENT,
+EXPRESSION_STATEMENT,
+COMPOUND_STATEMENT,
+STATEMENT_SEQ,
+SELECTION_STATEMENT,
+CONDITION,
+ITERATION_STATEMENT,
+FOR_INIT_STATEMENT,
+FOR_RANGE_DECLARATION,
+FOR_RANGE_INITIALIZER,
+JUMP_STATEMENT,
+DECLARATION_STATEMENT,
+DECLARATION_SEQ,
+DECLARATION,
+BLOCK_DECLARATION,
+ALIAS_DECLARATION,
+SIMPLE_DECLARATION,
+STATIC_ASSERT_DECLARATION,
+EMPTY_DECLARATION,
+ATTRIBUTE_DECLARATION,
+DECL_SPECIFIER,
+DECL_SPECIFIER_SEQ,
+STORAGE_CLASS_SPECIFIER,
+FUNCTION_SPECIFIER,
+TYPE_SPECIFIER,
+TRAILING_TYPE_SPECIFIER,
+TYPE_SPECIFIER_SEQ,
+TRAILING_TYPE_SPECIFIER_SEQ,
+SIMPLE_TYPE_SPECIFIER,
+TYPE_NAME,
+DECLTYPE_SPECIFIER,
+ELABORATED_TYPE_SPECIFIER,
+ENUM_SPECIFIER,
+ENUM_HEAD,
+OPAQUE_ENUM_DECLARATION,
+ENUM_KEY,
+ENUM_BASE,
+ENUMERATOR_LIST,
+ENUMERATOR_DEFINITION,
+ENUMERATOR,
+NAMESPACE_NAME,
+NAMESPACE_DEFINITION,
+NAMED_NAMESPACE_DEFINITION,
+ORIGINAL_NAMESPACE_DEFINITION,
+EXTENSION_NAMESPACE_DEFINITION,
+UNNAMED_NAMESPACE_DEFINITION,
+NAMESPACE_BODY,
+NAMESPACE_ALIAS_DEFINITION,
+QUALIFIED_NAMESPACE_SPECIFIER,
+USING_DECLARATION,
+USING_DIRECTIVE,
+ASM_DEFINITION,
+LINKAGE_SPECIFICATION,
+ATTRIBUTE_SPECIFIER_SEQ,
+ATTRIBUTE_SPECIFIER,
+GCC_ATTRIBUTE_SPECIFIER_SEQ,
+GCC_ATTRIBUTE_SPECIFIER,
+ALIGNMENT_SPECIFIER,
+ATTRIBUTE_LIST_ENTRY,
+ATTRIBUTE_LIST,
+ATTRIBUTE,
+ATTRIBUTE_TOKEN,
+ATTRIBUTE_SCOPED_TOKEN,
+ATTRIBUTE_NAMESPACE,
+ATTRIBUTE_ARGUMENT_CLAUSE,
+BALANCED_TOKEN_SEQ,
+BALANCED_TOKEN,
+INIT_DECLARATOR_LIST,
+INIT_DECLARATOR,
+DECLARATOR,
+PTR_DECLARATOR,
+NOPTR_DECLARATOR_REPEATABLE,
+NOPTR_DECLARATOR_START,
+NOPTR_DECLARATOR,
+PARAMETERS_AND_QUALIFIERS,
+TRAILING_RETURN_TYPE,
+PTR_OPERATOR,
+CV_QUALIFIER_SEQ,
+CV_QUALIFIER,
+REF_QUALIFIER,
+DECLARATOR_ID,
+TYPE_ID,
+ABSTRACT_DECLARATOR,
+PTR_ABSTRACT_DECLARATOR,
+NOPTR_ABSTRACT_DECLARATOR_REPEATABLE,
+NOPTR_ABSTRACT_DECLARATOR_START,
+NOPTR_ABSTRACT_DECLARATOR,
+ABSTRACT_PACK_DECLARATOR,
+NOPTR_ABSTRACT_PACK_DECLARATOR_REPEATABLE,
+NOPTR_ABSTRACT_PACK_DECLARATOR_START,
+NOPTR_ABSTRACT_PACK_DECLARATOR,
+PARAMETER_DECLARATION_CLAUSE,
+PARAMETER_DECLARATION_LIST,
+PARAMETER_DECLARATION,
+FUNCTION_DEFINITION,
+FUNCTION_BODY,
+INITIALIZER,
+BRACE_OR_EQUAL_INITIALIZER,
+INITIALIZER_CLAUSE,
+INITIALIZER_LIST,
+BRACED_INIT_LIST,
+CLASS_SPECIFIER,
+CLASS_HEAD,
+CLASS_HEAD_NAME,
+CLASS_VIRT_SPECIFIER,
+CLASS_KEY,
+MEMBER_SPECIFICATION,
+MEMBER_DECLARATION,
+MEMBER_DECLARATOR_LIST,
+MEMBER_DECLARATOR,
+VIRT_SPECIFIER_SEQ,
+VIRT_SPECIFIER,
+PURE_SPECIFIER,
+BASE_CLAUSE,
+BASE_SPECIFIER_LIST,
+BASE_SPECIFIER,
+CLASS_OR_DECLTYPE,
+BASE_TYPE_SPECIFIER,
+ACCESS_SPECIFIER,
+CONVERSION_FUNCTION_ID,
+CONVERSION_TYPE_ID,
+CONVERSION_DECLARATOR,
+CTOR_INITIALIZER,
+MEM_INITIALIZER_LIST,
+MEM_INITIALIZER,
+MEM_INITIALIZER_ID,
+OPERATOR_FUNCTION_ID,
+LITERAL_OPERATOR_ID,
+TEMPLATE_DECLARATION,
+TEMPLATE_PARAMETER_LIST,
+TEMPLATE_PARAMETER,
+TYPE_PARAMETER,
+SIMPLE_TEMPLATE_ID,
+TEMPLATE_ID,
+TEMPLATE_ARGUMENT_LIST,
+TEMPLATE_ARGUMENT,
+TYPENAME_SPECIFIER,
+EXPLICIT_INSTANTIATION,
+EXPLICIT_SPECIALIZATION,
+TRY_BLOCK,
+FUNCTION_TRY_BLOCK,
+HANDLER_SEQ,
+HANDLER,
+EXCEPTION_DECLARATION,
+THROW_EXPRESSION,
+EXCEPTION_SPECIFICATION,
+DYNAMIC_EXCEPTION_SPECIFICATION,
+TYPE_ID_LIST,
+NOEXCEPT_SPECIFICATION,
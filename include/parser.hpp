@@ -1,12 +1,60 @@
 #ifndef PARSER_HPP
 #define PARSER_HPP
 
-#include <list>
 #include <vector>
 
+#include "arena.hpp"
 #include "tokenize.hpp"
 
 
+class syntax_tree_node;
+
+
+// The children of a syntax tree node. The links are stored in the children
+// themselves (next_sibling, prev_sibling), so appending, removing and adopting
+// children never allocates and only touches the nodes involved.
+class child_list
+{
+    public:
+        class iterator
+        {
+            public:
+                iterator(syntax_tree_node *n = nullptr): node(n) {}
+
+                syntax_tree_node *operator*(void) const { return node; }
+                inline iterator &operator++(void);
+                bool operator==(const iterator &other) const { return node == other.node; }
+                bool operator!=(const iterator &other) const { return node != other.node; }
+
+            private:
+                syntax_tree_node *node;
+
+            friend class child_list;
+        };
+
+        child_list(void): first(nullptr), last(nullptr) {}
+        child_list(const child_list &) = delete;
+
+        iterator begin(void) const { return iterator(first); }
+        iterator end(void) const { return iterator(); }
+        syntax_tree_node *front(void) const { return first; }
+        syntax_tree_node *back(void) const { return last; }
+        bool empty(void) const { return !first; }
+
+        inline void push_back(syntax_tree_node *n);
+        inline void pop_back(void);
+        // n must be an element of this list
+        inline void remove(syntax_tree_node *n);
+        inline iterator erase(iterator i);
+        // Moves all elements of other in front of i
+        inline void splice(iterator i, child_list &other);
+        void clear(void) { first = last = nullptr; }
+
+    private:
+        syntax_tree_node *first, *last;
+};
+
+
 class syntax_tree_node
 {
     public:
@@ -24,9 +72,10 @@ class syntax_tree_node
         };
 
         syntax_tree_node *parent;
-        std::list<syntax_tree_node *> children;
+        syntax_tree_node *next_sibling, *prev_sibling;
+        child_list children;
         sv_type type;
-        token *ass_token;
+        token_index ass_token;
         bool intermediate;
 
         union
@@ -41,26 +90,181 @@ class syntax_tree_node
             //
             // For: original-namespace-name, template-name, typedef-name, class-name
             syntax_tree_node *declaration;
+
+            // The tokenizer never produces >> and >>= (see tokenize.cpp), so
+            // for shift-operator and assignment-operator nodes made of two
+            // tokens, fix_right_shifts() drops the second one and stores the
+            // operator here. Their remaining token child is spelled like this
+            // in the tree (the token stream itself is left alone). ATOM_NONE
+            // otherwise.
+            //
+            // For: shift-operator, assignment-operator
+            atom_t merged_operator;
         } supplemental;
 
+        // Names registered with this node as their (complete) declaration
+        struct name_link *names;
+
+        // Packrat memo entry this node is the reusable subtree of (only used by
+        // parsers generated with --packrat)
+        struct memo_entry *memo;
+
         syntax_tree_node(sv_type type, syntax_tree_node *parent = nullptr, bool intermediate = false);
-        ~syntax_tree_node(void);
+
+        // Nodes live in the arena passed to build_syntax_tree(); the whole
+        // tree is released together with it (nodes are never destroyed
+        // individually, the parser discards failed matches itself).
+        static void *operator new(size_t size, arena *a) { return a->alloc(size, alignof(syntax_tree_node)); }
+        static void operator delete(void *, arena *) {}
+        static void operator delete(void *) = delete;
 
         void detach(void);
-        bool sees(const syntax_tree_node *other) const;
-        bool sees_in_ns(const syntax_tree_node *other, const syntax_tree_node *ns) const;
-        syntax_tree_node *scope(void) const;
+        bool sees(const token_stream &tokens, const syntax_tree_node *other) const;
+        bool sees_in_ns(const token_stream &tokens, const syntax_tree_node *other, const syntax_tree_node *ns) const;
+        syntax_tree_node *scope(const token_stream &tokens) const;
         syntax_tree_node *scope_above(void) const;
         syntax_tree_node *scope_below(void) const;
-        token *first_token(void) const;
+        token_index first_token(void) const;
         void contract(void);
-        void fix_right_shifts(void);
+        void fix_right_shifts(const token_stream &tokens);
 };
 
 
+inline child_list::iterator &child_list::iterator::operator++(void)
+{
+    node = node->next_sibling;
+    return *this;
+}
+
+
+inline void child_list::push_back(syntax_tree_node *n)
+{
+    n->prev_sibling = last;
+    n->next_sibling = nullptr;
+
+    if (last)
+        last->next_sibling = n;
+    else
+        first = n;
+
+    last = n;
+}
+
+
+inline void child_list::pop_back(void)
+{
+    remove(last);
+}
+
+
+inline void child_list::remove(syntax_tree_node *n)
+{
+    if (n->prev_sibling)
+        n->prev_sibling->next_sibling = n->next_sibling;
+    else
+        first = n->next_sibling;
+
+    if (n->next_sibling)
+        n->next_sibling->prev_sibling = n->prev_sibling;
+    else
+        last = n->prev_sibling;
+}
+
+
+inline child_list::iterator child_list::erase(iterator i)
+{
+    iterator next(i.node->next_sibling);
+    remove(i.node);
+    return next;
+}
+
+
+inline void child_list::splice(iterator i, child_list &other)
+{
+    if (other.empty())
+        return;
+
+    syntax_tree_node *before = i.node;
+    syntax_tree_node *after = before ? before->prev_sibling : last;
+
+    other.first->prev_sibling = after;
+    other.last->next_sibling = before;
+
+    if (after)
+        after->next_sibling = other.first;
+    else
+        first = other.first;
+
+    if (before)
+        before->prev_sibling = other.last;
+    else
+        last = other.last;
+
+    other.clear();
+}
+
+
 extern const char *const parser_type_names[];
 
 
-syntax_tree_node *build_syntax_tree(const std::vector<token *> &token_list);
+// A name registered by the parser (kinds are its own flags, see name_entry)
+struct prefix_name
+{
+    atom_t name;
+    unsigned kinds;
+    syntax_tree_node *declaration, *complete_declaration;
+};
+
+// State of the parser after a prefix of complete declarations (such as a header
+// all translation units start with), to continue parsing from
+struct parse_prefix
+{
+    // Not contracted yet (nor have right shifts been fixed)
+    syntax_tree_node *root;
+    // Number of tokens parsed
+    token_index end;
+    // All registered names, in order of registration
+    std::vector<prefix_name> names;
+};
+
+
+// Counters of the handler of a syntactic variable, summed over all parses so
+// far (only collected by parsers generated with --profile). What happens in
+// the handlers it calls is part of its tokens, nodes and inclusive time
+// (recursive calls are counted once per level).
+struct rule_profile
+{
+    syntax_tree_node::sv_type rule;
+    uint64_t entries, successes, failures;
+    // Tokens consumed by the successful calls
+    uint64_t tokens;
+    // Nodes allocated during all calls, and during the failed ones (which
+    // have all been discarded again)
+    uint64_t nodes, discarded;
+    // Time stamp counter ticks, including and excluding those of the calls
+    // made
+    uint64_t inclusive, exclusive;
+    // Per alternative: how often it has been tried (as the current token was
+    // in its FIRST set) and how often it has matched
+    std::vector<uint64_t> attempts, matches;
+};
+
+// Whether the parser has been generated with --profile
+bool parser_profiling(void);
+// Counters of all rules entered so far
+std::vector<rule_profile> parse_profile(void);
+
+
+syntax_tree_node *build_syntax_tree(token_stream &token_list, arena *node_arena);
+// Pulls the tokens from the source as parsing gets to them
+syntax_tree_node *build_syntax_tree(token_source &source, arena *node_arena);
+// Continues after *prefix, which has been built from the first prefix->end
+// tokens of token_list. The prefix is consumed: its tree becomes part of the
+// result (and is contracted with it), so it cannot be continued from again.
+syntax_tree_node *build_syntax_tree(token_stream &token_list, arena *node_arena, parse_prefix *prefix);
+
+// Parses all of token_list like build_syntax_tree(), but stores the state at
+// its end in *prefix instead of finishing the tree
+void build_prefix(token_stream &token_list, arena *node_arena, parse_prefix *prefix);
 
 #endif
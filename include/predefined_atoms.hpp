@@ -0,0 +1,174 @@
+// Atoms known at compile time: ATOM(name, spelling) defines ATOM_<name>.
+// Spellings used in src/syntax must be listed here.
+
+// Operators and punctuators
+ATOM(DELETE,            "delete")
+ATOM(AND_EQ,            "and_eq")
+ATOM(BITAND,            "bitand")
+ATOM(NOT_EQ,            "not_eq")
+ATOM(XOR_EQ,            "xor_eq")
+ATOM(BITOR,             "bitor")
+ATOM(COMPL,             "compl")
+ATOM(OR_EQ,             "or_eq")
+ATOM(DIGRAPH_HASH_HASH, "%:%:")
+ATOM(ELLIPSIS,          "...")
+ATOM(NEW,               "new")
+ATOM(RSHIFT_ASSIGN,     ">>=")
+ATOM(LSHIFT_ASSIGN,     "<<=")
+ATOM(ARROW_STAR,        "->*")
+ATOM(AND,               "and")
+ATOM(NOT,               "not")
+ATOM(XOR,               "xor")
+ATOM(HASH_HASH,         "##")
+ATOM(DIGRAPH_LBRACKET,  "<:")
+ATOM(DIGRAPH_RBRACKET,  ":>")
+ATOM(DIGRAPH_LBRACE,    "<%")
+ATOM(DIGRAPH_RBRACE,    "%>")
+ATOM(DIGRAPH_HASH,      "%:")
+ATOM(SCOPE,             "::")
+ATOM(DOT_STAR,          ".*")
+ATOM(PLUS_ASSIGN,       "+=")
+ATOM(MINUS_ASSIGN,      "-=")
+ATOM(STAR_ASSIGN,       "*=")
+ATOM(SLASH_ASSIGN,      "/=")
+ATOM(PERCENT_ASSIGN,    "%=")
+ATOM(CARET_ASSIGN,      "^=")
+ATOM(AMP_ASSIGN,        "&=")
+ATOM(PIPE_ASSIGN,       "|=")
+ATOM(LSHIFT,            "<<")
+ATOM(RSHIFT,            ">>")
+ATOM(EQ,                "==")
+ATOM(NE,                "!=")
+ATOM(LE,                "<=")
+ATOM(GE,                ">=")
+ATOM(AMP_AMP,           "&&")
+ATOM(PIPE_PIPE,         "||")
+ATOM(PLUS_PLUS,         "++")
+ATOM(MINUS_MINUS,       "--")
+ATOM(ARROW,             "->")
+ATOM(OR,                "or")
+ATOM(LBRACE,            "{")
+ATOM(RBRACE,            "}")
+ATOM(LBRACKET,          "[")
+ATOM(RBRACKET,          "]")
+ATOM(HASH,              "#")
+ATOM(LPAREN,            "(")
+ATOM(RPAREN,            ")")
+ATOM(SEMICOLON,         ";")
+ATOM(COLON,             ":")
+ATOM(QUESTION,          "?")
+ATOM(DOT,               ".")
+ATOM(PLUS,              "+")
+ATOM(MINUS,             "-")
+ATOM(STAR,              "*")
+ATOM(SLASH,             "/")
+ATOM(PERCENT,           "%")
+ATOM(CARET,             "^")
+ATOM(AMP,               "&")
+ATOM(PIPE,              "|")
+ATOM(TILDE,             "~")
+ATOM(EXCLAIM,           "!")
+ATOM(ASSIGN,            "=")
+ATOM(LESS,              "<")
+ATOM(GREATER,           ">")
+ATOM(COMMA,             ",")
+
+// Keywords
+ATOM(ALIGNAS,          "alignas")
+ATOM(ALIGNOF,          "alignof")
+ATOM(ASM,              "asm")
+ATOM(AUTO,             "auto")
+ATOM(BOOL,             "bool")
+ATOM(BREAK,            "break")
+ATOM(CASE,             "case")
+ATOM(CATCH,            "catch")
+ATOM(CHAR,             "char")
+ATOM(CHAR16_T,         "char16_t")
+ATOM(CHAR32_T,         "char32_t")
+ATOM(CLASS,            "class")
+ATOM(CONST,            "const")
+ATOM(CONSTEXPR,        "constexpr")
+ATOM(CONST_CAST,       "const_cast")
+ATOM(CONTINUE,         "continue")
+ATOM(DECLTYPE,         "decltype")
+ATOM(DEFAULT,          "default")
+ATOM(DO,               "do")
+ATOM(DOUBLE,           "double")
+ATOM(DYNAMIC_CAST,     "dynamic_cast")
+ATOM(ELSE,             "else")
+ATOM(ENUM,             "enum")
+ATOM(EXPLICIT,         "explicit")
+ATOM(EXPORT,           "export")
+ATOM(EXTERN,           "extern")
+ATOM(FLOAT,            "float")
+ATOM(FOR,              "for")
+ATOM(FRIEND,           "friend")
+ATOM(GOTO,             "goto")
+ATOM(IF,               "if")
+ATOM(INLINE,           "inline")
+ATOM(INT,              "int")
+ATOM(LONG,             "long")
+ATOM(MUTABLE,          "mutable")
+ATOM(NAMESPACE,        "namespace")
+ATOM(NOEXCEPT,         "noexcept")
+ATOM(OPERATOR,         "operator")
+ATOM(PRIVATE,          "private")
+ATOM(PROTECTED,        "protected")
+ATOM(PUBLIC,           "public")
+ATOM(REGISTER,         "register")
+ATOM(REINTERPRET_CAST, "reinterpret_cast")
+ATOM(RETURN,           "return")
+ATOM(SHORT,            "short")
+ATOM(SIGNED,           "signed")
+ATOM(SIZEOF,           "sizeof")
+ATOM(STATIC,           "static")
+ATOM(STATIC_ASSERT,    "static_assert")
+ATOM(STATIC_CAST,      "static_cast")
+ATOM(STRUCT,           "struct")
+ATOM(SWITCH,           "switch")
+ATOM(TEMPLATE,         "template")
+ATOM(THIS,             "this")
+ATOM(THREAD_LOCAL,     "thread_local")
+ATOM(THROW,            "throw")
+ATOM(TRY,              "try")
+ATOM(TYPEDEF,          "typedef")
+ATOM(TYPEID,           "typeid")
+ATOM(TYPENAME,         "typename")
+ATOM(UNION,            "union")
+ATOM(UNSIGNED,         "unsigned")
+ATOM(USING,            "using")
+ATOM(VIRTUAL,          "virtual")
+ATOM(VOID,             "void")
+ATOM(VOLATILE,         "volatile")
+ATOM(WCHAR_T,          "wchar_t")
+ATOM(WHILE,            "while")
+
+// Literals
+ATOM(FALSE,   "false")
+ATOM(TRUE,    "true")
+ATOM(NULLPTR, "nullptr")
+
+// Identifiers with special meaning in some contexts
+ATOM(FINAL,     "final")
+ATOM(OVERRIDE,  "override")
+ATOM(ATTRIBUTE, "__attribute__")
+
+// Preprocessing directives and special identifiers
+ATOM(DEFINE,      "define")
+ATOM(UNDEF,       "undef")
+ATOM(INCLUDE,     "include")
+ATOM(IFDEF,       "ifdef")
+ATOM(IFNDEF,      "ifndef")
+ATOM(ELIF,        "elif")
+ATOM(ENDIF,       "endif")
+ATOM(ERROR,       "error")
+ATOM(WARNING,     "warning")
+ATOM(PRAGMA,      "pragma")
+ATOM(LINE,        "line")
+ATOM(ONCE,        "once")
+ATOM(DEFINED,     "defined")
+ATOM(VA_ARGS,     "__VA_ARGS__")
+ATOM(MACRO_FILE,  "__FILE__")
+ATOM(MACRO_LINE,  "__LINE__")
+ATOM(MACRO_DATE,  "__DATE__")
+ATOM(MACRO_TIME,  "__TIME__")
@@ -0,0 +1,169 @@
+#ifndef PREFIX_FILE_HPP
+#define PREFIX_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "arena.hpp"
+#include "parser.hpp"
+#include "tokenize.hpp"
+
+
+/*
+ * Prefix files: a snapshot of the parser after a header all translation units
+ * start with (see build_prefix()), so that parsing them can start where the
+ * header ends instead of parsing it again and again. Laid out like syntax
+ * tree files (see ast_file.hpp), so they are mapped rather than read:
+ *
+ *   prefix_file_header
+ *   prefix_file_node[node_count]   the uncontracted tree in depth-first order
+ *                                  (the root is node 0, every node comes
+ *                                  after its parent and its older siblings)
+ *   prefix_file_name[name_count]   registered names, in order of registration
+ *   uint32_t[atom_count]           offsets of the spellings of all atoms used
+ *                                  in the string section
+ *   uint8_t[token_count]           token types
+ *   uint32_t[token_count]          token atoms: index into the atom table,
+ *                                  PREFIX_NONE for ATOM_NONE, or literal value
+ *                                  index (as in token_stream)
+ *   uint32_t[token_count]          token offsets
+ *   uint32_t[token_count]          token lengths
+ *   uint8_t[float_count]           float literal subtypes
+ *   int32_t[line_count]            line table (see token_stream)
+ *   uint32_t[line_count]
+ *   prefix_file_file[file_count]   file table (never empty)
+ *   char[]                         string section
+ *   char[source_length + 1]        the source text, null-terminated
+ *   char[definitions_length + 1]   #define lines of the macros defined at the
+ *                                  end of the prefix, null-terminated
+ *
+ * Every section starts at a multiple of 8 bytes. Node kinds and name kinds
+ * are the parser's own, so files written by a parser generated from another
+ * grammar are rejected (see grammar).
+ */
+
+static const uint32_t PREFIX_FILE_VERSION = 1;
+
+// Node, token or atom index meaning "none"
+static const uint32_t PREFIX_NONE = UINT32_MAX;
+
+
+struct prefix_file_header
+{
+    char magic[8];  // "PEGIPFX" and a null byte
+    uint32_t version;
+    // Hash of the names of all node kinds
+    uint32_t grammar;
+
+    uint32_t node_count, name_count, atom_count, token_count;
+    uint32_t integer_count, float_count, line_count, file_count;
+    uint64_t source_length, definitions_length;
+
+    uint64_t nodes_offset, names_offset, atoms_offset;
+    uint64_t types_offset, token_atoms_offset, token_offsets_offset, token_lengths_offset;
+    uint64_t float_types_offset, line_numbers_offset, line_offsets_offset, files_offset;
+    uint64_t strings_offset, source_offset, definitions_offset;
+};
+
+
+struct prefix_file_node
+{
+    uint16_t kind;  // syntax_tree_node::sv_type
+    uint16_t intermediate;
+    uint32_t parent;
+    uint32_t token;
+    // For typedef-name, class-name, template-name and original-namespace-name
+    // nodes: the node of their declaration (if it is part of the tree)
+    uint32_t declaration;
+};
+
+
+struct prefix_file_name
+{
+    uint32_t atom;
+    uint32_t kinds;
+    uint32_t declaration, complete_declaration;
+};
+
+
+struct prefix_file_file
+{
+    uint32_t offset, text_offset;
+    // Offset in the string section
+    uint32_t name;
+    uint32_t reserved;
+};
+
+
+/**
+ * Writes the prefix parsed from tokens, and the given macro definitions, to
+ * fd in a single write. name is used as the file name of the tokens if they
+ * have no file table. Returns false and sets errno on failure.
+ */
+bool write_prefix_file(int fd, const char *name, const token_stream &tokens, const parse_prefix &prefix,
+                       const std::string &definitions);
+
+
+/**
+ * A translation unit continuing a prefix: its text follows the prefix's, its
+ * tokens follow the prefix's tokens, and prefix refers to a copy of the
+ * prefix's tree. Pass tokens and &prefix to build_syntax_tree(), which
+ * consumes the prefix.
+ */
+struct prefixed_unit
+{
+    std::vector<char> text;
+    token_stream tokens;
+    parse_prefix prefix;
+
+    prefixed_unit(void): tokens(nullptr) {}
+
+    prefixed_unit(const prefixed_unit &) = delete;
+    prefixed_unit &operator=(const prefixed_unit &) = delete;
+};
+
+
+/**
+ * A read-only mapping of a prefix file. Any number of translation units may
+ * be started from it at the same time.
+ */
+class prefix_file
+{
+    public:
+        prefix_file(void): data(nullptr), size(0) {}
+        ~prefix_file(void);
+
+        prefix_file(const prefix_file &) = delete;
+        prefix_file &operator=(const prefix_file &) = delete;
+
+        // Maps the given file, replacing what has been loaded before. Returns
+        // false and sets errno on failure (EINVAL if it is not a prefix file
+        // of this version and grammar).
+        bool load(const char *path);
+
+        const prefix_file_header &header(void) const { return *reinterpret_cast<const prefix_file_header *>(data); }
+        const char *source(void) const { return section<char>(header().source_offset); }
+        const char *definitions(void) const { return section<char>(header().definitions_offset); }
+
+        // Sets up *unit for the translation unit whose tokens are given
+        // (name is its file name if they have no file table). The prefix's
+        // nodes are allocated from node_arena.
+        void start_unit(const char *name, const token_stream &tokens, arena *node_arena, prefixed_unit *unit) const;
+
+    private:
+        const char *data;
+        size_t size;
+
+        // Atoms of the atom table in this process
+        std::vector<atom_t> atoms;
+
+        template<typename T> const T *section(uint64_t offset) const { return reinterpret_cast<const T *>(data + offset); }
+        const char *string(uint32_t offset) const { return section<char>(header().strings_offset) + offset; }
+
+        void release(void);
+        bool valid(void) const;
+};
+
+#endif
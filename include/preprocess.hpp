@@ -0,0 +1,157 @@
+#ifndef PREPROCESS_HPP
+#define PREPROCESS_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <sys/stat.h>
+#include <unordered_map>
+#include <vector>
+
+#include "error.hpp"
+#include "source_file.hpp"
+#include "tokenize.hpp"
+
+
+/**
+ * A file as the preprocessor sees it: its tokens and where its directives
+ * are. Never changes once it has been tokenized, so it can be shared by any
+ * number of translation units (and threads).
+ */
+struct pp_file
+{
+    std::string name;
+
+    // The text is either the file's contents or a buffer of its own
+    source_file contents;
+    std::string buffer;
+    const char *text;
+    size_t length;
+
+    std::vector<directive_range> directives;
+    token_stream tokens;
+
+    // Macro of an include guard around all of the file (ATOM_NONE if there
+    // is none): while it is defined, including the file again does nothing
+    atom_t guard;
+
+    // The file on disk (all zero for others)
+    dev_t device;
+    ino_t inode;
+    off_t size;
+    struct timespec modified;
+
+    // For spellings created during macro expansion: the file and line they
+    // were created in
+    const pp_file *site;
+    int site_line;
+
+    // Text that could not be tokenized, in order; it only fails a
+    // translation unit where the preprocessor does not skip it
+    std::vector<tokenize_failure> failures;
+
+
+    pp_file(void);
+
+    pp_file(const pp_file &) = delete;
+    pp_file &operator=(const pp_file &) = delete;
+
+    // Tokenizes text, recording any failures
+    void tokenize(void);
+    // The error of failures[i], as thrown by the preprocessor
+    error *failure(size_t i) const;
+};
+
+
+/**
+ * Files read by the preprocessor, kept for the whole process (and shared by
+ * all threads): a file is only read and tokenized again once it has changed
+ * on disk.
+ */
+class include_cache
+{
+    public:
+        // Number of files taken from the cache and read, respectively, and
+        // of includes skipped without even looking for the file (as its
+        // include guard or #pragma once showed it to be empty)
+        std::atomic<unsigned long> hits, misses, elided;
+
+
+        include_cache(void): hits(0), misses(0), elided(0) {}
+
+        include_cache(const include_cache &) = delete;
+        include_cache &operator=(const include_cache &) = delete;
+
+        // Returns the file at path (whose stat() result is st), reading it
+        // unless the cached version is current. Returns nullptr and sets
+        // errno if it cannot be read; files with text that could not be
+        // tokenized are returned as well (see pp_file::failures).
+        std::shared_ptr<const pp_file> get(const std::string &path, const struct stat &st);
+
+    private:
+        std::mutex lock;
+        std::unordered_map<std::string, std::shared_ptr<const pp_file>> files;
+};
+
+
+struct pp_options
+{
+    // Searched for #include <...>, and for #include "..." after the
+    // directory of the including file
+    std::vector<std::string> include_paths;
+    // #define and #undef lines to process before the translation unit (as
+    // given by -D and -U)
+    std::string definitions;
+};
+
+
+struct pp_state;
+
+/**
+ * Preprocesses a translation unit: carries out its directives and expands
+ * macros, working on the tokens of its files (which come from an
+ * include_cache, so every file is only tokenized once).
+ *
+ * The resulting tokens' source buffer holds copies of the files they come
+ * from (one each, in the order they are first needed) and the spellings
+ * created by # and ##; its file table tells which is which.
+ */
+class preprocessor
+{
+    public:
+        token_stream tokens;
+
+        // From #warning, in order
+        std::vector<std::unique_ptr<error>> warnings;
+
+
+        preprocessor(include_cache *cache, const pp_options *options);
+        ~preprocessor(void);
+
+        preprocessor(const preprocessor &) = delete;
+        preprocessor &operator=(const preprocessor &) = delete;
+
+        // Preprocesses the translation unit with the given name (used for
+        // __FILE__, errors and finding its includes) and text into tokens.
+        // Throws error * on failure.
+        void run(const char *name, const char *text);
+
+        // Whether run() has succeeded
+        bool done(void) const { return complete; }
+
+        // #define lines for the macros defined at the end of the last run()
+        // (for going on from there in another unit)
+        std::string macro_definitions(void) const;
+
+    private:
+        include_cache *files;
+        const pp_options *opts;
+
+        pp_state *state;
+        bool complete;
+};
+
+#endif
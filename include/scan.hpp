@@ -0,0 +1,29 @@
+#ifndef SCAN_HPP
+#define SCAN_HPP
+
+// Scanning primitives for the long runs tokenize() skips: comments and string
+// literals. All of them operate on null-terminated input whose terminating
+// null byte is at end; they stop there at the latest and never read past it,
+// so the input needs no padding.
+struct scan_kernels
+{
+    const char *name;
+
+    // Returns the next newline.
+    const char *(*line_end)(const char *p, const char *end);
+    // p points behind the "/*" of a block comment; returns the end of the
+    // comment (behind the "*/"), counting the newlines skipped in *line and
+    // pointing *line_start behind the last one.
+    const char *(*block_comment_end)(const char *p, const char *end, int *line, const char **line_start);
+    // Returns the next '"' or '\\'.
+    const char *(*string_stop)(const char *p, const char *end);
+};
+
+
+// Kernels used by tokenize(), initially the best ones supported by the CPU
+extern const scan_kernels *scan;
+
+// Returns all kernel sets supported by the CPU (best last, nullptr-terminated)
+const scan_kernels *const *supported_scan_kernels(void);
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef SOURCE_FILE_HPP
+#define SOURCE_FILE_HPP
+
+#include <cstddef>
+
+
+/**
+ * Contents of an input file, always followed by a null byte (which is what
+ * tokenize() expects). Regular files are mapped into memory instead of being
+ * copied; anything else (stdin, pipes, ...) is read into a growing buffer.
+ */
+class source_file
+{
+    public:
+        source_file(void): data(nullptr), size(0), mapped_size(0) {}
+        ~source_file(void);
+
+        source_file(const source_file &) = delete;
+        source_file &operator=(const source_file &) = delete;
+
+        // Loads the given file ("-" for stdin), replacing what has been
+        // loaded before. Returns false and sets errno on failure.
+        bool load(const char *path);
+        bool load(int fd);
+
+        const char *text(void) const { return data; }
+        size_t length(void) const { return size; }
+
+    private:
+        char *data;
+        size_t size;
+        // Length of the mapping (0 if data is a heap buffer)
+        size_t mapped_size;
+
+        void release(void);
+        bool map(int fd, size_t file_size);
+        bool read_all(int fd);
+};
+
+#endif
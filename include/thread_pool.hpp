@@ -0,0 +1,40 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+
+/**
+ * Runs independent tasks on a fixed number of worker threads. Every worker has
+ * its own queue, initially holding every n-th task; it works through that
+ * front to back (lowest task first) and, once it runs dry, steals from the
+ * back of the other workers' queues.
+ */
+class thread_pool
+{
+    public:
+        thread_pool(int workers);
+
+        int workers(void) const { return static_cast<int>(queues.size()); }
+
+        // Calls fn(task, worker) for every task in [0, tasks) and returns
+        // once all of them are done. Tasks must not throw.
+        void run(size_t tasks, const std::function<void(size_t task, int worker)> &fn);
+
+    private:
+        struct queue
+        {
+            std::mutex lock;
+            std::deque<size_t> tasks;
+        };
+
+        std::vector<queue> queues;
+
+        bool next_task(int worker, size_t *task);
+};
+
+#endif
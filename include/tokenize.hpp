@@ -2,143 +2,283 @@
 #define TOKENIZE_HPP
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 
-#include <type_traits>
+#include <string>
 #include <vector>
 
+#include "atoms.hpp"
 
-class token
+
+/**
+ * A range of the source buffer passed to tokenize(). Tokens do not copy their
+ * spelling, so that buffer has to outlive them.
+ */
+struct source_text
 {
-    public:
-        enum token_type
-        {
-            IDENTIFIER,
-            LIT_INTEGER,
-            LIT_FLOAT,
-            LIT_BOOL,
-            LIT_POINTER,
-            LIT_STRING,
-            LIT_CHAR,
-            OPERATOR
-        };
-
-
-        token_type type;
-        char *content;
-        int line;
-        int column;
-
-
-        token(token_type t, char *c): type(t), content(c) {}
-        ~token(void) { delete[] content; }
+    const char *start;
+    size_t length;
+
+    bool operator==(const char *s) const { return !strncmp(start, s, length) && !s[length]; }
+    bool operator!=(const char *s) const { return !(*this == s); }
 };
 
 
-class identifier_token:
-    public token
+namespace token
 {
-    public:
-        char *value;
-        identifier_token(char *c);
-};
+    enum token_type: uint8_t
+    {
+        IDENTIFIER,
+        LIT_INTEGER,
+        LIT_FLOAT,
+        LIT_BOOL,
+        LIT_POINTER,
+        LIT_STRING,
+        LIT_CHAR,
+        OPERATOR
+    };
+}
 
 
-class lit_integer_token:
-    public token
-{
-    public:
-        enum integer_type
-        {
-            SIGNED    = (0 << 0),
-            UNSIGNED  = (1 << 0),
-            INT       = (0 << 1),
-            LONG      = (1 << 1),
-            LONG_LONG = (2 << 1),
-
-            SIGNED_INT         =   SIGNED | INT,
-            UNSIGNED_INT       = UNSIGNED | INT,
-            SIGNED_LONG        =   SIGNED | LONG,
-            UNSIGNED_LONG      = UNSIGNED | LONG,
-            SIGNED_LONG_LONG   =   SIGNED | LONG_LONG,
-            UNSIGNED_LONG_LONG = UNSIGNED | LONG_LONG
-        };
-
-        integer_type subtype;
-        union
-        {
-              signed long long s;
-            unsigned long long u;
-        } value;
-
-        lit_integer_token(char *c);
-};
+// Position of a token in its token_stream
+typedef uint32_t token_index;
 
+static const token_index NO_TOKEN = UINT32_MAX;
 
-class lit_float_token:
-    public token
+
+struct lit_integer
 {
-    public:
-        enum float_type
-        {
-            FLOAT,
-            DOUBLE,
-            LONG_DOUBLE
-        };
+    enum integer_type
+    {
+        SIGNED    = (0 << 0),
+        UNSIGNED  = (1 << 0),
+        INT       = (0 << 1),
+        LONG      = (1 << 1),
+        LONG_LONG = (2 << 1),
+
+        SIGNED_INT         =   SIGNED | INT,
+        UNSIGNED_INT       = UNSIGNED | INT,
+        SIGNED_LONG        =   SIGNED | LONG,
+        UNSIGNED_LONG      = UNSIGNED | LONG,
+        SIGNED_LONG_LONG   =   SIGNED | LONG_LONG,
+        UNSIGNED_LONG_LONG = UNSIGNED | LONG_LONG
+    };
+
+    integer_type subtype;
+    // Whether subtype and value are valid yet (they are only decoded on first
+    // access through token_stream::integer_value())
+    bool decoded;
+    union
+    {
+          signed long long s;
+        unsigned long long u;
+    } value;
+
+    lit_integer(void): decoded(false) {}
+    void decode(source_text s);
+};
 
-        float_type subtype;
-        long double value;
 
-        lit_float_token(char *c);
+struct lit_float
+{
+    enum float_type
+    {
+        FLOAT,
+        DOUBLE,
+        LONG_DOUBLE
+    };
+
+    // The subtype is known right away, the value is only decoded on first
+    // access through token_stream::float_value()
+    float_type subtype;
+    bool decoded;
+    long double value;
+
+    lit_float(float_type t): subtype(t), decoded(false) {}
+    void decode(source_text s);
 };
 
 
-class lit_bool_token:
-    public token
+/**
+ * A file whose text is part of a token_stream's source buffer, starting at
+ * offset. Its lines are counted from text_offset (spellings created during
+ * macro expansion are not part of the file's text, but belong to its line
+ * they were created in).
+ */
+struct token_file
 {
-    public:
-        bool value;
-        lit_bool_token(char *c);
+    uint32_t offset, text_offset;
+    const char *name;
 };
 
 
-class lit_pointer_token:
-    public token
+/**
+ * The tokens of a translation unit, stored as parallel arrays (about 13 bytes
+ * per token) so that the parser's backtracking only touches what it needs:
+ * the type and atom arrays.
+ */
+class token_stream
 {
     public:
-        void *value;
-        lit_pointer_token(char *c);
+        // Integer and float literals store the index into their value table
+        // ORed with this instead of an atom (no atom ever gets this big, so
+        // they never compare equal to one)
+        static const atom_t LITERAL_VALUE = 0x80000000u;
+
+        const char *source;
+
+        std::vector<uint8_t> types;
+        // Spelling of identifiers and operators (ATOM_NONE for bool, pointer,
+        // string and char literals)
+        std::vector<atom_t> atoms;
+        std::vector<uint32_t> offsets, lengths;
+
+        // Line table: line line_numbers[i] starts at line_offsets[i] (only
+        // lines containing tokens are recorded)
+        std::vector<int> line_numbers;
+        std::vector<uint32_t> line_offsets;
+
+        // Decoded lazily (tokenize() has already checked everything that
+        // could fail, so decoding never throws)
+        mutable std::vector<lit_integer> integers;
+        mutable std::vector<lit_float> floats;
+
+        // Files the source buffer consists of, by their offset (empty if it
+        // is a single one, as for tokenize())
+        std::vector<token_file> files;
+
+
+        token_stream(const char *src): source(src) {}
+
+        size_t size(void) const { return types.size(); }
+
+        token::token_type type(token_index i) const { return static_cast<token::token_type>(types[i]); }
+        atom_t atom(token_index i) const { return atoms[i]; }
+        source_text spelling(token_index i) const { return {source + offsets[i], lengths[i]}; }
+
+        int line(token_index i) const;
+        int column(token_index i) const;
+        // nullptr if there is no file table
+        const token_file *file(token_index i) const;
+
+        const lit_integer &integer_value(token_index i) const;
+        const lit_float &float_value(token_index i) const;
+        unsigned char_value(token_index i) const;
+        bool bool_value(token_index i) const { return source[offsets[i]] == 't'; }
+
+        // String literals are only decoded on request: string_length()
+        // returns the number of characters decode_string() stores in the
+        // given buffer
+        size_t string_length(token_index i) const;
+        void decode_string(token_index i, char *buffer) const;
+        bool string_is(token_index i, const char *s) const;
+
+        void push(token::token_type t, atom_t a, const char *start, size_t length);
+        // Appends the tokens of another stream of the same source buffer
+        // that continues where this one ends
+        void append(const token_stream &next);
+
+        // Memory held by all arrays
+        size_t bytes_used(void) const;
 };
 
 
-class lit_string_token:
-    public token
+// The tokens of a preprocessing directive: from the # to the end of its line
+struct directive_range
 {
-    public:
-        char *value;
-        size_t length;
-        lit_string_token(char *c);
-        ~lit_string_token(void) { delete[] value; }
+    token_index start, end;
 };
 
 
-class lit_char_token:
-    public token
+// Text tokenize_directives() could not tokenize (the rest of its line is
+// skipped): it comes before token at, and belongs to the directive ending
+// there if in_directive is set
+struct tokenize_failure
 {
-    public:
-        unsigned value;
-        lit_char_token(char *c);
+    token_index at;
+    bool in_directive;
+    int line, column;
+    std::string message;
 };
 
 
-class operator_token:
-    public token
+struct token_pipeline;
+
+/**
+ * Tokenizes a source buffer on demand, appending to its token_stream only as
+ * many tokens as have been asked for. Token indices are the same as if the
+ * whole buffer had been tokenized at once; errors are thrown (as error *)
+ * once the consumer gets to them. Tokens are kept for as long as the
+ * token_source exists, as syntax tree nodes refer to them by index.
+ *
+ * After run_pipelined(), a thread of its own tokenizes ahead instead and
+ * hands over batches of tokens through a lock-free queue; asking for tokens
+ * then only blocks if that thread has not gotten to them yet.
+ */
+class token_source
 {
     public:
-        char *value;
-        operator_token(char *c);
+        token_stream tokens;
+
+
+        token_source(const char *src);
+        // Recognizes preprocessing directives and records failures instead
+        // of throwing them, see tokenize_directives()
+        token_source(const char *src, std::vector<directive_range> *directive_list,
+                     std::vector<tokenize_failure> *failure_list);
+        ~token_source(void);
+
+        token_source(const token_source &) = delete;
+        token_source &operator=(const token_source &) = delete;
+
+        void run_pipelined(void);
+
+        // Tokenizes until token i exists or the input is exhausted; returns
+        // whether it exists
+        bool fill(token_index i) { return (i < tokens.size()) || produce(i); }
+        // Tokenizes the rest of the input
+        void drain(void) { produce(NO_TOKEN); }
+        // Whether all of the input has been tokenized
+        bool exhausted(void) const;
+
+    private:
+        // Where tokenizing continues (and the line it is in), and the
+        // terminating null byte of the input
+        const char *position, *position_line_start;
+        const char *end;
+        int position_line;
+
+        // Producer thread and its queue (nullptr unless pipelined)
+        token_pipeline *pipeline;
+
+        // Where to record directives (nullptr if they are not recognized),
+        // whether the last one extends to the current line and where it
+        // continues
+        std::vector<directive_range> *directives;
+        bool in_directive;
+        int directive_line;
+
+        // Where to record failures (nullptr if they are thrown)
+        std::vector<tokenize_failure> *failures;
+
+        bool produce(token_index i);
+        bool tokenize_into(token_stream &ret, token_index i);
+        bool receive(token_index i);
+        void run_producer(void);
 };
 
 
-std::vector<token *> tokenize(const char *str);
+token_stream tokenize(const char *str);
+
+/**
+ * Tokenizes a file for the preprocessor: lines starting with # are recorded
+ * in *directives, and may be continued by a backslash at their end. The text
+ * of #error and #warning is not tokenized. Text that cannot be tokenized does
+ * not fail yet (it may be in a group skipped by #if): it is recorded in
+ * *failures, and the rest of its line is skipped.
+ */
+token_stream tokenize_directives(const char *str, std::vector<directive_range> *directives,
+                                 std::vector<tokenize_failure> *failures);
 
 #endif
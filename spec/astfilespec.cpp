@@ -0,0 +1,151 @@
+#ifndef _ASTFILESPEC_H
+#define _ASTFILESPEC_H
+
+#include "ast_file.hpp"
+#include "error.hpp"
+#include "parser.hpp"
+#include "tokenize.hpp"
+#include "igloo/igloo.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+
+using namespace igloo;
+
+Describe(ast_files)
+{
+    Spec(round_trip)
+    {
+        const char *source =
+            "class c { public: int v; };\n"
+            "typedef c t;\n"
+            "namespace n { t x = {0x2a}; }\n"
+            "int f(c *p) { return p->v >> 1 ? 1.5f : 'a'; }\n";
+
+        arena tu_arena;
+        token_stream token_list = tokenize(source);
+        syntax_tree_node *root = build_syntax_tree(token_list, &tu_arena);
+
+        std::string path;
+        int fd = temporary_file(&path);
+        Assert::That(write_ast_file(fd, token_list, root), IsTrue());
+        close(fd);
+
+        ast_file af;
+        Assert::That(af.load(path.c_str()), IsTrue());
+        unlink(path.c_str());
+
+        const ast_file_header &h = af.header();
+        Assert::That(h.version, Equals(AST_FILE_VERSION));
+        Assert::That(h.token_count, Equals(token_list.size()));
+        Assert::That(std::string(af.source()), Equals(source));
+        Assert::That(std::string(af.kind_name(af.nodes()[0].kind)), Equals("translation-unit"));
+
+        // The nodes must be the tree's in breadth-first order
+        std::vector<const syntax_tree_node *> order(1, root);
+        for (size_t i = 0; i < order.size(); i++)
+            for (const syntax_tree_node *c: order[i]->children)
+                order.push_back(c);
+
+        Assert::That(h.node_count, Equals(order.size()));
+
+        int declarations = 0;
+        for (uint32_t i = 0; i < h.node_count; i++)
+        {
+            const ast_file_node &n = af.nodes()[i];
+            Assert::That(n.kind, Equals(static_cast<uint32_t>(order[i]->type)));
+            Assert::That(std::string(af.kind_name(n.kind)), Equals(parser_type_names[n.kind]));
+            Assert::That(n.token, Equals(order[i]->ass_token));
+
+            uint32_t c = n.first_child;
+            for (const syntax_tree_node *child: order[i]->children)
+            {
+                Assert::That(order[c], Equals(child));
+                Assert::That(af.nodes()[c++].parent, Equals(i));
+            }
+            Assert::That(c - n.first_child, Equals(n.child_count));
+
+            if (n.declaration != AST_NONE)
+            {
+                Assert::That(order[n.declaration], Equals(order[i]->supplemental.declaration));
+                declarations++;
+            }
+        }
+        Assert::That(declarations, IsGreaterThan(0));
+
+        // The first token of the >> is spelled by both of its tokens
+        std::vector<size_t> lengths;
+        for (token_index i = 0; i < token_list.size(); i++)
+            lengths.push_back(token_list.spelling(i).length);
+
+        for (const syntax_tree_node *node: order)
+        {
+            if ((node->type == syntax_tree_node::SHIFT_OPERATOR) && (node->supplemental.merged_operator != ATOM_NONE))
+            {
+                Assert::That(node->supplemental.merged_operator, Equals(ATOM_RSHIFT));
+                lengths[node->children.front()->ass_token] = 2;
+            }
+        }
+
+        for (token_index i = 0; i < token_list.size(); i++)
+        {
+            const ast_file_token &t = af.tokens()[i];
+            source_text spelling = token_list.spelling(i);
+
+            Assert::That(t.type, Equals(token_list.type(i)));
+            Assert::That(std::string(af.source() + t.offset, t.length), Equals(std::string(spelling.start, lengths[i])));
+            Assert::That(static_cast<int>(t.line), Equals(token_list.line(i)));
+            Assert::That(static_cast<int>(t.column), Equals(token_list.column(i)));
+
+            switch (t.type)
+            {
+                case token::LIT_INTEGER: Assert::That(t.value.s, Equals(token_list.integer_value(i).value.s)); break;
+                case token::LIT_FLOAT:   Assert::That(t.value.f, Equals(1.5)); break;
+                case token::LIT_CHAR:    Assert::That(t.value.u, Equals(static_cast<uint64_t>('a'))); break;
+                default: break;
+            }
+        }
+    }
+
+
+    Spec(invalid_files)
+    {
+        errno = 0;
+        ast_file af;
+        Assert::That(af.load("/nonexistent/file.ast"), IsFalse());
+        Assert::That(errno, Equals(ENOENT));
+
+        std::string path = temporary_file("int a;\n");
+        Assert::That(af.load(path.c_str()), IsFalse());
+        Assert::That(errno, Equals(EINVAL));
+        unlink(path.c_str());
+
+        // Another version
+        ast_file_header h;
+        memset(&h, 0, sizeof(h));
+        memcpy(h.magic, "PEGIAST", 8);
+        h.version = AST_FILE_VERSION + 1;
+
+        path = temporary_file(std::string(reinterpret_cast<const char *>(&h), sizeof(h)));
+        Assert::That(af.load(path.c_str()), IsFalse());
+        Assert::That(errno, Equals(EINVAL));
+        unlink(path.c_str());
+
+        // Sections beyond the end of the file
+        h.version = AST_FILE_VERSION;
+        h.node_count = 1;
+        h.nodes_offset = 4096;
+
+        path = temporary_file(std::string(reinterpret_cast<const char *>(&h), sizeof(h)));
+        Assert::That(af.load(path.c_str()), IsFalse());
+        Assert::That(errno, Equals(EINVAL));
+        unlink(path.c_str());
+    }
+};
+
+#endif
@@ -0,0 +1,125 @@
+#ifndef _DUMPSPEC_H
+#define _DUMPSPEC_H
+
+#include "dump.hpp"
+#include "source_file.hpp"
+#include "igloo/igloo.h"
+
+#include <cerrno>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unistd.h>
+
+
+using namespace igloo;
+
+Describe(dumps)
+{
+    Spec(number_formatting)
+    {
+        // Everything printf() would make of these
+        static const long double floats[] = {
+            3.25L, 169.03125L, 1.5L, -2.L, 0.L, -0.L, 1e-5L, 1.00001e-4L, 0.1L, 0.3L, 123456.L, 999999.L,
+            999999.5L, 1234567.L, 9.999995L, 9.9999949L, 1e100L, 1.7976931348623157e308L, 5e-324L,
+            1e-4000L, 1.18973e4932L, HUGE_VALL, -HUGE_VALL, NAN
+        };
+
+        static const long long integers[] = {
+            0, 1, -1, 9, 10, 99, 100, -100, 12345, 4294967296LL, LLONG_MAX, LLONG_MIN
+        };
+
+        std::string expected;
+        char buf[64];
+
+        memory_sink sink;
+        {
+            dump_buffer out(&sink);
+
+            for (long double v: floats)
+            {
+                out.put_float(v);
+                out.put(' ');
+                snprintf(buf, sizeof(buf), "%Lg ", v);
+                expected += buf;
+            }
+
+            // And of a lot of arbitrary doubles
+            srand(42);
+            for (int i = 0; i < 100000; i++)
+            {
+                unsigned long long bits = 0;
+                for (int j = 0; j < 4; j++)
+                    bits = (bits << 16) ^ rand();
+
+                double d;
+                memcpy(&d, &bits, sizeof(d));
+                long double v = (i % 2) ? d : static_cast<long double>(rand() % 10000000) / 1000;
+
+                out.put_float(v);
+                out.put(' ');
+                snprintf(buf, sizeof(buf), "%Lg ", v);
+                expected += buf;
+            }
+
+            for (long long v: integers)
+            {
+                out.put_signed(v, 3);
+                out.put_unsigned(v);
+                snprintf(buf, sizeof(buf), "%3lli%llu", v, static_cast<unsigned long long>(v));
+                expected += buf;
+            }
+        }
+
+        Assert::That(std::string(sink.contents.begin(), sink.contents.end()), Equals(expected));
+    }
+
+
+    Spec(sinks)
+    {
+        // Pieces shorter and longer than the buffer
+        std::string contents;
+        for (int i = 0; contents.length() < 10000; i++)
+            contents += std::string(i % 150, 'a' + i % 26) + "\n";
+
+        std::string path;
+        int fd = temporary_file(&path);
+        fd_sink file(fd);
+        memory_sink memory;
+        {
+            dump_buffer to_file(&file, 100), to_memory(&memory, 100);
+
+            for (size_t i = 0, n; i < contents.length(); i += n + 1)
+            {
+                n = contents.find('\n', i) - i;
+                to_file.put(contents.c_str() + i, n);
+                to_file.put('\n');
+                to_memory.put(contents.c_str() + i, n);
+                to_memory.put('\n');
+            }
+
+            Assert::That(to_file.flush(), IsTrue());
+        }
+        close(fd);
+
+        source_file sf;
+        Assert::That(sf.load(path.c_str()), IsTrue());
+        unlink(path.c_str());
+
+        Assert::That(std::string(sf.text(), sf.length()), Equals(contents));
+        Assert::That(std::string(memory.contents.begin(), memory.contents.end()), Equals(contents));
+
+        // Failures are reported on flush()
+        fd_sink closed(fd);
+        dump_buffer out(&closed);
+        out.put("lost");
+        errno = 0;
+        Assert::That(out.flush(), IsFalse());
+        Assert::That(errno, Equals(EBADF));
+    }
+};
+
+#endif
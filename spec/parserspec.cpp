@@ -1,54 +1,32 @@
 #ifndef _PARSERSPEC_H
 #define _PARSERSPEC_H
 
+#include "dump.hpp"
 #include "error.hpp"
 #include "parser.hpp"
 #include "tokenize.hpp"
 #include "igloo/igloo.h"
 
+#include <cstdlib>
 #include <cstring>
-#include <unistd.h>
+#include <string>
+#include <thread>
 #include <vector>
 
 
 using namespace igloo;
 
-static int dump_syntax_tree(FILE *fp, syntax_tree_node *node, int indentation)
+static char *dump_syntax_tree_to_buffer(const token_stream &tokens, syntax_tree_node *root)
 {
-    int ret = fprintf(fp, "%*s%s", indentation, "", parser_type_names[node->type]);
-
-    if (node->type != syntax_tree_node::TOKEN)
-    {
-        fputc('\n', fp);
-        ret++;
-    }
-    else
+    memory_sink sink;
     {
-        ret += fprintf(fp, ": ");
-        ret += dump_token(fp, node->ass_token, 0);
+        dump_buffer out(&sink);
+        dump_syntax_tree(&out, tokens, root, true);
     }
 
-    for (syntax_tree_node *c: node->children)
-        ret += dump_syntax_tree(fp, c, indentation + 2);
-
-    return ret;
-}
-
-static char *dump_syntax_tree_to_buffer(syntax_tree_node *root)
-{
-    int fds[2];
-    pipe(fds);
-
-    FILE *ifp = fdopen(fds[1], "w");
-    int sz = dump_syntax_tree(ifp, root, 0);
-    fclose(ifp);
-
-    char *output = new char[sz + 1];
-    read(fds[0], output, sz);
-    output[sz] = 0;
-
-    close(fds[0]);
-    close(fds[1]);
+    char *output = new char[sink.contents.size() + 1];
+    memcpy(output, sink.contents.data(), sink.contents.size());
+    output[sink.contents.size()] = 0;
 
     return output;
 }
@@ -60,7 +38,8 @@ Describe(parser)
     {
         try
         {
-            std::vector<token *> token_list = tokenize(
+            arena tu_arena;
+            token_stream token_list = tokenize(
                 "extern int printf(const char *format, ...);\n"
                 "class b;\n"
                 "class c\n"
@@ -85,11 +64,8 @@ Describe(parser)
                 "}\n"
             );
 
-            syntax_tree_node *root = build_syntax_tree(token_list);
-            char *output = dump_syntax_tree_to_buffer(root);
-            delete root;
-            for (token *t: token_list)
-                delete t;
+            syntax_tree_node *root = build_syntax_tree(token_list, &tu_arena);
+            char *output = dump_syntax_tree_to_buffer(token_list, root);
 
             Assert::That(output, Equals(
 #include "parserspec-ex1-compare.h"
@@ -110,7 +86,8 @@ Describe(parser)
     {
         try
         {
-            std::vector<token *> token_list = tokenize(
+            arena tu_arena;
+            token_stream token_list = tokenize(
                 "template<typename T> struct foo\n"
                 "{\n"
                 "    private:\n"
@@ -119,11 +96,8 @@ Describe(parser)
                 "foo<int> baz;\n"
             );
 
-            syntax_tree_node *root = build_syntax_tree(token_list);
-            char *output = dump_syntax_tree_to_buffer(root);
-            delete root;
-            for (token *t: token_list)
-                delete t;
+            syntax_tree_node *root = build_syntax_tree(token_list, &tu_arena);
+            char *output = dump_syntax_tree_to_buffer(token_list, root);
 
             Assert::That(output, Equals(
 #include "parserspec-ex2-compare.h"
@@ -144,7 +118,8 @@ Describe(parser)
     {
         try
         {
-            std::vector<token *> token_list = tokenize(
+            arena tu_arena;
+            token_stream token_list = tokenize(
                 "template<typename T> class a\n"
                 "{\n"
                 "};\n"
@@ -159,11 +134,8 @@ Describe(parser)
                 "}\n"
             );
 
-            syntax_tree_node *root = build_syntax_tree(token_list);
-            char *output = dump_syntax_tree_to_buffer(root);
-            delete root;
-            for (token *t: token_list)
-                delete t;
+            syntax_tree_node *root = build_syntax_tree(token_list, &tu_arena);
+            char *output = dump_syntax_tree_to_buffer(token_list, root);
 
             Assert::That(output, Equals(
 #include "parserspec-ex3-compare.h"
@@ -184,18 +156,16 @@ Describe(parser)
     {
         try
         {
-            std::vector<token *> token_list = tokenize(
+            arena tu_arena;
+            token_stream token_list = tokenize(
                 "template<bool B, class T = void>\n"
                 "struct enable_if {};\n"
                 "template<class T>\n"
                 "struct enable_if<true, T> { typedef T type; };\n"
             );
 
-            syntax_tree_node *root = build_syntax_tree(token_list);
-            char *output = dump_syntax_tree_to_buffer(root);
-            delete root;
-            for (token *t: token_list)
-                delete t;
+            syntax_tree_node *root = build_syntax_tree(token_list, &tu_arena);
+            char *output = dump_syntax_tree_to_buffer(token_list, root);
 
             Assert::That(output, Equals(
 #include "parserspec-ex4-compare.h"
@@ -216,7 +186,8 @@ Describe(parser)
     {
         try
         {
-            std::vector<token *> token_list = tokenize(
+            arena tu_arena;
+            token_stream token_list = tokenize(
                 "namespace foo\n"
                 "{\n"
                 "    class bar\n"
@@ -231,11 +202,8 @@ Describe(parser)
                 "foo::bar::baz *x;\n"
             );
 
-            syntax_tree_node *root = build_syntax_tree(token_list);
-            char *output = dump_syntax_tree_to_buffer(root);
-            delete root;
-            for (token *t: token_list)
-                delete t;
+            syntax_tree_node *root = build_syntax_tree(token_list, &tu_arena);
+            char *output = dump_syntax_tree_to_buffer(token_list, root);
 
             Assert::That(output, Equals(
 #include "parserspec-ex5-compare.h"
@@ -250,6 +218,217 @@ Describe(parser)
             delete err;
         }
     }
+
+
+    Spec(streamed_tokens)
+    {
+        // Enough tokens for the parser to pull several batches
+        std::string src;
+        for (int i = 0; i < 40; i++)
+        {
+            std::string n = std::to_string(i);
+            src += "template<typename T> struct s" + n + " { T v; };\n"
+                   "int f" + n + "(s" + n + "<int> a) { return a.v >> " + n + "; }\n";
+        }
+
+        arena tu_arena;
+        token_stream token_list = tokenize(src.c_str());
+        char *expected = dump_syntax_tree_to_buffer(token_list, build_syntax_tree(token_list, &tu_arena));
+
+        token_source source(src.c_str());
+        char *output = dump_syntax_tree_to_buffer(source.tokens, build_syntax_tree(source, &tu_arena));
+        Assert::That(source.tokens.size(), Equals(token_list.size()));
+        Assert::That(std::string(output), Equals(expected));
+        delete[] output;
+
+        token_source pipelined(src.c_str());
+        pipelined.run_pipelined();
+        output = dump_syntax_tree_to_buffer(pipelined.tokens, build_syntax_tree(pipelined, &tu_arena));
+        Assert::That(std::string(output), Equals(expected));
+        delete[] output;
+
+        delete[] expected;
+
+        // An invalid character is reported instead of an earlier syntax
+        // error, just like when tokenizing first
+        token_source broken("int a = ;\nint b;\n$");
+        try
+        {
+            build_syntax_tree(broken, &tu_arena);
+            Assert::Failure("Error not detected");
+        }
+        catch (error *err)
+        {
+            Assert::That(err->line, Equals(3));
+            Assert::That(err->msg, Equals("Could not parse character"));
+            delete err;
+        }
+    }
+
+
+    Spec(concurrent_parsing)
+    {
+        // Every thread parses its own translation units (introducing new
+        // atoms on the way); the results must not differ from parsing them
+        // one after another.
+        static const int THREADS = 4, RUNS = 20;
+
+        auto source = [](int thread, int run) {
+            std::string t = std::to_string(thread) + "_" + std::to_string(run);
+            return "namespace ns" + t + " { class c" + t + " { public: class d { }; }; }\n"
+                   "template<typename T> struct box" + t + " { T v; };\n"
+                   "typedef ns" + t + "::c" + t + "::d d" + t + ";\n"
+                   "box" + t + "<d" + t + " *> x" + t + ";\n"
+                   "int f" + t + "(int a) { d" + t + " y; return a >> 2; }\n";
+        };
+
+        std::vector<std::string> dumps[THREADS];
+        std::vector<std::thread> threads;
+
+        for (int t = 0; t < THREADS; t++)
+        {
+            threads.emplace_back([&, t]() {
+                for (int r = 0; r < RUNS; r++)
+                {
+                    std::string src = source(t, r);
+                    arena tu_arena;
+                    token_stream token_list = tokenize(src.c_str());
+                    syntax_tree_node *root = build_syntax_tree(token_list, &tu_arena);
+
+                    char *output = dump_syntax_tree_to_buffer(token_list, root);
+                    dumps[t].push_back(output);
+                    delete[] output;
+                }
+            });
+        }
+
+        for (std::thread &t: threads)
+            t.join();
+
+        for (int t = 0; t < THREADS; t++)
+        {
+            for (int r = 0; r < RUNS; r++)
+            {
+                std::string src = source(t, r);
+                arena tu_arena;
+                token_stream token_list = tokenize(src.c_str());
+                syntax_tree_node *root = build_syntax_tree(token_list, &tu_arena);
+
+                char *output = dump_syntax_tree_to_buffer(token_list, root);
+                Assert::That(dumps[t][r], Equals(output));
+                delete[] output;
+            }
+        }
+    }
+
+
+    Spec(right_shifts)
+    {
+        arena tu_arena;
+        token_stream token_list = tokenize("int a, b;\nint c = a >> b;\nvoid f() { a >>= b; }\n");
+        syntax_tree_node *root = build_syntax_tree(token_list, &tu_arena);
+
+        // The driver dumps the tokens after parsing; they must still be the
+        // tokenizer's
+        memory_sink sink;
+        {
+            dump_buffer out(&sink);
+            for (token_index tok = 9; tok < 11; tok++)
+                dump_token(&out, token_list, tok, 16);
+            for (token_index tok = 19; tok < 21; tok++)
+                dump_token(&out, token_list, tok, 16);
+        }
+        Assert::That(std::string(sink.contents.begin(), sink.contents.end()), Equals(
+            "Operator:        >\n"
+            "Operator:        >\n"
+            "Operator:        >\n"
+            "Operator:        >=\n"));
+
+        // Whereas the tree has the merged operators
+        char *output = dump_syntax_tree_to_buffer(token_list, root);
+        std::string tree(output);
+        delete[] output;
+
+        Assert::That(tree.find("token: Operator: ( 2:11) >>\n"), !Equals(std::string::npos));
+        Assert::That(tree.find("token: Operator: ( 3:14) >>=\n"), !Equals(std::string::npos));
+        Assert::That(tree.find("token: Operator: ( 2:12)"), Equals(std::string::npos));
+        Assert::That(tree.find("token: Operator: ( 3:15)"), Equals(std::string::npos));
+    }
+
+
+    Spec(unresolvable_scopes)
+    {
+        // A declaration outside of any scope block, at line 2, column 3
+        arena tu_arena;
+        token_stream token_list = tokenize("\n  int a;");
+        syntax_tree_node *decl = new (&tu_arena) syntax_tree_node(syntax_tree_node::SIMPLE_DECLARATION);
+        (new (&tu_arena) syntax_tree_node(syntax_tree_node::TOKEN, decl))->ass_token = 0;
+
+        try
+        {
+            decl->scope(token_list);
+            Assert::Failure("Error not detected");
+        }
+        catch (error *err)
+        {
+            Assert::That(err->line, Equals(2));
+            Assert::That(err->column, Equals(3));
+            Assert::That(err->msg, Equals("Could not resolve scope of a simple-declaration node"));
+            delete err;
+        }
+    }
+
+
+    Spec(rule_profiles)
+    {
+        // Only parsers generated with --profile count anything
+        if (!parser_profiling())
+        {
+            Assert::That(parse_profile().empty(), IsTrue());
+            return;
+        }
+
+        // Counters of one rule (all zero if it has not been entered)
+        auto counters = [](const std::vector<rule_profile> &rules, syntax_tree_node::sv_type rule) {
+            for (const rule_profile &rp: rules)
+                if (rp.rule == rule)
+                    return rp;
+            return rule_profile {rule, 0, 0, 0, 0, 0, 0, 0, 0, {}, {}};
+        };
+
+        std::vector<rule_profile> before = parse_profile();
+
+        arena tu_arena;
+        token_stream token_list = tokenize("int a; int b;");
+        build_syntax_tree(token_list, &tu_arena);
+
+        std::vector<rule_profile> after = parse_profile();
+
+        rule_profile tu0 = counters(before, syntax_tree_node::TRANSLATION_UNIT);
+        rule_profile tu1 = counters(after, syntax_tree_node::TRANSLATION_UNIT);
+        Assert::That(tu1.entries - tu0.entries, Equals(1u));
+        Assert::That(tu1.successes - tu0.successes, Equals(1u));
+        Assert::That(tu1.tokens - tu0.tokens, Equals(6u));
+
+        rule_profile decl0 = counters(before, syntax_tree_node::DECLARATION);
+        rule_profile decl1 = counters(after, syntax_tree_node::DECLARATION);
+        Assert::That(decl1.successes - decl0.successes, Equals(2u));
+
+        for (const rule_profile &rp: after)
+        {
+            Assert::That(rp.successes + rp.failures, Equals(rp.entries));
+            Assert::That(rp.discarded, IsLessThan(rp.nodes + 1));
+            Assert::That(rp.exclusive, IsLessThan(rp.inclusive + 1));
+
+            uint64_t matches = 0;
+            for (size_t a = 0; a < rp.attempts.size(); a++)
+            {
+                Assert::That(rp.matches[a], IsLessThan(rp.attempts[a] + 1));
+                matches += rp.matches[a];
+            }
+            Assert::That(matches, IsLessThan(rp.successes + 1));
+        }
+    }
 };
 
 #endif
@@ -0,0 +1,152 @@
+#ifndef _PREFIXFILESPEC_H
+#define _PREFIXFILESPEC_H
+
+#include "dump.hpp"
+#include "error.hpp"
+#include "parser.hpp"
+#include "prefix_file.hpp"
+#include "preprocess.hpp"
+#include "tokenize.hpp"
+#include "igloo/igloo.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unistd.h>
+
+
+using namespace igloo;
+
+// The dump of a syntax tree, without token positions
+static std::string tree_text(const token_stream &tokens, const syntax_tree_node *root)
+{
+    memory_sink sink;
+    {
+        dump_buffer out(&sink);
+        dump_syntax_tree(&out, tokens, root, false);
+    }
+
+    return std::string(sink.contents.begin(), sink.contents.end());
+}
+
+
+Describe(prefix_files)
+{
+    Spec(round_trip)
+    {
+        std::string header =
+            "namespace n { class c { public: int v; }; template<typename T> class box { T v; }; }\n"
+            "typedef n::c t;\n"
+            "float f = 1.5f; long l = 42L;\n";
+        const char *unit = "t x; n::box<n::box<t>> b; double d = 2.5; int i = 7 >> 1;\n";
+
+        // What parsing the header and the unit at once makes of them
+        arena tu_arena;
+        std::string whole = header + "\n" + unit;
+        token_stream direct = tokenize(whole.c_str());
+        std::string expected = tree_text(direct, build_syntax_tree(direct, &tu_arena));
+
+        token_stream header_tokens = tokenize(header.c_str());
+        parse_prefix prefix;
+        build_prefix(header_tokens, &tu_arena, &prefix);
+        Assert::That(prefix.end, Equals(header_tokens.size()));
+
+        std::string path;
+        int fd = temporary_file(&path);
+        Assert::That(write_prefix_file(fd, "header.hpp", header_tokens, prefix, "#define X 1\n"), IsTrue());
+        close(fd);
+
+        prefix_file pf;
+        Assert::That(pf.load(path.c_str()), IsTrue());
+        unlink(path.c_str());
+
+        Assert::That(std::string(pf.source()), Equals(header));
+        Assert::That(std::string(pf.definitions()), Equals("#define X 1\n"));
+
+        // Any number of units can start from the snapshot
+        token_stream unit_tokens = tokenize(unit);
+        for (int run = 0; run < 2; run++)
+        {
+            prefixed_unit pu;
+            pf.start_unit("unit.cpp", unit_tokens, &tu_arena, &pu);
+            Assert::That(pu.tokens.size(), Equals(direct.size()));
+            Assert::That(std::string(pu.tokens.source), Equals(whole));
+
+            syntax_tree_node *root = build_syntax_tree(pu.tokens, &tu_arena, &pu.prefix);
+            Assert::That(tree_text(pu.tokens, root), Equals(expected));
+
+            // Tokens keep their files and positions
+            token_index last = pu.tokens.size() - 1;
+            Assert::That(std::string(pu.tokens.file(0)->name), Equals("header.hpp"));
+            Assert::That(pu.tokens.line(header_tokens.size() - 1), Equals(3));
+            Assert::That(std::string(pu.tokens.file(last)->name), Equals("unit.cpp"));
+            Assert::That(pu.tokens.line(last), Equals(1));
+            Assert::That(pu.tokens.column(last), Equals(57));
+        }
+    }
+
+
+    Spec(macros)
+    {
+        include_cache cache;
+        pp_options options;
+        preprocessor pp(&cache, &options);
+        pp.run("header.hpp", "#define MAX(a, ...) ((a) > (__VA_ARGS__))\n#define SHIFT 1 >> 2\n#define GONE\n#undef GONE\n");
+
+        std::string defs = pp.macro_definitions();
+        Assert::That(defs.find("#define MAX(a, ...) ((a) > (__VA_ARGS__))\n"), !Equals(std::string::npos));
+        Assert::That(defs.find("#define SHIFT 1 >> 2\n"), !Equals(std::string::npos));
+        Assert::That(defs.find("GONE"), Equals(std::string::npos));
+
+        // Which are the macros of a unit starting with them
+        options.definitions = defs;
+        preprocessor unit(&cache, &options);
+        unit.run("unit.cpp", "#if SHIFT == 0\nMAX(1, 2)\n#endif\n");
+        Assert::That(spellings(unit.tokens), Equals("( ( 1 ) > ( 2 ) )"));
+    }
+
+
+    Spec(invalid_prefixes)
+    {
+        arena tu_arena;
+        token_stream tokens = tokenize("int a; int b");
+        parse_prefix prefix;
+
+        try
+        {
+            build_prefix(tokens, &tu_arena, &prefix);
+            Assert::That(false, IsTrue());
+        }
+        catch (error *err)
+        {
+            Assert::That(std::string(err->msg), Equals("Prefix ends within the declaration starting at int"));
+            Assert::That(err->column, Equals(8));
+            delete err;
+        }
+
+        errno = 0;
+        prefix_file pf;
+        Assert::That(pf.load("/nonexistent/file.pfx"), IsFalse());
+        Assert::That(errno, Equals(ENOENT));
+
+        std::string path = temporary_file("int a;\n");
+        Assert::That(pf.load(path.c_str()), IsFalse());
+        Assert::That(errno, Equals(EINVAL));
+        unlink(path.c_str());
+
+        // Written by a parser with other node kinds
+        prefix_file_header h;
+        memset(&h, 0, sizeof(h));
+        memcpy(h.magic, "PEGIPFX", 8);
+        h.version = PREFIX_FILE_VERSION;
+        h.grammar = 0;
+
+        path = temporary_file(std::string(reinterpret_cast<const char *>(&h), sizeof(h)));
+        Assert::That(pf.load(path.c_str()), IsFalse());
+        Assert::That(errno, Equals(EINVAL));
+        unlink(path.c_str());
+    }
+};
+
+#endif
@@ -0,0 +1,195 @@
+#ifndef _PREPROCESSSPEC_H
+#define _PREPROCESSSPEC_H
+
+#include "error.hpp"
+#include "preprocess.hpp"
+#include "igloo/igloo.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unistd.h>
+
+
+using namespace igloo;
+
+// The spellings of all tokens, separated by spaces
+static std::string spellings(const token_stream &tokens)
+{
+    std::string s;
+    for (token_index i = 0; i < tokens.size(); i++)
+    {
+        if (i)
+            s += ' ';
+        s.append(tokens.spelling(i).start, tokens.spelling(i).length);
+    }
+    return s;
+}
+
+
+static std::string preprocess(const char *text, const pp_options &options = pp_options())
+{
+    include_cache cache;
+    preprocessor pp(&cache, &options);
+    pp.run("input.cpp", text);
+    return spellings(pp.tokens);
+}
+
+
+// Runs the preprocessor on text, expecting it to fail; returns the message
+static std::string preprocess_error(const char *text)
+{
+    include_cache cache;
+    pp_options options;
+    preprocessor pp(&cache, &options);
+
+    try
+    {
+        pp.run("input.cpp", text);
+    }
+    catch (error *err)
+    {
+        std::string msg = err->msg;
+        delete err;
+        return msg;
+    }
+
+    return "(no error)";
+}
+
+
+Describe(preprocessing)
+{
+    Spec(macros)
+    {
+        Assert::That(preprocess("#define A 1 + A\nint x = A;"), Equals("int x = 1 + A ;"));
+        Assert::That(preprocess("#define F(a, b) (a * b)\nF(1 + 2, F(3, 4)) F"), Equals("( 1 + 2 * ( 3 * 4 ) ) F"));
+        Assert::That(preprocess("#define S(x) #x\nS( a  \"b\\n\"  'c' )"), Equals("\"a \\\"b\\\\n\\\" 'c'\""));
+        Assert::That(preprocess("#define C(a, b) a ## b\nC(x, y) C(, z) C(1, 2)"), Equals("xy z 12"));
+        Assert::That(preprocess("#define V(f, ...) f(__VA_ARGS__) g(0, ## __VA_ARGS__)\nV(h) V(h, 1, 2)"),
+                     Equals("h ( ) g ( 0 ) h ( 1 , 2 ) g ( 0 , 1 , 2 )"));
+
+        // ## pastes in object-like macros as well, where # is just a token
+        Assert::That(preprocess("#define OP + ## +\n#define H # x\nOP H"), Equals("++ # x"));
+        Assert::That(preprocess("#define hash_hash # ## #\n#define mkstr(a) # a\n#define in_between(a) mkstr(a)\n"
+                                "#define join(c, d) in_between(c hash_hash d)\nchar p[] = join(x, y);"),
+                     Equals("char p [ ] = \"x ## y\" ;"));
+
+        // Function-like macros are only expanded when invoked
+        Assert::That(preprocess("#define F() 1\n#define G (2)\nF F() G"), Equals("F 1 ( 2 )"));
+        Assert::That(preprocess("#define F(x) x\n#define G F(G)\nG #undef"), Equals("G # undef"));
+        Assert::That(preprocess("#define F(x) x\n#undef F\nF(1)"), Equals("F ( 1 )"));
+
+        pp_options options;
+        options.definitions = "#define X 42\n#define Y\n#undef Y\n";
+        Assert::That(preprocess("X Y", options), Equals("42 Y"));
+    }
+
+
+    Spec(conditionals)
+    {
+        Assert::That(preprocess("#if 1 + 2 * 3 == 7 && (1 << 4) >> 2 == 4 && -1 < 0 && !(-1 < 0u)\nyes\n#else\nno\n#endif"),
+                     Equals("yes"));
+        Assert::That(preprocess("#define A\n#if defined A && defined(A) && !defined B\nyes\n#endif"), Equals("yes"));
+        Assert::That(preprocess("#if 0\n#if 1\nno\n#else\nno\n#endif\n#elif 0 ? 1 / 0 : 2\nyes\n#else\nno\n#endif"), Equals("yes"));
+        Assert::That(preprocess("#ifdef __cplusplus\n#ifndef UNDEFINED\nyes\n#endif\n#endif"), Equals("yes"));
+        Assert::That(preprocess("#if 1 || 1 / 0\nyes\n#endif\n#if true && 'a' == 97 && undefined_name == 0\nyes\n#endif"),
+                     Equals("yes yes"));
+
+        // Skipped groups may hold any text
+        Assert::That(preprocess("#if 0\nThis doesn't work\n#endif\nyes"), Equals("yes"));
+        Assert::That(preprocess("#ifdef __OBJC__\n@interface Foo\n#else\nyes\n#endif"), Equals("yes"));
+        Assert::That(preprocess("#if 0\nsay \"hi\n#define X 'a\n#elif 1\nyes\n#endif"), Equals("yes"));
+    }
+
+
+    Spec(includes)
+    {
+        char dir[] = "/tmp/pegi-spec-XXXXXX";
+        Assert::That(mkdtemp(dir) != nullptr, IsTrue());
+        std::string d(dir);
+
+        write_file(d + "/guarded.h", "#ifndef GUARDED_H\n#define GUARDED_H\nint guarded;\n#endif\n");
+        write_file(d + "/once.h", "#pragma once\n#include \"guarded.h\"\nint once;\n");
+        write_file(d + "/broken.h", "int ok;\nint `;\n");
+
+        include_cache cache;
+        pp_options options;
+        options.include_paths.push_back(d);
+
+        std::string main_file = d + "/main.cpp";
+        const char *text = "#include <once.h>\n#include \"once.h\"\n#include \"guarded.h\"\nint main;\n";
+
+        for (int run = 0; run < 2; run++)
+        {
+            preprocessor pp(&cache, &options);
+            pp.run(main_file.c_str(), text);
+            Assert::That(spellings(pp.tokens), Equals("int guarded ; int once ; int main ;"));
+
+            // Every token knows its file
+            Assert::That(pp.tokens.file(0)->name, Equals(d + "/guarded.h"));
+            Assert::That(pp.tokens.line(0), Equals(3));
+            Assert::That(pp.tokens.file(6)->name, Equals(main_file));
+            Assert::That(pp.tokens.line(6), Equals(4));
+        }
+
+        // The second run has taken both headers from the cache, and both
+        // runs have skipped including guarded.h again right away
+        Assert::That(cache.misses.load(), Equals(2ul));
+        Assert::That(cache.hits.load(), Equals(4ul));
+        Assert::That(cache.elided.load(), Equals(2ul));
+
+        // Only guards around all of the file count
+        write_file(d + "/guard.h", "#if !defined(GUARD_H)\n#define GUARD_H\n#if 1\n#else\n#endif\nint g;\n#endif\n");
+        write_file(d + "/unguarded.h", "#ifndef UNGUARDED_H\n#define UNGUARDED_H\n#else\nint again;\n#endif\n");
+
+        {
+            preprocessor pp(&cache, &options);
+            pp.run(main_file.c_str(), "#include \"guard.h\"\n#include \"unguarded.h\"\n#include \"guard.h\"\n#include \"unguarded.h\"\n");
+            Assert::That(spellings(pp.tokens), Equals("int g ; int again ;"));
+            Assert::That(cache.elided.load(), Equals(3ul));
+        }
+
+        // Errors in headers are reported in their file
+        preprocessor pp(&cache, &options);
+        try
+        {
+            pp.run(main_file.c_str(), "#include \"broken.h\"\n");
+            Assert::That(false, IsTrue());
+        }
+        catch (error *err)
+        {
+            Assert::That(std::string(err->file), Equals(d + "/broken.h"));
+            Assert::That(err->line, Equals(2));
+            delete err;
+        }
+
+        unlink((d + "/guarded.h").c_str());
+        unlink((d + "/once.h").c_str());
+        unlink((d + "/broken.h").c_str());
+        unlink((d + "/guard.h").c_str());
+        unlink((d + "/unguarded.h").c_str());
+        rmdir(dir);
+    }
+
+
+    Spec(errors)
+    {
+        Assert::That(preprocess_error("#error stop \\\n here\n"), Equals("#error stop  here"));
+        Assert::That(preprocess_error("#if 1\n"), Equals("Unterminated conditional directive"));
+        Assert::That(preprocess_error("#endif\n"), Equals("#endif without #if"));
+        Assert::That(preprocess_error("#if 1\n#else\n#elif 1\n#endif\n"), Equals("#elif after #else"));
+        Assert::That(preprocess_error("#if 1 / 0\n#endif\n"), Equals("Division by zero in #if"));
+        Assert::That(preprocess_error("#define F(x) #y\n"), Equals("'#' is not followed by a macro parameter"));
+        Assert::That(preprocess_error("#define F(x) x\nF(1, 2)"), Equals("Macro F expects 1 arguments, but was given 2"));
+        Assert::That(preprocess_error("#include \"does-not-exist.h\"\n"), Equals("Could not find include file \"does-not-exist.h\""));
+        Assert::That(preprocess_error("#frobnicate\n"), Equals("Invalid preprocessing directive #frobnicate"));
+        Assert::That(preprocess_error("#if 0\n#line 1\n#endif\n#line 10 \"other.cpp\"\n"), Equals("#line is not supported"));
+        Assert::That(preprocess_error("#if 1\nThis doesn't work\n#endif\n"), Equals("End of character sequence expected"));
+        Assert::That(preprocess_error("#if 1\n#define X @\n#endif\n"), Equals("Could not parse character"));
+        Assert::That(preprocess_error("#if 0\n#elif 1 @\n#endif\n"), Equals("Could not parse character"));
+    }
+};
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef _SOURCEFILESPEC_H
+#define _SOURCEFILESPEC_H
+
+#include "source_file.hpp"
+#include "igloo/igloo.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+
+
+using namespace igloo;
+
+// Creates a new, empty temporary file; stores its path in *path and returns
+// a descriptor open for writing to it
+static int temporary_file(std::string *path)
+{
+    char name[] = "/tmp/pegi-spec-XXXXXX";
+    int fd = mkstemp(name);
+    *path = name;
+
+    return fd;
+}
+
+
+// Writes the given contents to a new temporary file and returns its path
+static std::string temporary_file(const std::string &contents)
+{
+    std::string path;
+    int fd = temporary_file(&path);
+    write(fd, contents.data(), contents.length());
+    close(fd);
+
+    return path;
+}
+
+
+// Creates (or replaces) the file at path with the given contents
+static void write_file(const std::string &path, const std::string &contents)
+{
+    FILE *fp = fopen(path.c_str(), "w");
+    fwrite(contents.data(), 1, contents.length(), fp);
+    fclose(fp);
+}
+
+
+Describe(source_file_loading)
+{
+    Spec(mapped_files)
+    {
+        // Sizes below, exactly at and above a page boundary; there must
+        // always be a null byte behind the contents
+        size_t page_size = sysconf(_SC_PAGESIZE);
+
+        for (size_t size: {static_cast<size_t>(0), static_cast<size_t>(100), page_size, 2 * page_size + 1})
+        {
+            std::string contents(size, 'x');
+            std::string path = temporary_file(contents);
+
+            source_file sf;
+            Assert::That(sf.load(path.c_str()), IsTrue());
+            Assert::That(sf.length(), Equals(size));
+            Assert::That(std::string(sf.text(), size), Equals(contents));
+            Assert::That(sf.text()[size], Equals('\0'));
+
+            unlink(path.c_str());
+        }
+    }
+
+
+    Spec(pipes)
+    {
+        // More than fits into the initial buffer
+        std::string contents;
+        for (int i = 0; contents.length() < 200000; i++)
+            contents += "int v" + std::to_string(i) + ";\n";
+
+        int fds[2];
+        pipe(fds);
+
+        pid_t writer = fork();
+        if (!writer)
+        {
+            close(fds[0]);
+            write(fds[1], contents.data(), contents.length());
+            _exit(0);
+        }
+        close(fds[1]);
+
+        source_file sf;
+        Assert::That(sf.load(fds[0]), IsTrue());
+        close(fds[0]);
+        waitpid(writer, nullptr, 0);
+
+        Assert::That(sf.length(), Equals(contents.length()));
+        Assert::That(sf.text(), Equals(contents));
+    }
+
+
+    Spec(missing_files)
+    {
+        source_file sf;
+        Assert::That(sf.load("/nonexistent/file.cpp"), IsFalse());
+        Assert::That(errno, Equals(ENOENT));
+    }
+};
+
+#endif
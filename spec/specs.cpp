@@ -1,6 +1,11 @@
 #include "igloo/igloo_alt.h"
 #include "tokenizerspec.cpp"
 #include "parserspec.cpp"
+#include "sourcefilespec.cpp"
+#include "astfilespec.cpp"
+#include "dumpspec.cpp"
+#include "preprocessspec.cpp"
+#include "prefixfilespec.cpp"
 
 
 using namespace igloo;
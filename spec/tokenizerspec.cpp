@@ -1,46 +1,29 @@
 #ifndef _TOKENIZERSPEC_H
 #define _TOKENIZERSPEC_H
 
+#include "dump.hpp"
 #include "error.hpp"
+#include "scan.hpp"
 #include "tokenize.hpp"
 #include "igloo/igloo.h"
 
+#include <cmath>
 #include <cstring>
+#include <string>
+#include <sys/mman.h>
 #include <unistd.h>
 #include <vector>
 
 
 using namespace igloo;
 
-static int dump_token(FILE *fp, token *tok, int spacing)
-{
-    switch (tok->type)
-    {
-        case token::IDENTIFIER:  return fprintf(fp, "%-*s (%2i:%2i) %s\n", spacing, "Identifier:", tok->line, tok->column, reinterpret_cast<identifier_token *>(tok)->value); break;
-        case token::LIT_BOOL:    return fprintf(fp, "%-*s (%2i:%2i) %s\n", spacing, "Bool literal:", tok->line, tok->column, reinterpret_cast<lit_bool_token *>(tok)->value ? "true" : "false"); break;
-        case token::LIT_FLOAT:   return fprintf(fp, "%-*s (%2i:%2i) %Lg\n", spacing, "Float literal:", tok->line, tok->column, reinterpret_cast<lit_float_token *>(tok)->value); break;
-        case token::LIT_INTEGER:
-            if (reinterpret_cast<lit_integer_token *>(tok)->type & lit_integer_token::UNSIGNED)
-                                 return fprintf(fp, "%-*s (%2i:%2i) %llu\n", spacing, "Integer literal:", tok->line, tok->column, reinterpret_cast<lit_integer_token *>(tok)->value.u);
-            else
-                                 return fprintf(fp, "%-*s (%2i:%2i) %lli\n", spacing, "Integer literal:", tok->line, tok->column, reinterpret_cast<lit_integer_token *>(tok)->value.s);
-            break;
-        case token::LIT_POINTER: return fprintf(fp, "%-*s (%2i:%2i) %p\n", spacing, "Pointer literal:", tok->line, tok->column, reinterpret_cast<lit_pointer_token *>(tok)->value); break;
-        case token::LIT_STRING:  return fprintf(fp, "%-*s (%2i:%2i) %s\n", spacing, "String literal:", tok->line, tok->column, tok->content); break;
-        case token::LIT_CHAR:    return fprintf(fp, "%-*s (%2i:%2i) %s (%u)\n", spacing, "Char literal:", tok->line, tok->column, tok->content, reinterpret_cast<lit_char_token *>(tok)->value); break;
-        case token::OPERATOR:    return fprintf(fp, "%-*s (%2i:%2i) %s\n", spacing, "Operator:", tok->line, tok->column, reinterpret_cast<operator_token *>(tok)->value); break;
-        default:                 return fprintf(fp, "Unknown token %2i: (%2i:%2i) %s\n", tok->type, tok->line, tok->column, tok->content);
-    }
-}
-
-
 Describe(tokenizer)
 {
     Spec(ex1)
     {
         try
         {
-            std::vector<token *> token_list = tokenize(
+            token_stream token_list = tokenize(
                 "extern int printf(const char *format, ...);\n"
                 "class b;\n"
                 "class c\n"
@@ -65,22 +48,13 @@ Describe(tokenizer)
                 "}\n"
             );
 
-            int fds[2];
-            pipe(fds);
-
-            int sz = 0;
-
-            FILE *ifp = fdopen(fds[1], "w");
-            for (auto tok: token_list)
-                sz += dump_token(ifp, tok, 16);
-            fclose(ifp);
-
-            char *output = new char[sz + 1];
-            read(fds[0], output, sz);
-            output[sz] = 0;
-
-            close(fds[0]);
-            close(fds[1]);
+            memory_sink sink;
+            {
+                dump_buffer out(&sink);
+                for (token_index tok = 0; tok < token_list.size(); tok++)
+                    dump_token(&out, token_list, tok, 16, true);
+            }
+            std::string output(sink.contents.begin(), sink.contents.end());
 
 
             Assert::That(output, Equals(
@@ -180,8 +154,6 @@ Describe(tokenizer)
                 "Operator:        (21:13) ;\n"
                 "Operator:        (22: 1) }\n"
             ));
-
-            delete[] output;
         }
         catch (error *err)
         {
@@ -190,6 +162,293 @@ Describe(tokenizer)
             delete err;
         }
     }
+
+    Spec(string_literals)
+    {
+        const char *source = "\"a\\tb\\x41\\\"\" \"\" \"\\0\"";
+        token_stream token_list = tokenize(source);
+
+        Assert::That(token_list.size(), Equals(3u));
+
+        // Tokens refer to the source instead of copying their spelling
+        Assert::That(token_list.spelling(0).start, Equals(source));
+        Assert::That(token_list.spelling(0).length, Equals(12u));
+
+        char value[5];
+        Assert::That(token_list.string_length(0), Equals(5u));
+        token_list.decode_string(0, value);
+        Assert::That(std::string(value, 5), Equals("a\tbA\""));
+        Assert::That(token_list.string_is(0, "a\tbA\""), IsTrue());
+        Assert::That(token_list.string_is(0, "a\tbA"), IsFalse());
+
+        Assert::That(token_list.string_is(1, ""), IsTrue());
+        Assert::That(token_list.string_is(2, ""), IsFalse());
+    }
+
+    Spec(lazy_literals)
+    {
+        token_stream token_list = tokenize("42u 0x10 1.5f 'a' '\\n'");
+
+        Assert::That(token_list.integers[0].decoded, IsFalse());
+        Assert::That(token_list.integer_value(0).subtype, Equals(lit_integer::UNSIGNED_INT));
+        Assert::That(token_list.integer_value(0).value.u, Equals(42u));
+        Assert::That(token_list.integers[0].decoded, IsTrue());
+        Assert::That(token_list.integer_value(1).value.s, Equals(16));
+
+        Assert::That(token_list.floats[0].decoded, IsFalse());
+        Assert::That(token_list.float_value(2).subtype, Equals(lit_float::FLOAT));
+        Assert::That(token_list.float_value(2).value, Equals(1.5L));
+        Assert::That(token_list.floats[0].decoded, IsTrue());
+
+        Assert::That(token_list.char_value(3), Equals(static_cast<unsigned>('a')));
+        Assert::That(token_list.char_value(4), Equals(static_cast<unsigned>('\n')));
+
+        // Literals which may be too big are still checked while tokenizing
+        try
+        {
+            tokenize("int a;\nint x = 0x123456789abcdef01234u;\n");
+            Assert::Failure("Overflow not detected");
+        }
+        catch (error *err)
+        {
+            Assert::That(err->line, Equals(2));
+            Assert::That(err->column, Equals(32));
+            Assert::That(err->msg, Equals("Unsigned integer literal is too big"));
+            delete err;
+        }
+    }
+
+    Spec(integer_literals)
+    {
+        token_stream token_list = tokenize(
+            "2147483647 2147483648 0x7fffffff 0x80000000 0xffffffffffffffff 5l 5LU 5ll "
+            "0x7fffffffffffffffl 01234567012345670123U 1234567890123456789ull");
+
+        // Table 6: decimal literals stay signed, others may become unsigned
+        Assert::That(token_list.integer_value(0).subtype, Equals(lit_integer::SIGNED_INT));
+        Assert::That(token_list.integer_value(1).subtype, Equals(lit_integer::SIGNED_LONG));
+        Assert::That(token_list.integer_value(2).subtype, Equals(lit_integer::SIGNED_INT));
+        Assert::That(token_list.integer_value(3).subtype, Equals(lit_integer::UNSIGNED_INT));
+        Assert::That(token_list.integer_value(4).subtype, Equals(lit_integer::UNSIGNED_LONG));
+        Assert::That(token_list.integer_value(4).value.u, Equals(0xffffffffffffffffull));
+        Assert::That(token_list.integer_value(5).subtype, Equals(lit_integer::SIGNED_LONG));
+        Assert::That(token_list.integer_value(6).subtype, Equals(lit_integer::UNSIGNED_LONG));
+        Assert::That(token_list.integer_value(7).subtype, Equals(lit_integer::SIGNED_LONG_LONG));
+        Assert::That(token_list.integer_value(8).subtype, Equals(lit_integer::SIGNED_LONG));
+        Assert::That(token_list.integer_value(9).value.u, Equals(01234567012345670123ull));
+        Assert::That(token_list.integer_value(10).value.u, Equals(1234567890123456789ull));
+
+        try
+        {
+            tokenize("9223372036854775808");
+            Assert::Failure("Overflow not detected");
+        }
+        catch (error *err)
+        {
+            Assert::That(err->msg, Equals("Signed decimal integer literal is too big"));
+            delete err;
+        }
+    }
+
+
+    Spec(float_literals)
+    {
+        token_stream token_list = tokenize(
+            "0.1 0.1f 1e23 9007199254740993.0 0x1.8p3 4.9e-324 1e400 "
+            "0.1000000000000000055511151231257827021181583404541015625 "
+            "123456789012345678901234567890.0 0.0 1.5L");
+
+        // Must be correctly rounded to the literal's own type
+        Assert::That(token_list.float_value(0).value, Equals(static_cast<long double>(0.1)));
+        Assert::That(token_list.float_value(1).value, Equals(static_cast<long double>(0.1f)));
+        Assert::That(token_list.float_value(2).value, Equals(static_cast<long double>(1e23)));
+        // Exactly halfway between two doubles: round to even
+        Assert::That(token_list.float_value(3).value, Equals(9007199254740992.0L));
+        Assert::That(token_list.float_value(4).value, Equals(12.0L));
+        Assert::That(token_list.float_value(5).value, Equals(static_cast<long double>(4.9e-324)));
+        Assert::That(token_list.float_value(6).value, Equals(static_cast<long double>(HUGE_VAL)));
+        Assert::That(token_list.float_value(7).value, Equals(static_cast<long double>(0.1)));
+        Assert::That(token_list.float_value(8).value, Equals(static_cast<long double>(123456789012345678901234567890.0)));
+        Assert::That(token_list.float_value(9).value, Equals(0.0L));
+        Assert::That(token_list.float_value(10).value, Equals(1.5L));
+    }
+
+
+    Spec(token_source_pulling)
+    {
+        const char *source = "int a = 1;\n/* comment */ a += 0x10; @";
+        token_source tokens(source);
+
+        // Nothing is tokenized before it is asked for
+        Assert::That(tokens.tokens.size(), Equals(0u));
+
+        Assert::That(tokens.fill(3), IsTrue());
+        Assert::That(tokens.tokens.size(), Equals(4u));
+        Assert::That(tokens.tokens.spelling(3) == "1", IsTrue());
+
+        // Tokens asked for before are still there
+        Assert::That(tokens.fill(1), IsTrue());
+        Assert::That(tokens.tokens.size(), Equals(4u));
+
+        // Same positions as when tokenizing in one go
+        Assert::That(tokens.fill(8), IsTrue());
+        Assert::That(tokens.tokens.line(5), Equals(2));
+        Assert::That(tokens.tokens.column(5), Equals(15));
+        Assert::That(tokens.tokens.integer_value(7).value.s, Equals(16));
+
+        // Errors come up once the tokenizer gets there, and again when asked
+        // for more
+        for (int attempt = 0; attempt < 2; attempt++)
+        {
+            try
+            {
+                tokens.drain();
+                Assert::Failure("Invalid character not detected");
+            }
+            catch (error *err)
+            {
+                Assert::That(err->line, Equals(2));
+                Assert::That(err->column, Equals(26));
+                delete err;
+            }
+
+            Assert::That(tokens.tokens.size(), Equals(9u));
+            Assert::That(tokens.exhausted(), IsFalse());
+        }
+
+        token_source complete("a b  /* trailing */ ");
+        Assert::That(complete.fill(2), IsFalse());
+        Assert::That(complete.exhausted(), IsTrue());
+        Assert::That(complete.tokens.size(), Equals(2u));
+    }
+
+
+    Spec(pipelined_token_source)
+    {
+        // Several batches' worth of literals (whose value tables get merged)
+        // and lines crossing batch boundaries
+        std::string source;
+        for (int i = 0; i < 5000; i++)
+            source += "x" + std::to_string(i) + " = " + std::to_string(i) + " + " + std::to_string(i) + ".5f" +
+                      ((i % 3) ? "; " : ";\n");
+
+        token_stream expected = tokenize(source.c_str());
+        token_source tokens(source.c_str());
+
+        // Switching over halfway through a line
+        Assert::That(tokens.fill(2), IsTrue());
+        tokens.run_pipelined();
+        tokens.drain();
+
+        Assert::That(tokens.exhausted(), IsTrue());
+        Assert::That(tokens.tokens.size(), Equals(expected.size()));
+        for (token_index tok = 0; tok < expected.size(); tok++)
+        {
+            Assert::That(tokens.tokens.type(tok), Equals(expected.type(tok)));
+            Assert::That(tokens.tokens.line(tok), Equals(expected.line(tok)));
+            Assert::That(tokens.tokens.column(tok), Equals(expected.column(tok)));
+
+            if (expected.type(tok) == token::LIT_INTEGER)
+                Assert::That(tokens.tokens.integer_value(tok).value.s, Equals(expected.integer_value(tok).value.s));
+            else if (expected.type(tok) == token::LIT_FLOAT)
+                Assert::That(tokens.tokens.float_value(tok).value, Equals(expected.float_value(tok).value));
+            else
+                Assert::That(tokens.tokens.atom(tok), Equals(expected.atom(tok)));
+        }
+
+        // Errors come up once the consumer gets there
+        std::string broken_source = source + "@";
+        token_source broken(broken_source.c_str());
+        broken.run_pipelined();
+        Assert::That(broken.fill(static_cast<token_index>(expected.size() - 1)), IsTrue());
+        for (int attempt = 0; attempt < 2; attempt++)
+        {
+            try
+            {
+                broken.fill(static_cast<token_index>(expected.size()));
+                Assert::Failure("Invalid character not detected");
+            }
+            catch (error *err)
+            {
+                Assert::That(err->line, Equals(expected.line(static_cast<token_index>(expected.size() - 1))));
+                delete err;
+            }
+        }
+
+        // Giving up early must stop the thread
+        token_source abandoned(source.c_str());
+        abandoned.run_pipelined();
+        Assert::That(abandoned.fill(0), IsTrue());
+    }
+
+
+    Spec(all_scan_kernels)
+    {
+        // Comments and strings crossing vector boundaries, at every alignment
+        std::string chunk =
+            "a_very_long_identifier_of_more_than_thirty_two_characters0123 x\n"
+            "        \t\t  \r\n\n  /* comment * / ** \n spanning\n\n lines **/ y\n"
+            "z/*/ w // line comment with \"quotes\" \\ and */\n"
+            "\"a string with an \\\" escaped quote and a \\\\ backslash, long enough\" \"\"\n"
+            "/**/ q /***/ r /* *\n/ */ s\n";
+
+        for (int shift = 0; shift < 64; shift++)
+        {
+            std::string source = std::string(shift, ' ') + chunk + chunk + "/* unterminated";
+            std::string reference;
+            const scan_kernels *previous = scan;
+
+            for (const scan_kernels *const *k = supported_scan_kernels(); *k; k++)
+            {
+                scan = *k;
+                token_stream token_list = tokenize(source.c_str());
+                scan = previous;
+
+                std::string dump;
+                for (token_index tok = 0; tok < token_list.size(); tok++)
+                {
+                    source_text spelling = token_list.spelling(tok);
+                    dump += std::to_string(token_list.type(tok)) + " " + std::to_string(token_list.line(tok)) + ":" +
+                            std::to_string(token_list.column(tok)) + " " + std::string(spelling.start, spelling.length) + "\n";
+                }
+
+                if (k == supported_scan_kernels())
+                    reference = dump;
+                else
+                    Assert::That(dump, Equals(reference));
+            }
+        }
+
+        // Nothing behind the terminating null byte may be read: end the input
+        // right before an inaccessible page
+        size_t page_size = sysconf(_SC_PAGESIZE);
+        char *pages = static_cast<char *>(mmap(nullptr, 2 * page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+        mprotect(pages + page_size, page_size, PROT_NONE);
+
+        for (const char *tail: {"x /* a comment ending at the end of the input */", "\"a string ending there\"",
+                                "// a line comment ending there", "/* an unterminated comment"})
+        {
+            for (const scan_kernels *const *k = supported_scan_kernels(); *k; k++)
+            {
+                char *source = pages + page_size - strlen(tail) - 1;
+                strcpy(source, tail);
+
+                const scan_kernels *previous = scan;
+                scan = *k;
+                try
+                {
+                    tokenize(source);
+                }
+                catch (error *err)
+                {
+                    delete err;
+                }
+                scan = previous;
+            }
+        }
+
+        munmap(pages, 2 * page_size);
+    }
 };
 
 #endif
@@ -0,0 +1,96 @@
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include "arena.hpp"
+
+
+arena::arena(size_t cs):
+    current(0),
+    offset(0),
+    chunk_size(cs)
+{}
+
+
+arena::~arena(void)
+{
+    for (const chunk &c: chunks)
+        free(c.base);
+}
+
+
+void *arena::alloc(size_t size, size_t alignment)
+{
+    for (;;)
+    {
+        if (current < chunks.size())
+        {
+            const chunk &c = chunks[current];
+            uintptr_t addr = reinterpret_cast<uintptr_t>(c.base) + offset;
+            size_t padding = (alignment - addr % alignment) % alignment;
+
+            if (offset + padding + size <= c.size)
+            {
+                offset += padding + size;
+                return c.base + offset - size;
+            }
+
+            // Chunks are kept after a rollback, so try the next one first
+            current++;
+            offset = 0;
+
+            if ((current < chunks.size()) && (chunks[current].size >= size + alignment))
+                continue;
+        }
+
+        size_t sz = (size + alignment > chunk_size) ? size + alignment : chunk_size;
+        char *base = static_cast<char *>(malloc(sz));
+        if (!base)
+            throw std::bad_alloc();
+
+        chunks.insert(chunks.begin() + current, {base, sz});
+        offset = 0;
+    }
+}
+
+
+char *arena::strndup(const char *str, size_t length)
+{
+    char *copy = static_cast<char *>(alloc(length + 1, 1));
+    memcpy(copy, str, length);
+    copy[length] = 0;
+    return copy;
+}
+
+
+void arena::rollback(const mark &m)
+{
+    current = m.chunk;
+    offset = m.offset;
+}
+
+
+bool arena::allocated_since(const mark &m, const void *ptr) const
+{
+    const char *p = static_cast<const char *>(ptr);
+
+    for (size_t i = m.chunk; (i <= current) && (i < chunks.size()); i++)
+    {
+        const chunk &c = chunks[i];
+        if ((p >= c.base) && (p < c.base + c.size))
+            return (i > m.chunk) || (p >= c.base + m.offset);
+    }
+
+    return false;
+}
+
+
+size_t arena::bytes_used(void) const
+{
+    size_t used = offset;
+    for (size_t i = 0; (i < current) && (i < chunks.size()); i++)
+        used += chunks[i].size;
+
+    return used;
+}
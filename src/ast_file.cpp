@@ -0,0 +1,371 @@
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <string>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ast_file.hpp"
+
+
+static_assert(sizeof(ast_file_header) == 72, "ast_file_header layout changed");
+static_assert(sizeof(ast_file_node) == 24, "ast_file_node layout changed");
+static_assert(sizeof(ast_file_token) == 32, "ast_file_token layout changed");
+
+// Number of node kinds (and of parser_type_names entries)
+static const uint32_t KIND_COUNT = syntax_tree_node::ORIGINAL_NAMESPACE_NAME + 1;
+
+static const char MAGIC[8] = "PEGIAST";
+
+
+static inline size_t align8(size_t x)
+{
+    return (x + 7) & ~static_cast<size_t>(7);
+}
+
+
+static bool has_declaration(const syntax_tree_node *node)
+{
+    switch (node->type)
+    {
+        case syntax_tree_node::TYPEDEF_NAME:
+        case syntax_tree_node::CLASS_NAME:
+        case syntax_tree_node::TEMPLATE_NAME:
+        case syntax_tree_node::ORIGINAL_NAMESPACE_NAME:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+
+static void fill_token(ast_file_token *t, const token_stream &tokens, token_index i)
+{
+    source_text spelling = tokens.spelling(i);
+
+    t->type = tokens.type(i);
+    t->offset = spelling.start - tokens.source;
+    t->length = spelling.length;
+    t->line = tokens.line(i);
+    t->column = tokens.column(i);
+
+    switch (tokens.type(i))
+    {
+        case token::LIT_INTEGER:
+            t->subtype = tokens.integer_value(i).subtype;
+            t->value.u = tokens.integer_value(i).value.u;
+            break;
+
+        case token::LIT_FLOAT:
+            t->subtype = tokens.float_value(i).subtype;
+            t->value.f = static_cast<double>(tokens.float_value(i).value);
+            break;
+
+        case token::LIT_BOOL: t->value.u = tokens.bool_value(i); break;
+        case token::LIT_CHAR: t->value.u = tokens.char_value(i); break;
+
+        default: break;
+    }
+}
+
+
+/**
+ * Writes all of the given buffers, continuing after partial writes.
+ */
+static bool write_all(int fd, struct iovec *iov, int count)
+{
+    while (count)
+    {
+        ssize_t w = writev(fd, iov, count);
+        if (w < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+
+        for (; count && (static_cast<size_t>(w) >= iov->iov_len); iov++, count--)
+            w -= iov->iov_len;
+
+        if (count)
+        {
+            iov->iov_base = static_cast<char *>(iov->iov_base) + w;
+            iov->iov_len -= w;
+        }
+    }
+
+    return true;
+}
+
+
+bool write_sections(int fd, const file_section *sections, size_t count)
+{
+    static const char padding[8] = {0};
+    std::vector<struct iovec> iov;
+    size_t offset = 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (sections[i].offset)
+            *sections[i].offset = offset;
+
+        iov.push_back({const_cast<void *>(sections[i].data), sections[i].length});
+        offset += sections[i].length;
+
+        if (offset % 8)
+        {
+            iov.push_back({const_cast<char *>(padding), 8 - offset % 8});
+            offset = align8(offset);
+        }
+    }
+
+    return write_all(fd, iov.data(), iov.size());
+}
+
+
+const char *map_file(const char *path, size_t *size)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return nullptr;
+
+    struct stat st;
+    if (fstat(fd, &st) < 0)
+    {
+        int err = errno;
+        close(fd);
+        errno = err;
+        return nullptr;
+    }
+
+    if (!S_ISREG(st.st_mode) || !st.st_size)
+    {
+        close(fd);
+        errno = EINVAL;
+        return nullptr;
+    }
+
+    void *base = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    int err = errno;
+    close(fd);
+
+    if (base == MAP_FAILED)
+    {
+        errno = err;
+        return nullptr;
+    }
+
+    *size = st.st_size;
+    return static_cast<const char *>(base);
+}
+
+
+// Number of nodes in every depth of the tree below node
+static void count_levels(const syntax_tree_node *node, size_t depth, std::vector<uint32_t> *levels)
+{
+    if (depth >= levels->size())
+        levels->push_back(0);
+    (*levels)[depth]++;
+
+    for (const syntax_tree_node *c: node->children)
+        count_levels(c, depth + 1, levels);
+}
+
+
+struct ast_numbering
+{
+    std::vector<ast_file_node> nodes;
+    // Tree node of every entry in nodes
+    std::vector<const syntax_tree_node *> order;
+    // Index of the next node in every depth
+    std::vector<uint32_t> next;
+    // Nodes with a declaration, and that declaration
+    std::vector<std::pair<uint32_t, const syntax_tree_node *>> declared;
+};
+
+
+/**
+ * Stores node and everything below it in breadth-first order. The tree is
+ * walked depth-first, which visits the nodes of every depth in the same order
+ * as a breadth-first walk, but follows the order they were allocated in (so
+ * this is much friendlier to the cache).
+ */
+static void number_nodes(const syntax_tree_node *node, size_t depth, uint32_t parent, ast_numbering *an)
+{
+    uint32_t i = an->next[depth]++;
+
+    an->nodes[i] = ast_file_node {node->type, parent, an->next[depth + 1], 0, node->ass_token, AST_NONE};
+    an->order[i] = node;
+
+    for (const syntax_tree_node *c: node->children)
+    {
+        number_nodes(c, depth + 1, i, an);
+        an->nodes[i].child_count++;
+    }
+
+    if (has_declaration(node) && node->supplemental.declaration)
+        an->declared.emplace_back(i, node->supplemental.declaration);
+}
+
+
+bool write_ast_file(int fd, const token_stream &tokens, const syntax_tree_node *root)
+{
+    std::vector<uint32_t> levels;
+    count_levels(root, 0, &levels);
+
+    ast_numbering an;
+    uint32_t node_count = 0;
+    for (uint32_t count: levels)
+    {
+        an.next.push_back(node_count);
+        node_count += count;
+    }
+    // Children of the deepest nodes (there are none) start at the end
+    an.next.push_back(node_count);
+    an.nodes.resize(node_count);
+    an.order.resize(node_count);
+
+    number_nodes(root, 0, AST_NONE, &an);
+
+    // Only look for the nodes actually referred to
+    if (!an.declared.empty())
+    {
+        std::unordered_map<const syntax_tree_node *, uint32_t> index;
+        for (const auto &d: an.declared)
+            index.emplace(d.second, AST_NONE);
+
+        for (uint32_t i = 0; i < node_count; i++)
+        {
+            auto d = index.find(an.order[i]);
+            if (d != index.end())
+                d->second = i;
+        }
+
+        for (const auto &d: an.declared)
+            an.nodes[d.first].declaration = index[d.second];
+    }
+
+    std::vector<ast_file_token> toks(tokens.size());
+    for (token_index i = 0; i < tokens.size(); i++)
+        fill_token(&toks[i], tokens, i);
+
+    // The token of a merged >> or >>= is spelled by both of its tokens (the
+    // second one is not part of the tree)
+    for (const syntax_tree_node *node: an.order)
+        if (((node->type == syntax_tree_node::SHIFT_OPERATOR) || (node->type == syntax_tree_node::ASSIGNMENT_OPERATOR)) &&
+            (node->supplemental.merged_operator != ATOM_NONE))
+            toks[node->children.front()->ass_token].length = strlen(atom_spelling(node->supplemental.merged_operator));
+
+    uint32_t kind_names[KIND_COUNT];
+    std::string strings;
+    for (uint32_t k = 0; k < KIND_COUNT; k++)
+    {
+        kind_names[k] = strings.length();
+        strings.append(parser_type_names[k], strlen(parser_type_names[k]) + 1);
+    }
+
+    size_t source_length = strlen(tokens.source);
+
+    ast_file_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = AST_FILE_VERSION;
+    header.node_count = node_count;
+    header.token_count = toks.size();
+    header.kind_count = KIND_COUNT;
+    header.source_length = source_length;
+
+    // Sections in file order (the source's null byte is written as well); the
+    // header gets their offsets before it is written
+    const file_section sections[] = {
+        {&header, sizeof(header), nullptr},
+        {an.nodes.data(), node_count * sizeof(ast_file_node), &header.nodes_offset},
+        {toks.data(), toks.size() * sizeof(ast_file_token), &header.tokens_offset},
+        {kind_names, sizeof(kind_names), &header.kind_names_offset},
+        {strings.data(), strings.length(), &header.strings_offset},
+        {tokens.source, source_length + 1, &header.source_offset},
+    };
+
+    return write_sections(fd, sections, sizeof(sections) / sizeof(sections[0]));
+}
+
+
+ast_file::~ast_file(void)
+{
+    release();
+}
+
+
+void ast_file::release(void)
+{
+    if (data)
+        munmap(const_cast<char *>(data), size);
+
+    data = nullptr;
+    size = 0;
+}
+
+
+/**
+ * Checks that the header is ours and all sections lie within the file (their
+ * contents are trusted).
+ */
+bool ast_file::valid(void) const
+{
+    if (size < sizeof(ast_file_header))
+        return false;
+
+    const ast_file_header &h = header();
+    if (memcmp(h.magic, MAGIC, sizeof(MAGIC)) || (h.version != AST_FILE_VERSION))
+        return false;
+
+    auto fits = [this](uint64_t offset, uint64_t length) {
+        return !(offset % 8) && (offset <= size) && (length <= size - offset);
+    };
+
+    if (!fits(h.nodes_offset, static_cast<uint64_t>(h.node_count) * sizeof(ast_file_node)) ||
+        !fits(h.tokens_offset, static_cast<uint64_t>(h.token_count) * sizeof(ast_file_token)) ||
+        !fits(h.kind_names_offset, static_cast<uint64_t>(h.kind_count) * sizeof(uint32_t)) ||
+        !fits(h.source_offset, h.source_length + 1) ||
+        (h.strings_offset > h.source_offset) || !h.node_count)
+    {
+        return false;
+    }
+
+    // Names must be null-terminated within the string section
+    const uint32_t *kind_names = section<uint32_t>(h.kind_names_offset);
+    const char *strings = section<char>(h.strings_offset);
+    size_t strings_length = h.source_offset - h.strings_offset;
+
+    for (uint32_t k = 0; k < h.kind_count; k++)
+        if ((kind_names[k] >= strings_length) || !memchr(strings + kind_names[k], 0, strings_length - kind_names[k]))
+            return false;
+
+    return !source()[h.source_length];
+}
+
+
+bool ast_file::load(const char *path)
+{
+    release();
+
+    data = map_file(path, &size);
+    if (!data)
+        return false;
+
+    if (!valid())
+    {
+        release();
+        errno = EINVAL;
+        return false;
+    }
+
+    return true;
+}
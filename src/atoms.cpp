@@ -0,0 +1,204 @@
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+#include "arena.hpp"
+#include "atoms.hpp"
+
+
+struct atom_entry
+{
+    const char *spelling;
+    size_t length;
+    size_t hash;
+};
+
+
+// Open addressing (linear probing), ATOM_NONE marks empty buckets; the number
+// of buckets is always a power of two and at least twice the number of atoms.
+struct bucket_table
+{
+    size_t mask;
+    std::atomic<atom_t> *buckets;
+};
+
+
+static const char *const predefined_spellings[] = {
+    nullptr,
+
+#define ATOM(name, spelling) spelling,
+#include "predefined_atoms.hpp"
+#undef ATOM
+};
+
+
+// The table may be used by any number of threads. Lookups of existing atoms
+// take no lock: entries never move once they have been written, and a new
+// atom only becomes visible through its bucket after its entry is complete.
+// Adding atoms is serialized through atom_lock.
+static std::mutex atom_lock;
+
+// Chunk i holds the entries of atoms FIRST_CHUNK_SIZE * (2^i - 1) up to
+// (excluding) FIRST_CHUNK_SIZE * (2^(i + 1) - 1).
+static const int FIRST_CHUNK_BITS = 10;
+static atom_entry *atom_chunks[32 - FIRST_CHUNK_BITS + 1];
+static std::atomic<size_t> atom_total;
+
+static std::atomic<const bucket_table *> atom_buckets;
+
+// Spellings of atoms which are not predefined, entry chunks and bucket tables
+// (old tables are never released, as other threads may still be probing them)
+static arena atom_arena(1 << 16);
+
+
+static inline atom_entry &entry(atom_t a)
+{
+    uint64_t i = static_cast<uint64_t>(a) + (1 << FIRST_CHUNK_BITS);
+    int chunk = 63 - __builtin_clzll(i) - FIRST_CHUNK_BITS;
+    return atom_chunks[chunk][i - (UINT64_C(1) << (chunk + FIRST_CHUNK_BITS))];
+}
+
+
+static inline size_t spelling_hash(const char *spelling, size_t length)
+{
+    // FNV-1a
+    size_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < length; i++)
+        hash = (hash ^ static_cast<unsigned char>(spelling[i])) * 1099511628211ULL;
+    return hash;
+}
+
+
+static const bucket_table *new_bucket_table(size_t buckets)
+{
+    std::atomic<atom_t> *b = static_cast<std::atomic<atom_t> *>(atom_arena.alloc(buckets * sizeof(*b), alignof(std::atomic<atom_t>)));
+    for (size_t i = 0; i < buckets; i++)
+        new (&b[i]) std::atomic<atom_t>(ATOM_NONE);
+
+    return new (atom_arena.alloc(sizeof(bucket_table), alignof(bucket_table))) bucket_table {buckets - 1, b};
+}
+
+
+static void insert_bucket(const bucket_table *table, atom_t a)
+{
+    size_t i = entry(a).hash & table->mask;
+
+    while (table->buckets[i].load(std::memory_order_relaxed) != ATOM_NONE)
+        i = (i + 1) & table->mask;
+
+    table->buckets[i].store(a, std::memory_order_release);
+}
+
+
+static atom_t find_atom(const bucket_table *table, const char *spelling, size_t length, size_t hash)
+{
+    atom_t a;
+
+    for (size_t i = hash & table->mask; (a = table->buckets[i].load(std::memory_order_acquire)) != ATOM_NONE; i = (i + 1) & table->mask)
+    {
+        const atom_entry &ae = entry(a);
+        if ((ae.hash == hash) && (ae.length == length) && !memcmp(ae.spelling, spelling, length))
+            return a;
+    }
+
+    return ATOM_NONE;
+}
+
+
+// Must be called with atom_lock held (or during initialization).
+static atom_t add_atom(const char *spelling, size_t length, size_t hash)
+{
+    atom_t a = atom_total.load(std::memory_order_relaxed);
+
+    uint64_t i = static_cast<uint64_t>(a) + (1 << FIRST_CHUNK_BITS);
+    int chunk = 63 - __builtin_clzll(i) - FIRST_CHUNK_BITS;
+    if (!atom_chunks[chunk])
+    {
+        size_t entries = static_cast<size_t>(1) << (chunk + FIRST_CHUNK_BITS);
+        atom_chunks[chunk] = static_cast<atom_entry *>(atom_arena.alloc(entries * sizeof(atom_entry), alignof(atom_entry)));
+    }
+
+    entry(a) = {spelling, length, hash};
+
+    const bucket_table *table = atom_buckets.load(std::memory_order_relaxed);
+    if ((a + 1) * 2 > table->mask + 1)
+    {
+        const bucket_table *grown = new_bucket_table((table->mask + 1) * 2);
+        for (atom_t b = 1; b <= a; b++)
+            insert_bucket(grown, b);
+
+        atom_buckets.store(grown, std::memory_order_release);
+    }
+    else
+        insert_bucket(table, a);
+
+    atom_total.store(a + 1, std::memory_order_release);
+
+    return a;
+}
+
+
+static void init_atoms(void)
+{
+    atom_buckets.store(new_bucket_table(1024), std::memory_order_relaxed);
+    atom_chunks[0] = static_cast<atom_entry *>(atom_arena.alloc((1 << FIRST_CHUNK_BITS) * sizeof(atom_entry), alignof(atom_entry)));
+    entry(ATOM_NONE) = {nullptr, 0, 0};
+    atom_total.store(1, std::memory_order_relaxed);
+
+    for (atom_t a = 1; a < PREDEFINED_ATOM_COUNT; a++)
+    {
+        const char *spelling = predefined_spellings[a];
+        add_atom(spelling, strlen(spelling), spelling_hash(spelling, strlen(spelling)));
+    }
+}
+
+
+static inline void ensure_atoms(void)
+{
+    // Initialization of local statics is thread-safe
+    static bool initialized = (init_atoms(), true);
+    (void)initialized;
+}
+
+
+/**
+ * Returns the atom for the given spelling (which does not need to be
+ * null-terminated), creating it if necessary.
+ */
+atom_t intern(const char *spelling, size_t length)
+{
+    ensure_atoms();
+
+    size_t hash = spelling_hash(spelling, length);
+
+    atom_t a = find_atom(atom_buckets.load(std::memory_order_acquire), spelling, length, hash);
+    if (a != ATOM_NONE)
+        return a;
+
+    std::lock_guard<std::mutex> lock(atom_lock);
+
+    // Someone else may have added it in the meantime
+    a = find_atom(atom_buckets.load(std::memory_order_relaxed), spelling, length, hash);
+    if (a != ATOM_NONE)
+        return a;
+
+    return add_atom(atom_arena.strndup(spelling, length), length, hash);
+}
+
+
+const char *atom_spelling(atom_t a)
+{
+    ensure_atoms();
+
+    return entry(a).spelling;
+}
+
+
+size_t atom_count(void)
+{
+    ensure_atoms();
+
+    return atom_total.load(std::memory_order_acquire);
+}
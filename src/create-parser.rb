@@ -1,6 +1,8 @@
 #!/usr/bin/env ruby
 # coding: utf-8
 
+require 'stringio'
+
 svs = Hash.new
 pre_hooks = Hash.new
 post_hooks = Hash.new
@@ -10,6 +12,25 @@ all_fail_hooks = Hash.new
 fail_hooks = Hash.new
 current = nil
 
+# --packrat: memoize the result of every generated syntactic variable per token
+# position (see memo_fetch() in parser.cpp)
+packrat = false
+# --profile: count calls, matches, tokens, nodes and cycles per syntactic
+# variable and alternative (see rule_probe in parser.cpp)
+profile = false
+
+ARGV.each do |arg|
+    case arg
+    when '--packrat'
+        packrat = true
+    when '--profile'
+        profile = true
+    else
+        $stderr.puts("Unknown option #{arg}")
+        exit 1
+    end
+end
+
 def missing_parameter_for(attribute)
     $stderr.puts("Attribute #{attribute} requires a parameter")
     exit 1
@@ -89,6 +110,222 @@ def var(name)
 end
 
 
+# Constants of the predefined atoms by quoted spelling
+$atoms = Hash.new
+IO.readlines('include/predefined_atoms.hpp').each do |line|
+    match = /^ATOM\((\w+),\s*(".*")\)$/.match(line.strip)
+    $atoms[match[2]] = "ATOM_#{match[1]}" if match
+end
+
+def atom(spelling)
+    unless $atoms[spelling]
+        $stderr.puts("#{spelling} is not a predefined atom (see include/predefined_atoms.hpp)")
+        exit 1
+    end
+
+    $atoms[spelling]
+end
+
+
+# FIRST sets: for every syntactic variable, the tokens a match may start with
+# ('op:"x"' and 'id:"x"' for specific operators and identifiers, 'kind:x' for
+# any token of a kind, 'any' if that cannot be determined) and whether it may
+# match no tokens at all.
+#
+# These are the syntactic variables implemented in parser.cpp.
+first = {
+    'typedef_name'             => ['kind:identifier'],
+    'class_name'               => ['kind:identifier'],
+    'template_name'            => ['kind:identifier'],
+    'original_namespace_name'  => ['kind:identifier'],
+    'namespace_alias'          => ['kind:identifier'],
+    'enum_name'                => ['kind:identifier'],
+    'overloadable_operator'    => ['kind:operator'],
+    'right_shift'              => ['op:">"'],
+    'right_shift_assignment'   => ['op:">"'],
+    'trivially_balanced_token' => ['any'],
+}
+nullable = Hash.new(false)
+
+svs.each_key do |sv|
+    first[var sv] = Array.new
+end
+
+def first_of_part(part, first, nullable)
+    part = part[1..-2] if part[0] == '[' && part[-1] == ']'
+
+    if part.include?('(')
+        match = /^([\w-]+)\((.*)\)$/.match(part)
+        kind = match[1]
+        condition = match[2]
+
+        if kind == 'identifier' || kind == 'keyword'
+            [condition.empty? ? 'kind:identifier' : "id:#{condition}"]
+        elsif kind == 'operator' && condition[0] == '"'
+            ["op:#{condition}"]
+        else
+            ["kind:#{kind}"]
+        end
+    elsif first[var part]
+        first[var part]
+    else
+        ['any']
+    end
+end
+
+def part_nullable?(part, first, nullable)
+    return true if part[0] == '[' && part[-1] == ']'
+    return false if part.include?('(')
+    return true unless first[var part]
+
+    nullable[var part]
+end
+
+# Returns the FIRST set of a rule and whether it is nullable
+def first_of_rule(rule, first, nullable)
+    set = Array.new
+    in_loop = false
+    loop_done = false
+
+    rule.each do |part|
+        if part == '{'
+            in_loop = true
+            loop_done = false
+            next
+        elsif part == '}'
+            in_loop = false
+            next
+        end
+
+        next if in_loop && loop_done
+
+        set |= first_of_part(part, first, nullable)
+        next if part_nullable?(part, first, nullable)
+
+        if in_loop
+            # Loops may match zero times, so continue after the loop
+            loop_done = true
+        else
+            return [set, false]
+        end
+    end
+
+    [set, true]
+end
+
+loop do
+    changed = false
+
+    svs.each do |sv, rules|
+        rules.each do |rule|
+            set, can_be_empty = first_of_rule(rule, first, nullable)
+
+            if !(set - first[var sv]).empty?
+                first[var sv] |= set
+                changed = true
+            end
+
+            if can_be_empty && !nullable[var sv]
+                nullable[var sv] = true
+                changed = true
+            end
+        end
+    end
+
+    break unless changed
+end
+
+
+# Computes which alternatives may match at the end of input, for any token and
+# for specific token kinds and values (as bit masks).
+def first_dispatch_masks(rules, first, nullable)
+    if rules.size > 32
+        $stderr.puts('Too many alternatives for FIRST set dispatch')
+        exit 1
+    end
+
+    always = 0
+    at_end = 0
+    by_kind = Hash.new(0)
+    by_value = Hash.new { |h, k| h[k] = Hash.new(0) }
+
+    rules.each_with_index do |rule, i|
+        set, can_be_empty = first_of_rule(rule, first, nullable)
+        bit = 1 << i
+
+        if can_be_empty
+            always |= bit
+            at_end |= bit
+        end
+
+        set.each do |entry|
+            type, value = entry.split(':', 2)
+
+            case type
+            when 'any'
+                always |= bit
+            when 'kind'
+                by_kind[value] |= bit
+            when 'op'
+                by_value['operator'][value] |= bit
+            when 'id'
+                by_value['identifier'][value] |= bit
+            end
+        end
+    end
+
+    [always, at_end, by_kind, by_value]
+end
+
+
+# Writes code computing the set of alternatives (as a bit mask in "viable")
+# which may match the current token.
+def write_first_dispatch(f, masks)
+    always, at_end, by_kind, by_value = masks
+
+    f.puts('    // Alternatives which may match the current token (FIRST sets)')
+    f.puts('    unsigned viable;')
+    f.puts('    if (!token_available(ctx, b))')
+    f.puts("        viable = 0x#{at_end.to_s(16)};")
+    f.puts('    else')
+    f.puts('    {')
+    f.puts('        switch (token_type_at(ctx, b))')
+    f.puts('        {')
+
+    # Token kinds without value comparisons share their case if they result in
+    # the same set
+    cases = (by_kind.keys | by_value.keys).group_by do |kind|
+        by_value[kind].empty? ? (always | by_kind[kind]) : kind
+    end
+
+    cases.each_value do |kinds|
+        kinds.each do |kind|
+            f.puts("            case token::#{const kind}:")
+        end
+
+        kind = kinds.first
+        f.puts("                viable = 0x#{(always | by_kind[kind]).to_s(16)};")
+
+        values = by_value[kind].map { |value, mask| [value, mask & ~(always | by_kind[kind])] }.reject { |_, mask| mask == 0 }
+        unless values.empty?
+            f.puts('                switch (token_atom_at(ctx, b))')
+            f.puts('                {')
+            values.each do |value, mask|
+                f.puts("                    case #{atom value}: viable |= 0x#{mask.to_s(16)}; break;")
+            end
+            f.puts('                    default: break;')
+            f.puts('                }')
+        end
+        f.puts('                break;')
+    end
+
+    f.puts('            default:')
+    f.puts("                viable = 0x#{always.to_s(16)};")
+    f.puts('        }')
+    f.puts('    }')
+end
+
+
 File.open('include/parser-enum-content.hpp', 'w') do |f|
     f.puts('TOKEN,')
     f.puts
@@ -110,28 +347,136 @@ File.open('src/parser-enum-names.cpp', 'w') do |f|
 end
 
 File.open('src/parser-sv-prototypes.cxx', 'w') do |f|
+    if packrat
+        f.puts('#define PACKRAT_PARSER')
+        f.puts
+        f.puts('static void memo_replay_hooks(parser_context *ctx, syntax_tree_node *node);')
+    end
+
+    if profile
+        f.puts('#define PARSER_PROFILE')
+        f.puts
+    end
+
     svs.each_key do |sv|
         if sv[0] == '!'
-            f.puts("static syntax_tree_node *sv_#{var sv}(range_t b, range_t e, bool *success);")
+            f.puts("static syntax_tree_node *sv_#{var sv}(parser_context *ctx, range_t b, bool *success);")
         else
-            f.puts("static range_t sv_#{var sv}(syntax_tree_node *parent, range_t b, range_t e, bool *success);")
+            f.puts("static range_t sv_#{var sv}(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);")
         end
     end
 end
 
-File.open('src/parser-sv-handlers.cxx', 'w') do |f|
+
+# Removes the labels of alternatives no goto refers to (e.g. of alternatives
+# which can only be reached by falling through).
+def without_unused_labels(code)
+    code.lines.reject do |line|
+        label = line[/^(\w+):$/, 1]
+        label && !code.include?("goto #{label};")
+    end.join
+end
+
+
+# Memoized subtrees that are reused get cloned; this function then re-applies
+# all hooks of a successful match to the clone, in the order they were
+# originally executed in.
+def write_replay_hooks(f, svs, pre_hooks, post_hooks)
+    f.puts('static void memo_replay_hooks(parser_context *ctx, syntax_tree_node *node)')
+    f.puts('{')
+    f.puts('    switch (node->type)')
+    f.puts('    {')
+    svs.each_key do |sv|
+        f.puts("        case syntax_tree_node::#{const sv}: #{pre_hooks[sv]}(ctx, node); break;") if pre_hooks[sv]
+    end
+    f.puts('        default: break;')
+    f.puts('    }')
+    f.puts
+    f.puts('    for (syntax_tree_node *c: node->children)')
+    f.puts('        memo_replay_hooks(ctx, c);')
+    f.puts
+    f.puts('    switch (node->type)')
+    f.puts('    {')
+    svs.each_key do |sv|
+        f.puts("        case syntax_tree_node::#{const sv}: #{post_hooks[sv]}(ctx, node); break;") if post_hooks[sv]
+    end
+    f.puts('        default: break;')
+    f.puts('    }')
+    f.puts('}')
+    f.puts
+    f.puts
+end
+
+File.open('src/parser-sv-handlers.cxx', 'w') do |file|
+    write_replay_hooks(file, svs, pre_hooks, post_hooks) if packrat
+
+    if profile
+        # Number of alternatives by node type (tokens have no handler)
+        file.puts('static const unsigned rule_alternatives[] = {')
+        file.puts('    0,')
+        svs.each do |sv, rules|
+            file.puts("    #{rules.size},")
+        end
+        file.puts('};')
+        file.puts
+        file.puts
+    end
+
+    # Failed matches are discarded by rolling back the node arena, unless this
+    # is a memoizing parser, as that must not destroy reusable subtrees
+    rollback = !packrat
+
     svs.each_key do |sv|
+        # Written to a buffer first, so labels nothing jumps to can be dropped
+        f = StringIO.new
+        memoize = packrat && (sv[0] != '!')
+
         if sv[0] == '!'
-            f.puts("static syntax_tree_node *sv_#{var sv}(range_t b, range_t e, bool *success)")
+            f.puts("static syntax_tree_node *sv_#{var sv}(parser_context *ctx, range_t b, bool *success)")
         else
-            f.puts("static range_t sv_#{var sv}(syntax_tree_node *parent, range_t b, range_t e, bool *success)")
+            f.puts("static range_t sv_#{var sv}(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)")
         end
         f.puts('{')
-        f.puts("    bool could_parse;")
-        #f.puts("    printf(\"Visiting #{sv.sub('!', '')} for token %s; \", (*b)->content); for (syntax_tree_node *p = parent; p; p = p->parent) printf(\"%s <- \", parser_type_names[p->type]); putchar('\\n');") unless sv[0] == '!'
+        # Only calls of other handlers report whether they could parse
+        calls = svs[sv].any? { |rule| rule.any? { |part| (part != '{') && (part != '}') && !part.include?('(') } }
+        f.puts("    bool could_parse;") if calls
+        f.puts("    rule_probe probe(ctx, syntax_tree_node::#{const sv}, b, success);") if profile
         f.puts
-        f.puts("    syntax_tree_node *node = new syntax_tree_node(syntax_tree_node::#{const sv}, #{sv[0] == '!' ? 'nullptr' : 'parent'}#{is_intermediate[sv] ? ', true' : ''});")
-        f.puts("    #{pre_hooks[sv]}(node);") if pre_hooks[sv]
+
+        masks = first_dispatch_masks(svs[sv], first, nullable)
+        always_viable = masks[0]
+        early_exit = (sv[0] != '!') && !pre_hooks[sv]
+
+        if early_exit || (always_viable != (1 << svs[sv].size) - 1)
+            write_first_dispatch(f, masks)
+        end
+
+        if early_exit
+            # No alternative can match, so we do not need a node at all
+            f.puts
+            f.puts('    if (!viable)')
+            f.puts('    {')
+            f.puts('        *success = false;')
+            f.puts('        return b;')
+            f.puts('    }')
+        end
+
+        if memoize
+            f.puts
+            f.puts("    memo_entry *memo = memo_fetch(ctx, syntax_tree_node::#{const sv}, parent, b);")
+            f.puts('    if (memo && (memo->outcome != memo_entry::PENDING))')
+            if profile
+                f.puts('        return probe.recalled(memo_recall(ctx, memo, parent, b, success));')
+            else
+                f.puts('        return memo_recall(ctx, memo, parent, b, success);')
+            end
+        end
+        #f.puts("    printf(\"Visiting #{sv.sub('!', '')} for token %.*s; \", static_cast<int>(ctx->tokens->lengths[b]), ctx->tokens->source + ctx->tokens->offsets[b]); for (syntax_tree_node *p = parent; p; p = p->parent) printf(\"%s <- \", parser_type_names[p->type]); putchar('\\n');") unless sv[0] == '!'
+        f.puts
+        f.puts('    parse_mark entry_mark = mark_parse(ctx);') if rollback
+        f.puts("    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::#{const sv}, #{sv[0] == '!' ? 'nullptr' : 'parent'}#{is_intermediate[sv] ? ', true' : ''});")
+        f.puts('    parse_mark children_mark = mark_parse(ctx);') if rollback && (svs[sv].size > 1)
+        f.puts("    #{pre_hooks[sv]}(ctx, node);") if pre_hooks[sv]
 
         f.puts
         f.puts("    // #{sv.sub('!', '')}:")
@@ -151,22 +496,40 @@ File.open('src/parser-sv-handlers.cxx', 'w') do |f|
             f.puts
             f.puts("sv_#{var sv}_part_#{i}:")
             if i > 0
-                f.puts("    #{all_fail_hooks[sv]}(node);") if all_fail_hooks[sv]
-                f.puts('    for (syntax_tree_node *c: node->children) delete c; node->children.clear();')
+                f.puts("    #{all_fail_hooks[sv]}(ctx, node);") if all_fail_hooks[sv]
+                if rollback
+                    f.puts('    node->children.clear();')
+                    f.puts('    rollback_parse(ctx, children_mark);')
+                else
+                    f.puts('    discard_children(ctx, node);')
+                end
                 f.puts('    m = b;')
                 f.puts
             end
 
+            if (always_viable & (1 << i)) == 0
+                f.puts("    if (!(viable & 0x#{(1 << i).to_s(16)}))")
+                f.puts("        goto sv_#{var sv}_part_#{i + 1};")
+                f.puts
+            end
+
+            if profile
+                f.puts("    probe.attempt(#{i});")
+                f.puts
+            end
+
             in_loop = false
 
             rule.each do |part|
                 if part == '{'
                     f.puts('    {')
                     f.puts('    range_t l;')
+                    f.puts('    parse_mark lm;') if rollback
                     f.puts('    int incomplete;')
                     f.puts('    do')
                     f.puts('    {')
                     f.puts('    l = m;')
+                    f.puts('    lm = mark_parse(ctx);') if rollback
                     f.puts('    incomplete = 0;')
                     f.puts
                     in_loop = true
@@ -174,7 +537,15 @@ File.open('src/parser-sv-handlers.cxx', 'w') do |f|
                 elsif part == '}'
                     in_loop = false
                     f.puts('    } while (l != m);')
-                    f.puts('    for (int i = 0; i < incomplete; i++) { delete node->children.back(); node->children.pop_back(); }')
+                    if rollback
+                        f.puts('    if (incomplete)')
+                        f.puts('    {')
+                        f.puts('        for (int i = 0; i < incomplete; i++) node->children.pop_back();')
+                        f.puts('        rollback_parse(ctx, lm);')
+                        f.puts('    }')
+                    else
+                        f.puts('    discard_last_children(ctx, node, incomplete);')
+                    end
                     f.puts('    }')
                     next
                 end
@@ -198,24 +569,26 @@ File.open('src/parser-sv-handlers.cxx', 'w') do |f|
                     condition = match[2]
 
                     if kind == 'identifier' || kind == 'keyword'
-                        f.puts("    if ((m != e) && ((*m)->type == token::#{const 'identifier'}) && is_#{var kind}(node, *m, #{condition.empty? ? 'nullptr' : condition}))")
+                        f.puts("    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::#{const 'identifier'}) && is_#{var kind}(ctx, node, m, #{condition.empty? ? 'ATOM_NONE' : atom(condition)}))")
                     elsif condition.empty?
-                        f.puts("    if ((m != e) && ((*m)->type == token::#{const kind}))")
+                        f.puts("    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::#{const kind}))")
+                    elsif kind == 'operator' && condition[0] == '"'
+                        f.puts("    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::#{const kind}) && (token_atom_at(ctx, m) == #{atom condition}))")
                     elsif condition[0] == '"'
-                        f.puts("    if ((m != e) && ((*m)->type == token::#{const kind}) && !strcmp(reinterpret_cast<#{var kind}_token *>(*m)->value, #{condition}))")
+                        f.puts("    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::#{const kind}) && ctx->tokens->#{kind.sub('lit-', '')}_is(m, #{condition}))")
                     else
                         # FIXME (@lit-integer)
-                        f.puts("    if ((m != e) && ((*m)->type == token::#{const kind}) && (reinterpret_cast<#{var kind}_token *>(*m)->value#{kind == 'lit-integer' ? '.s' : ''} == #{condition}))")
+                        f.puts("    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::#{const kind}) && (ctx->tokens->#{kind.sub('lit-', '')}_value(m)#{kind == 'lit-integer' ? '.value.s' : ''} == #{condition}))")
                     end
                     f.puts('    {')
-                    f.puts('        syntax_tree_node *tok_node = new syntax_tree_node(syntax_tree_node::TOKEN, node);')
-                    f.puts('        tok_node->ass_token = *m;')
-                    f.puts('        if (++m > maximum_extent) maximum_extent = m;')
+                    f.puts('        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);')
+                    f.puts('        tok_node->ass_token = m;')
+                    f.puts('        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;')
                     f.puts('        incomplete++;') if in_loop
                     f.puts('    }')
                     f.puts('    else') unless optional
                 else
-                    f.puts("    m = sv_#{var part}(node, m, e, &could_parse);")
+                    f.puts("    m = sv_#{var part}(ctx, node, m, &could_parse);")
                     if in_loop
                         f.puts('    if (could_parse)')
                         f.puts('        incomplete++;')
@@ -239,10 +612,12 @@ File.open('src/parser-sv-handlers.cxx', 'w') do |f|
                 f.puts
             end
 
-            f.puts('    if (m > maximum_extent) maximum_extent = m;')
+            f.puts('    if (m > ctx->maximum_extent) ctx->maximum_extent = m;')
             f.puts('    *success = true;')
-            f.puts("    m = #{post_modify[sv]}(node, m, e, success);") if post_modify[sv]
-            f.puts("    #{post_hooks[sv]}(node);") if post_hooks[sv]
+            f.puts("    m = #{post_modify[sv]}(ctx, node, m, success);") if post_modify[sv]
+            f.puts("    #{post_hooks[sv]}(ctx, node);") if post_hooks[sv]
+            f.puts('    if (memo) memo_store_success(memo, node, m);') if memoize
+            f.puts("    probe.matched(#{i}, m);") if profile
             f.puts("    return #{sv[0] == '!' ? 'node' : 'm'};")
 
             i += 1
@@ -251,16 +626,19 @@ File.open('src/parser-sv-handlers.cxx', 'w') do |f|
         f.puts
         f.puts
         f.puts("sv_#{var sv}_part_#{i}:")
-        f.puts("    #{all_fail_hooks[sv]}(node);") if all_fail_hooks[sv]
-        f.puts("    #{fail_hooks[sv]}(node);") if fail_hooks[sv]
+        f.puts("    #{all_fail_hooks[sv]}(ctx, node);") if all_fail_hooks[sv]
+        f.puts("    #{fail_hooks[sv]}(ctx, node);") if fail_hooks[sv]
         f.puts('    node->detach();')
-        f.puts('    delete node;')
+        f.puts(rollback ? '    rollback_parse(ctx, entry_mark);' : '    discard_node(ctx, node);')
+        f.puts('    if (memo) memo_store_failure(memo);') if memoize
         f.puts('    *success = false;')
         f.puts("    return #{sv[0] == '!' ? 'node' : 'b'};")
         f.puts('}')
 
         f.puts
         f.puts
+
+        file.write(without_unused_labels(f.string))
     end
 end
 
@@ -0,0 +1,45 @@
+#!/usr/bin/env ruby
+# coding: utf-8
+
+# Writes the table of 128 bit approximations of 5^q used for converting
+# decimal floating point literals (see convert_float() in tokenize.cpp).
+# Each entry is normalized (most significant bit set); positive powers are
+# truncated, negative ones rounded up.
+
+SMALLEST_POWER = -342
+LARGEST_POWER = 308
+
+def entry(value)
+    "    {UINT64_C(0x%016x), UINT64_C(0x%016x)}," % [value >> 64, value & ((1 << 64) - 1)]
+end
+
+File.open('src/powers-of-five.cxx', 'w') do |f|
+    f.puts("static const int smallest_power_of_five = #{SMALLEST_POWER};")
+    f.puts("static const int largest_power_of_five = #{LARGEST_POWER};")
+    f.puts
+    f.puts('static const struct { uint64_t high, low; } powers_of_five[] = {')
+
+    (SMALLEST_POWER...0).each do |q|
+        power = 5 ** -q
+        z = power.bit_length
+
+        if q >= -27
+            value = (1 << (z + 127)) / power + 1
+        else
+            value = (1 << (2 * z + 128)) / power + 1
+            value >>= 1 while value >= (1 << 128)
+        end
+
+        f.puts(entry(value))
+    end
+
+    (0..LARGEST_POWER).each do |q|
+        value = 5 ** q
+        value <<= 1 while value < (1 << 127)
+        value >>= 1 while value >= (1 << 128)
+
+        f.puts(entry(value))
+    end
+
+    f.puts('};')
+end
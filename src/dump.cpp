@@ -0,0 +1,400 @@
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <unistd.h>
+
+#include "dump.hpp"
+
+
+bool fd_sink::write(const char *data, size_t length)
+{
+    while (length)
+    {
+        ssize_t w = ::write(fd, data, length);
+        if (w < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+
+        data += w;
+        length -= w;
+    }
+
+    return true;
+}
+
+
+bool memory_sink::write(const char *data, size_t length)
+{
+    contents.insert(contents.end(), data, data + length);
+    return true;
+}
+
+
+// Room for the longest number put_float() may need snprintf() for
+static const size_t MIN_SIZE = 64;
+
+
+dump_buffer::dump_buffer(dump_sink *s, size_t size):
+    sink(s), used(0), capacity(std::max<size_t>(size, MIN_SIZE)), failed(false), failure(0)
+{
+    buffer = new char[capacity];
+}
+
+
+dump_buffer::~dump_buffer(void)
+{
+    flush();
+    delete[] buffer;
+}
+
+
+void dump_buffer::drain(void)
+{
+    if (used && !failed && !sink->write(buffer, used))
+    {
+        failed = true;
+        failure = errno;
+    }
+
+    used = 0;
+}
+
+
+bool dump_buffer::flush(void)
+{
+    drain();
+
+    if (failed)
+        errno = failure;
+    return !failed;
+}
+
+
+void dump_buffer::put(const char *s, size_t length)
+{
+    if (length > capacity - used)
+    {
+        drain();
+
+        // Too large to be worth copying
+        if (length > capacity)
+        {
+            if (!failed && !sink->write(s, length))
+            {
+                failed = true;
+                failure = errno;
+            }
+            return;
+        }
+    }
+
+    memcpy(buffer + used, s, length);
+    used += length;
+}
+
+
+void dump_buffer::put_spaces(size_t count)
+{
+    while (count)
+    {
+        size_t n = std::min(count, capacity);
+        memset(reserve(n), ' ', n);
+        used += n;
+        count -= n;
+    }
+}
+
+
+static const char digit_pairs[] =
+    "00010203040506070809" "10111213141516171819" "20212223242526272829" "30313233343536373839" "40414243444546474849"
+    "50515253545556575859" "60616263646566676869" "70717273747576777879" "80818283848586878889" "90919293949596979899";
+
+/**
+ * Writes the decimal digits of v so that they end right before end; returns
+ * where they start.
+ */
+static char *format_unsigned(unsigned long long v, char *end)
+{
+    while (v >= 100)
+    {
+        unsigned pair = v % 100;
+        v /= 100;
+
+        end -= 2;
+        memcpy(end, digit_pairs + 2 * pair, 2);
+    }
+
+    if (v >= 10)
+    {
+        end -= 2;
+        memcpy(end, digit_pairs + 2 * v, 2);
+    }
+    else
+        *--end = '0' + v;
+
+    return end;
+}
+
+
+void dump_buffer::put_unsigned(unsigned long long v, int width)
+{
+    char digits[24];
+    char *start = format_unsigned(v, digits + sizeof(digits));
+    int length = digits + sizeof(digits) - start;
+
+    if (width > length)
+        put_spaces(width - length);
+    put(start, length);
+}
+
+
+void dump_buffer::put_signed(long long v, int width)
+{
+    char digits[24];
+    // Negating in unsigned arithmetic works for LLONG_MIN as well
+    char *start = format_unsigned((v < 0) ? -static_cast<unsigned long long>(v) : v, digits + sizeof(digits));
+    if (v < 0)
+        *--start = '-';
+    int length = digits + sizeof(digits) - start;
+
+    if (width > length)
+        put_spaces(width - length);
+    put(start, length);
+}
+
+
+// Every power of ten up to 10^27 is exact in a long double
+static const int EXACT_POWERS = 27;
+
+static const long double powers_of_ten[EXACT_POWERS + 1] = {
+    1e0L, 1e1L, 1e2L, 1e3L, 1e4L, 1e5L, 1e6L, 1e7L, 1e8L, 1e9L, 1e10L, 1e11L, 1e12L, 1e13L,
+    1e14L, 1e15L, 1e16L, 1e17L, 1e18L, 1e19L, 1e20L, 1e21L, 1e22L, 1e23L, 1e24L, 1e25L, 1e26L, 1e27L
+};
+
+/**
+ * Rounds v (positive and finite) to six significant digits, which are stored
+ * in digits, and returns the decimal exponent of the first one in *exponent.
+ * Scaling v by an exact power of ten is off by half an ulp at most, so the
+ * result is the correctly rounded one unless v is almost exactly halfway
+ * between two results; false is returned then (and if v is out of range).
+ */
+static bool round_to_six_digits(long double v, char *digits, int *exponent)
+{
+    int x = static_cast<int>(floorl(log10l(v)));
+
+    // log10l() may be off by one close to powers of ten
+    for (int attempt = 0; attempt < 3; attempt++)
+    {
+        int scale = 5 - x;
+        if ((scale < -EXACT_POWERS) || (scale > EXACT_POWERS))
+            return false;
+
+        long double scaled = (scale >= 0) ? v * powers_of_ten[scale] : v / powers_of_ten[-scale];
+        long double integral = floorl(scaled), fraction = scaled - integral;
+
+        if (fabsl(fraction - .5L) < 1e-9L)
+            return false;
+
+        if (scaled < 99999.5L)
+            x--;
+        else if (scaled >= 999999.5L)
+            x++;
+        else
+        {
+            unsigned q = static_cast<unsigned>(integral) + (fraction > .5L);
+            if (q == 1000000)
+            {
+                q = 100000;
+                x++;
+            }
+
+            format_unsigned(q, digits + 6);
+            *exponent = x;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+void dump_buffer::put_float(long double v)
+{
+    char digits[6];
+    int x;
+
+    if (v == 0)
+    {
+        put(std::signbit(v) ? "-0" : "0");
+        return;
+    }
+
+    if (!std::isfinite(v) || !round_to_six_digits(fabsl(v), digits, &x))
+    {
+        // Enough for any long double
+        char *p = reserve(32);
+        used += snprintf(p, 32, "%Lg", v);
+        return;
+    }
+
+    int length = 6;
+    while (digits[length - 1] == '0')
+        length--;
+
+    if (v < 0)
+        put('-');
+
+    // As %g does: plain notation for exponents from -4 to 5
+    if ((x >= -4) && (x < 6))
+    {
+        if (x < 0)
+        {
+            put("0.", 2);
+            for (int i = -1; i > x; i--)
+                put('0');
+            put(digits, length);
+        }
+        else if (length <= x + 1)
+        {
+            put(digits, length);
+            for (int i = length; i <= x; i++)
+                put('0');
+        }
+        else
+        {
+            put(digits, x + 1);
+            put('.');
+            put(digits + x + 1, length - x - 1);
+        }
+    }
+    else
+    {
+        put(digits[0]);
+        if (length > 1)
+        {
+            put('.');
+            put(digits + 1, length - 1);
+        }
+
+        put('e');
+        put((x < 0) ? '-' : '+');
+        if ((x > -10) && (x < 10))
+            put('0');
+        put_unsigned((x < 0) ? -x : x);
+    }
+}
+
+
+/**
+ * Dumps a token like dump_token(), spelling identifiers and operators like
+ * the given atom.
+ */
+static void dump_token_as(dump_buffer *out, const token_stream &tokens, token_index tok, atom_t atom, int spacing, bool positions)
+{
+    static const char *const kinds[] = {
+        "Identifier:", "Integer literal:", "Float literal:", "Bool literal:",
+        "Pointer literal:", "String literal:", "Char literal:", "Operator:"
+    };
+
+    source_text spelling = tokens.spelling(tok);
+    token::token_type type = tokens.type(tok);
+
+    if (type > token::OPERATOR)
+    {
+        out->put("Unknown token ");
+        out->put_unsigned(type, 2);
+        out->put(':');
+    }
+    else
+    {
+        int length = strlen(kinds[type]);
+        out->put(kinds[type], length);
+        if (spacing > length)
+            out->put_spaces(spacing - length);
+    }
+
+    out->put(' ');
+
+    if (positions)
+    {
+        out->put('(');
+        out->put_signed(tokens.line(tok), 2);
+        out->put(':');
+        out->put_signed(tokens.column(tok), 2);
+        out->put(") ", 2);
+    }
+
+    switch (type)
+    {
+        case token::IDENTIFIER:
+        case token::OPERATOR:
+            out->put(atom_spelling(atom));
+            break;
+
+        case token::LIT_INTEGER:
+            if (tokens.integer_value(tok).subtype & lit_integer::UNSIGNED)
+                out->put_unsigned(tokens.integer_value(tok).value.u);
+            else
+                out->put_signed(tokens.integer_value(tok).value.s);
+            break;
+
+        case token::LIT_FLOAT:   out->put_float(tokens.float_value(tok).value); break;
+        case token::LIT_BOOL:    out->put(tokens.bool_value(tok) ? "true" : "false"); break;
+        // What printf()'s %p makes of nullptr
+        case token::LIT_POINTER: out->put("(nil)", 5); break;
+
+        case token::LIT_CHAR:
+            out->put(spelling.start, spelling.length);
+            out->put(" (", 2);
+            out->put_unsigned(tokens.char_value(tok));
+            out->put(')');
+            break;
+
+        default:
+            out->put(spelling.start, spelling.length);
+    }
+
+    out->put('\n');
+}
+
+
+void dump_token(dump_buffer *out, const token_stream &tokens, token_index tok, int spacing, bool positions)
+{
+    dump_token_as(out, tokens, tok, tokens.atom(tok), spacing, positions);
+}
+
+
+static void dump_node(dump_buffer *out, const token_stream &tokens, const syntax_tree_node *node, size_t indentation, bool positions)
+{
+    out->put_spaces(indentation);
+    out->put(parser_type_names[node->type]);
+
+    if (node->type != syntax_tree_node::TOKEN)
+        out->put('\n');
+    else
+    {
+        out->put(": ", 2);
+
+        // Only the first token of a merged >> or >>= is part of the tree
+        const syntax_tree_node *p = node->parent;
+        if (p && ((p->type == syntax_tree_node::SHIFT_OPERATOR) || (p->type == syntax_tree_node::ASSIGNMENT_OPERATOR)) &&
+            (p->supplemental.merged_operator != ATOM_NONE))
+            dump_token_as(out, tokens, node->ass_token, p->supplemental.merged_operator, 0, positions);
+        else
+            dump_token(out, tokens, node->ass_token, 0, positions);
+    }
+
+    for (const syntax_tree_node *c: node->children)
+        dump_node(out, tokens, c, indentation + 2, positions);
+}
+
+
+void dump_syntax_tree(dump_buffer *out, const token_stream &tokens, const syntax_tree_node *node, bool positions)
+{
+    dump_node(out, tokens, node, 0, positions);
+}
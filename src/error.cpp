@@ -7,14 +7,18 @@
 error::error(int l, int c, char *m):
     line(l),
     column(c),
-    msg(m)
+    msg(m),
+    file(nullptr),
+    text(nullptr)
 {}
 
 
 error::error(char *m):
     line(-1),
     column(-1),
-    msg(m)
+    msg(m),
+    file(nullptr),
+    text(nullptr)
 {}
 
 
@@ -26,7 +30,19 @@ error::~error(void)
 
 void error::emit(const char *prg, const char *tu, const char *source) const
 {
-    fprintf(stderr, "%s: %s:%i:%i: %s\n", prg, tu, line, column, msg);
+    emit(stderr, prg, tu, source);
+}
+
+
+void error::emit(FILE *fp, const char *prg, const char *tu, const char *source) const
+{
+    if (file)
+    {
+        tu = file;
+        source = text;
+    }
+
+    fprintf(fp, "%s: %s:%i:%i: %s\n", prg, tu, line, column, msg);
 
     if (line < 1)
         return;
@@ -45,7 +61,7 @@ void error::emit(const char *prg, const char *tu, const char *source) const
     memcpy(error_line, source, line_end - source);
     error_line[line_end - source] = 0;
 
-    fprintf(stderr, "%s\n%*c\n", error_line, column, '^');
+    fprintf(fp, "%s\n%*c\n", error_line, column, '^');
 }
 
 
@@ -1,99 +1,477 @@
+#include <algorithm>
+#include <atomic>
 #include <cerrno>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <fcntl.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unistd.h>
 #include <vector>
 
+#include "ast_file.hpp"
+#include "dump.hpp"
 #include "error.hpp"
 #include "parser.hpp"
+#include "prefix_file.hpp"
+#include "preprocess.hpp"
+#include "source_file.hpp"
+#include "thread_pool.hpp"
 #include "tokenize.hpp"
 
 
-static void dump_token(token *tok, int spacing)
+// Whether to tokenize on a thread of its own while parsing (-p)
+static bool pipelined;
+
+// Where to write the binary syntax tree to instead of dumping it (-o)
+static const char *ast_output;
+
+// Whether the input is used as it is (-fpreprocessed), and the options for
+// preprocessing it otherwise (-I, -D and -U)
+static bool preprocessed;
+static pp_options pp_opts;
+
+// Headers read so far, shared by all units (and -j workers)
+static include_cache includes;
+
+// Where to write the prefix snapshot of the input to (-write-prefix), and
+// the snapshot all units start with (-include-prefix, nullptr for none)
+static const char *prefix_output;
+static prefix_file *prefix;
+
+// Whether to print the parser's rule profile at the end (-profile), and
+// whether to sort it by inclusive time rather than exclusive time
+static bool profile_report;
+static bool profile_inclusive;
+
+
+/**
+ * Writes the binary syntax tree file for the given tree to ast_output.
+ */
+static bool write_ast_output(const char *prg, const token_stream &tokens, const syntax_tree_node *root, FILE *diag)
 {
-    switch (tok->type)
-    {
-        case token::IDENTIFIER:  printf("%-*s %s\n", spacing, "Identifier:", reinterpret_cast<identifier_token *>(tok)->value); break;
-        case token::LIT_BOOL:    printf("%-*s %s\n", spacing, "Bool literal:", reinterpret_cast<lit_bool_token *>(tok)->value ? "true" : "false"); break;
-        case token::LIT_FLOAT:   printf("%-*s %Lg\n", spacing, "Float literal:", reinterpret_cast<lit_float_token *>(tok)->value); break;
-        case token::LIT_INTEGER:
-            if (reinterpret_cast<lit_integer_token *>(tok)->type & lit_integer_token::UNSIGNED)
-                                 printf("%-*s %llu\n", spacing, "Integer literal:", reinterpret_cast<lit_integer_token *>(tok)->value.u);
-            else
-                                 printf("%-*s %lli\n", spacing, "Integer literal:", reinterpret_cast<lit_integer_token *>(tok)->value.s);
-            break;
-        case token::LIT_POINTER: printf("%-*s %p\n", spacing, "Pointer literal:", reinterpret_cast<lit_pointer_token *>(tok)->value); break;
-        case token::LIT_STRING:  printf("%-*s %s\n", spacing, "String literal:", tok->content); break;
-        case token::LIT_CHAR:    printf("%-*s %s (%u)\n", spacing, "Char literal:", tok->content, reinterpret_cast<lit_char_token *>(tok)->value); break;
-        case token::OPERATOR:    printf("%-*s %s\n", spacing, "Operator:", reinterpret_cast<operator_token *>(tok)->value); break;
-        default:                 printf("Unknown token %2i: %s\n", tok->type, tok->content);
+    int fd = open(ast_output, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if ((fd < 0) || !write_ast_file(fd, tokens, root) || (close(fd) < 0))
+    {
+        fprintf(diag, "%s: Could not write %s: %s\n", prg, ast_output, strerror(errno));
+        if (fd >= 0)
+            close(fd);
+        return false;
+    }
+
+    return true;
+}
+
+
+/**
+ * Parses the given header as the prefix of translation units to come and
+ * writes its snapshot, including the macros it defines, to prefix_output.
+ */
+static bool write_prefix_output(const char *prg, const char *file)
+{
+    source_file source;
+    if (!source.load(file))
+    {
+        fprintf(stderr, "%s: Could not open %s: %s\n", prg, file, strerror(errno));
+        return false;
     }
+
+    if (!strcmp(file, "-"))
+        file = "<stdin>";
+
+    arena prefix_arena;
+    token_source raw(preprocessed ? source.text() : "");
+    preprocessor pp(&includes, &pp_opts);
+
+    try
+    {
+        if (preprocessed)
+            raw.drain();
+        else
+        {
+            pp.run(file, source.text());
+            for (const auto &w: pp.warnings)
+                w->emit(stderr, prg, file, source.text());
+        }
+
+        token_stream &tokens = preprocessed ? raw.tokens : pp.tokens;
+        parse_prefix snapshot;
+        build_prefix(tokens, &prefix_arena, &snapshot);
+
+        int fd = open(prefix_output, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+        if ((fd < 0) || !write_prefix_file(fd, file, tokens, snapshot, preprocessed ? "" : pp.macro_definitions()) ||
+            (close(fd) < 0))
+        {
+            fprintf(stderr, "%s: Could not write %s: %s\n", prg, prefix_output, strerror(errno));
+            if (fd >= 0)
+                close(fd);
+            return false;
+        }
+    }
+    catch (error *e)
+    {
+        e->emit(stderr, prg, file, source.text());
+        delete e;
+        return false;
+    }
+
+    return true;
 }
 
-static void dump_syntax_tree(syntax_tree_node *node, int indentation)
+
+/**
+ * Reads ("-" is stdin), preprocesses, tokenizes and parses the given file,
+ * dumping its tokens and syntax tree to out and diagnostics to diag. All
+ * memory used for tokens and nodes comes from tu_arena and is released to it
+ * again before returning. Returns false on error.
+ */
+static bool process_file(const char *prg, const char *file, arena *tu_arena, dump_buffer *out, FILE *diag)
 {
-    printf("%*s%s", indentation, "", parser_type_names[node->type]);
+    source_file source;
+    if (!source.load(file))
+    {
+        out->flush();
+        fprintf(diag, "%s: Could not open %s: %s\n", prg, file, strerror(errno));
+        return false;
+    }
+
+    if (!strcmp(file, "-"))
+        file = "<stdin>";
+
+    arena::mark tu_start = tu_arena->get_mark();
+
+    // Preprocessed input is tokenized while parsing, everything else all at
+    // once by the preprocessor (only one of these is used)
+    token_source raw(preprocessed ? source.text() : "");
+    preprocessor pp(&includes, &pp_opts);
+    if (pipelined)
+        raw.run_pipelined();
+
+    // The unit's tokens following the prefix's (if there is one)
+    prefixed_unit unit;
+
+    syntax_tree_node *root = nullptr;
+    error *failure = nullptr;
+
+    try
+    {
+        if (preprocessed && !prefix)
+            root = build_syntax_tree(raw, tu_arena);
+        else
+        {
+            if (preprocessed)
+                raw.drain();
+            else
+            {
+                pp.run(file, source.text());
+
+                if (!pp.warnings.empty())
+                {
+                    out->flush();
+                    for (const auto &w: pp.warnings)
+                        w->emit(diag, prg, file, source.text());
+                }
+            }
+
+            if (prefix)
+            {
+                prefix->start_unit(file, preprocessed ? raw.tokens : pp.tokens, tu_arena, &unit);
+                root = build_syntax_tree(unit.tokens, tu_arena, &unit.prefix);
+            }
+            else
+                root = build_syntax_tree(pp.tokens, tu_arena);
+        }
+    }
+    catch (error *e)
+    {
+        failure = e;
+    }
+
+    const token_stream &tokens = prefix ? unit.tokens : preprocessed ? raw.tokens : pp.tokens;
+    bool success = !failure;
 
-    if (node->type != syntax_tree_node::TOKEN)
-        putchar('\n');
+    if (ast_output)
+    {
+        if (root)
+            success = write_ast_output(prg, tokens, root, diag);
+    }
     else
     {
-        printf(": ");
-        dump_token(node->ass_token, 0);
+        // Syntax errors are only reported once everything has been tokenized;
+        // there are no tokens to show if that (or preprocessing) failed
+        if (preprocessed ? raw.exhausted() : pp.done())
+            for (token_index tok = 0; tok < tokens.size(); tok++)
+                dump_token(out, tokens, tok, 16);
+
+        if (root)
+            dump_syntax_tree(out, tokens, root);
+    }
+
+    if (failure)
+    {
+        out->flush();
+        failure->emit(diag, prg, file, source.text());
+        delete failure;
     }
 
-    for (syntax_tree_node *c: node->children)
-        dump_syntax_tree(c, indentation + 2);
+    tu_arena->rollback(tu_start);
+
+    return success;
+}
+
+
+/**
+ * Prints the counters of all rules entered while parsing (most expensive
+ * first), with the outcome of every alternative as matched/tried.
+ */
+static void print_profile(FILE *fp)
+{
+    std::vector<rule_profile> rules = parse_profile();
+
+    std::sort(rules.begin(), rules.end(), [](const rule_profile &a, const rule_profile &b) {
+        return profile_inclusive ? (a.inclusive > b.inclusive) : (a.exclusive > b.exclusive);
+    });
+
+    uint64_t total = 0;
+    for (const rule_profile &rp: rules)
+        total += rp.exclusive;
+
+    fprintf(fp, "%-36s %10s %10s %10s %10s %10s %10s %12s %12s %7s  %s\n", "rule", "calls", "matched", "failed",
+            "tokens", "nodes", "discarded", "incl. Mtick", "excl. Mtick", "excl. %", "alternatives");
+
+    for (const rule_profile &rp: rules)
+    {
+        fprintf(fp, "%-36s %10llu %10llu %10llu %10llu %10llu %10llu %12.3f %12.3f %7.2f ",
+                parser_type_names[rp.rule], static_cast<unsigned long long>(rp.entries),
+                static_cast<unsigned long long>(rp.successes), static_cast<unsigned long long>(rp.failures),
+                static_cast<unsigned long long>(rp.tokens), static_cast<unsigned long long>(rp.nodes),
+                static_cast<unsigned long long>(rp.discarded), rp.inclusive / 1e6, rp.exclusive / 1e6,
+                total ? 100. * rp.exclusive / total : 0.);
+
+        for (size_t a = 0; a < rp.attempts.size(); a++)
+            fprintf(fp, " %llu/%llu", static_cast<unsigned long long>(rp.matches[a]),
+                    static_cast<unsigned long long>(rp.attempts[a]));
+        fputc('\n', fp);
+    }
+}
+
+
+// Output of a translation unit processed by a -j worker, kept until all
+// units before it have been written
+struct unit_output
+{
+    memory_sink dump;
+    char *diagnostics;
+    size_t diagnostics_length;
+    bool done, success;
+
+    unit_output(void): diagnostics(nullptr), diagnostics_length(0), done(false), success(false) {}
+};
+
+
+/**
+ * Processes the given files on the given number of threads. The output is the
+ * same as when processing them one after another: every unit's dump and
+ * diagnostics are written as soon as all units before it have been, and
+ * nothing after the first failing unit is written.
+ */
+static bool process_files_parallel(const char *prg, const std::vector<const char *> &files, int jobs)
+{
+    thread_pool pool(jobs);
+    std::unique_ptr<arena[]> worker_arenas(new arena[pool.workers()]);
+
+    std::vector<unit_output> outputs(files.size());
+    fd_sink out(STDOUT_FILENO);
+    std::mutex output_lock;
+    size_t next_output = 0;
+    std::atomic<bool> failed(false);
+
+    pool.run(files.size(), [&](size_t unit, int worker) {
+        unit_output &uo = outputs[unit];
+
+        // Units after a failed one are never written
+        if (!failed.load(std::memory_order_relaxed))
+        {
+            FILE *diagnostics = open_memstream(&uo.diagnostics, &uo.diagnostics_length);
+            {
+                dump_buffer dump(&uo.dump);
+                uo.success = process_file(prg, files[unit], &worker_arenas[worker], &dump, diagnostics);
+            }
+            fclose(diagnostics);
+        }
+
+        std::lock_guard<std::mutex> guard(output_lock);
+        uo.done = true;
+
+        while (!failed.load(std::memory_order_relaxed) && (next_output < outputs.size()) && outputs[next_output].done)
+        {
+            unit_output &o = outputs[next_output++];
+
+            if (!out.write(o.dump.contents.data(), o.dump.contents.size()))
+            {
+                fprintf(stderr, "%s: Could not write output: %s\n", prg, strerror(errno));
+                o.success = false;
+            }
+            fwrite(o.diagnostics, 1, o.diagnostics_length, stderr);
+
+            std::vector<char>().swap(o.dump.contents);
+            free(o.diagnostics);
+
+            if (!o.success)
+                failed.store(true, std::memory_order_relaxed);
+        }
+    });
+
+    // Units finished after the failing one have not been written
+    for (size_t i = next_output; i < outputs.size(); i++)
+        free(outputs[i].diagnostics);
+
+    return !failed.load();
 }
 
 
 int main(int argc, char *argv[])
 {
-    if (argc < 2)
+    std::vector<const char *> files;
+    const char *prefix_path = nullptr;
+    int jobs = 1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strncmp(argv[i], "-j", 2))
+        {
+            const char *count = argv[i][2] ? argv[i] + 2 : ((i + 1 < argc) ? argv[++i] : "");
+            char *end;
+            jobs = strtol(count, &end, 10);
+
+            if (!*count || *end || (jobs < 0))
+            {
+                fprintf(stderr, "%s: -j expects a number of jobs (0 for one per CPU)\n", argv[0]);
+                return 1;
+            }
+
+            if (!jobs)
+                jobs = std::max(1u, std::thread::hardware_concurrency());
+        }
+        else if (!strcmp(argv[i], "-p"))
+            pipelined = true;
+        else if (!strcmp(argv[i], "-o") && (i + 1 < argc))
+            ast_output = argv[++i];
+        else if (!strncmp(argv[i], "-I", 2) || !strncmp(argv[i], "-D", 2) || !strncmp(argv[i], "-U", 2))
+        {
+            char option = argv[i][1];
+            const char *arg = argv[i][2] ? argv[i] + 2 : ((i + 1 < argc) ? argv[++i] : "");
+            if (!*arg)
+            {
+                fprintf(stderr, "%s: -%c expects an argument\n", argv[0], option);
+                return 1;
+            }
+
+            if (option == 'I')
+                pp_opts.include_paths.push_back(arg);
+            else if (option == 'U')
+                pp_opts.definitions += std::string("#undef ") + arg + "\n";
+            else
+            {
+                // -D name=value defines name as value, -D name as 1
+                const char *eq = strchr(arg, '=');
+                if (eq)
+                    pp_opts.definitions += "#define " + std::string(arg, eq) + " " + (eq + 1) + "\n";
+                else
+                    pp_opts.definitions += std::string("#define ") + arg + " 1\n";
+            }
+        }
+        else if (!strcmp(argv[i], "-fpreprocessed"))
+            preprocessed = true;
+        else if (!strcmp(argv[i], "-write-prefix") && (i + 1 < argc))
+            prefix_output = argv[++i];
+        else if (!strcmp(argv[i], "-include-prefix") && (i + 1 < argc))
+            prefix_path = argv[++i];
+        else if (!strcmp(argv[i], "-profile") || !strcmp(argv[i], "-profile=exclusive"))
+            profile_report = true;
+        else if (!strcmp(argv[i], "-profile=inclusive"))
+            profile_report = profile_inclusive = true;
+        else
+            files.push_back(argv[i]);
+    }
+
+    if (files.empty())
     {
         fprintf(stderr, "%s: no input files\n", argv[0]);
         return 1;
     }
 
-    for (int i = 1; i < argc; i++)
+    if (ast_output && (files.size() > 1))
+    {
+        fprintf(stderr, "%s: -o expects a single input file\n", argv[0]);
+        return 1;
+    }
+
+    if (pipelined && !preprocessed)
+    {
+        fprintf(stderr, "%s: -p expects already preprocessed input (-fpreprocessed)\n", argv[0]);
+        return 1;
+    }
+
+    if (profile_report && !parser_profiling())
     {
-        FILE *fp = fopen(argv[i], "r");
-        if (!fp)
+        fprintf(stderr, "%s: -profile expects a parser generated with --profile (make GENFLAGS=--profile)\n", argv[0]);
+        return 1;
+    }
+
+    if (prefix_output)
+    {
+        if ((files.size() > 1) || ast_output || prefix_path)
         {
-            fprintf(stderr, "%s: Could not open %s: %s\n", argv[0], argv[i], strerror(errno));
+            fprintf(stderr, "%s: -write-prefix expects a single input file (and neither -o nor -include-prefix)\n", argv[0]);
             return 1;
         }
 
-        fseek(fp, 0, SEEK_END);
-        off_t len = ftell(fp);
-        rewind(fp);
-
-        char *buf = new char[len + 1];
-        fread(buf, 1, len, fp);
-        buf[len] = 0;
-        fclose(fp);
+        return write_prefix_output(argv[0], files[0]) ? 0 : 1;
+    }
 
-        try
+    std::unique_ptr<prefix_file> prefix_snapshot;
+    if (prefix_path)
+    {
+        prefix_snapshot.reset(new prefix_file);
+        if (!prefix_snapshot->load(prefix_path))
         {
-            std::vector<token *> token_list = tokenize(buf);
+            fprintf(stderr, "%s: Could not load prefix %s: %s\n", argv[0], prefix_path, strerror(errno));
+            return 1;
+        }
 
-            for (auto tok: token_list)
-                dump_token(tok, 16);
+        // The prefix's macros are defined before anything on the command line
+        prefix = prefix_snapshot.get();
+        pp_opts.definitions = prefix->definitions() + pp_opts.definitions;
+    }
 
-            syntax_tree_node *root = build_syntax_tree(token_list);
+    bool success = true;
 
-            dump_syntax_tree(root, 0);
+    if ((jobs > 1) && (files.size() > 1))
+        success = process_files_parallel(argv[0], files, std::min<size_t>(jobs, files.size()));
+    else
+    {
+        arena tu_arena;
+        fd_sink out_sink(STDOUT_FILENO);
+        dump_buffer out(&out_sink);
 
-            for (auto tok: token_list)
-                delete tok;
+        for (const char *file: files)
+            if (!(success = process_file(argv[0], file, &tu_arena, &out, stderr)))
+                break;
 
-            delete[] buf;
-        }
-        catch (error *e)
+        if (!out.flush())
         {
-            e->emit(argv[0], argv[1], buf);
-            return 1;
+            fprintf(stderr, "%s: Could not write output: %s\n", argv[0], strerror(errno));
+            success = false;
         }
     }
 
-    return 0;
+    // Covers the failed unit as well
+    if (profile_report)
+        print_profile(stderr);
+
+    return success ? 0 : 1;
 }
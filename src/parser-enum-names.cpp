@@ -0,0 +1,210 @@
+#include "parser.hpp"
+
+const char *const parser_type_names[] = {
+    "token",
+    "translation-unit",
+    "primary-expression",
+    "literal",
+    "id-expression",
+    "unqualified-id",
+    "qualified-id",
+    "nested-name-specifier-repeatable",
+    "nested-name-specifier-start",
+    "nested-name-specifier",
+    "lambda-expression",
+    "lambda-introducer",
+    "lambda-capture",
+    "capture-default",
+    "capture-list",
+    "capture",
+    "lambda-declarator",
+    "postfix-expression-repeatable",
+    "postfix-expression-start",
+    "postfix-expression",
+    "expression-list",
+    "pseudo-destructor-name",
+    "unary-expression",
+    "unary-operator",
+    "new-expression",
+    "new-placement",
+    "new-type-id",
+    "new-declarator",
+    "noptr-new-declarator",
+    "new-initializer",
+    "delete-expression",
+    "noexcept-expression",
+    "cast-expression",
+    "pm-operator",
+    "pm-expression",
+    "multiplicative-operator",
+    "multiplicative-expression",
+    "additive-operator",
+    "additive-expression",
+    "shift-operator",
+    "shift-expression",
+    "relational-operator",
+    "relational-expression",
+    "equality-operator",
+    "equality-expression",
+    "and-expression",
+    "exclusive-or-expression",
+    "inclusive-or-expression",
+    "logical-and-expression",
+    "logical-or-expression",
+    "conditional-expression",
+    "assignment-expression",
+    "assignment-operator",
+    "expression",
+    "constant-expression",
+    "statement",
+    "labeled-statement",
+    "expression-statement",
+    "compound-statement",
+    "statement-seq",
+    "selection-statement",
+    "condition",
+    "iteration-statement",
+    "for-init-statement",
+    "for-range-declaration",
+    "for-range-initializer",
+    "jump-statement",
+    "declaration-statement",
+    "declaration-seq",
+    "declaration",
+    "block-declaration",
+    "alias-declaration",
+    "simple-declaration",
+    "static_assert-declaration",
+    "empty-declaration",
+    "attribute-declaration",
+    "decl-specifier",
+    "decl-specifier-seq",
+    "storage-class-specifier",
+    "function-specifier",
+    "type-specifier",
+    "trailing-type-specifier",
+    "type-specifier-seq",
+    "trailing-type-specifier-seq",
+    "simple-type-specifier",
+    "type-name",
+    "decltype-specifier",
+    "elaborated-type-specifier",
+    "enum-specifier",
+    "enum-head",
+    "opaque-enum-declaration",
+    "enum-key",
+    "enum-base",
+    "enumerator-list",
+    "enumerator-definition",
+    "enumerator",
+    "namespace-name",
+    "namespace-definition",
+    "named-namespace-definition",
+    "original-namespace-definition",
+    "extension-namespace-definition",
+    "unnamed-namespace-definition",
+    "namespace-body",
+    "namespace-alias-definition",
+    "qualified-namespace-specifier",
+    "using-declaration",
+    "using-directive",
+    "asm-definition",
+    "linkage-specification",
+    "attribute-specifier-seq",
+    "attribute-specifier",
+    "gcc-attribute-specifier-seq",
+    "gcc-attribute-specifier",
+    "alignment-specifier",
+    "attribute-list-entry",
+    "attribute-list",
+    "attribute",
+    "attribute-token",
+    "attribute-scoped-token",
+    "attribute-namespace",
+    "attribute-argument-clause",
+    "balanced-token-seq",
+    "balanced-token",
+    "init-declarator-list",
+    "init-declarator",
+    "declarator",
+    "ptr-declarator",
+    "noptr-declarator-repeatable",
+    "noptr-declarator-start",
+    "noptr-declarator",
+    "parameters-and-qualifiers",
+    "trailing-return-type",
+    "ptr-operator",
+    "cv-qualifier-seq",
+    "cv_qualifier",
+    "ref-qualifier",
+    "declarator-id",
+    "type-id",
+    "abstract-declarator",
+    "ptr-abstract-declarator",
+    "noptr-abstract-declarator-repeatable",
+    "noptr-abstract-declarator-start",
+    "noptr-abstract-declarator",
+    "abstract-pack-declarator",
+    "noptr-abstract-pack-declarator-repeatable",
+    "noptr-abstract-pack-declarator-start",
+    "noptr-abstract-pack-declarator",
+    "parameter-declaration-clause",
+    "parameter-declaration-list",
+    "parameter-declaration",
+    "function-definition",
+    "function-body",
+    "initializer",
+    "brace-or-equal-initializer",
+    "initializer-clause",
+    "initializer-list",
+    "braced-init-list",
+    "class-specifier",
+    "class-head",
+    "class-head-name",
+    "class-virt-specifier",
+    "class-key",
+    "member-specification",
+    "member-declaration",
+    "member-declarator-list",
+    "member-declarator",
+    "virt-specifier-seq",
+    "virt-specifier",
+    "pure-specifier",
+    "base-clause",
+    "base-specifier-list",
+    "base-specifier",
+    "class-or-decltype",
+    "base-type-specifier",
+    "access-specifier",
+    "conversion-function-id",
+    "conversion-type-id",
+    "conversion-declarator",
+    "ctor-initializer",
+    "mem-initializer-list",
+    "mem-initializer",
+    "mem-initializer-id",
+    "operator-function-id",
+    "literal-operator-id",
+    "template-declaration",
+    "template-parameter-list",
+    "template-parameter",
+    "type-parameter",
+    "simple-template-id",
+    "template-id",
+    "template-argument-list",
+    "template-argument",
+    "typename-specifier",
+    "explicit-instantiation",
+    "explicit-specialization",
+    "try-block",
+    "function-try-block",
+    "handler-seq",
+    "handler",
+    "exception-declaration",
+    "throw-expression",
+    "exception-specification",
+    "dynamic-exception-specification",
+    "type-id-list",
+    "noexcept-specification",
+#include "parser-enum-names-supplement.cxx"
+};
@@ -0,0 +1,23676 @@
+static syntax_tree_node *sv_translation_unit(parser_context *ctx, range_t b, bool *success)
+{
+    bool could_parse;
+
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TRANSLATION_UNIT, nullptr);
+
+    // translation-unit:
+    //   [declaration-seq]
+
+    range_t m = b;
+
+
+    m = sv_declaration_seq(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return node;
+
+
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return node;
+}
+
+
+static range_t sv_primary_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x2;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_THIS: viable |= 0x8; break;
+                    default: break;
+                }
+                break;
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x10;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x2; break;
+                    case ATOM_TILDE: viable |= 0x2; break;
+                    case ATOM_LPAREN: viable |= 0x4; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::PRIMARY_EXPRESSION, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // primary-expression:
+    //   lambda-expression
+    //   id-expression
+    //   operator("(") expression operator(")")
+    //   keyword("this")
+    //   literal
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_primary_expression_part_1;
+
+    m = sv_lambda_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_primary_expression_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_primary_expression_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_primary_expression_part_2;
+
+    m = sv_id_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_primary_expression_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_primary_expression_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_primary_expression_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_primary_expression_part_3;
+
+    m = sv_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_primary_expression_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_primary_expression_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_primary_expression_part_3:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_primary_expression_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_THIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_primary_expression_part_4;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_primary_expression_part_4:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x10))
+        goto sv_primary_expression_part_5;
+
+    m = sv_literal(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_primary_expression_part_5;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_primary_expression_part_5:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_literal(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::LIT_INTEGER:
+                viable = 0x1;
+                break;
+            case token::LIT_FLOAT:
+                viable = 0x2;
+                break;
+            case token::LIT_BOOL:
+                viable = 0x4;
+                break;
+            case token::LIT_POINTER:
+                viable = 0x8;
+                break;
+            case token::LIT_STRING:
+                viable = 0x10;
+                break;
+            case token::LIT_CHAR:
+                viable = 0x20;
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::LITERAL, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // literal:
+    //   lit-integer()
+    //   lit-float()
+    //   lit-bool()
+    //   lit-pointer()
+    //   lit-string()
+    //   lit-char()
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_literal_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::LIT_INTEGER))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_literal_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_literal_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_literal_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::LIT_FLOAT))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_literal_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_literal_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_literal_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::LIT_BOOL))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_literal_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_literal_part_3:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_literal_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::LIT_POINTER))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_literal_part_4;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_literal_part_4:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x10))
+        goto sv_literal_part_5;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::LIT_STRING))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_literal_part_5;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_literal_part_5:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x20))
+        goto sv_literal_part_6;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::LIT_CHAR))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_literal_part_6;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_literal_part_6:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_id_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x3;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ID_EXPRESSION, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // id-expression:
+    //   qualified-id
+    //   unqualified-id
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_id_expression_part_1;
+
+    m = sv_qualified_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_id_expression_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_id_expression_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_id_expression_part_2;
+
+    m = sv_unqualified_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_id_expression_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_id_expression_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_unqualified_id(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x41;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_OPERATOR: viable |= 0x38; break;
+                    default: break;
+                }
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_TILDE: viable |= 0x6; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::UNQUALIFIED_ID, parent);
+    parse_mark children_mark = mark_parse(ctx);
+    push_null_namespace(ctx, node);
+
+    // unqualified-id:
+    //   template-id
+    //   operator("~") decltype-specifier
+    //   operator("~") class-name
+    //   literal-operator-id
+    //   conversion-function-id
+    //   operator-function-id
+    //   identifier()
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_unqualified_id_part_1;
+
+    m = sv_template_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_unqualified_id_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_unqualified_id_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_unqualified_id_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_TILDE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unqualified_id_part_2;
+
+    m = sv_decltype_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_unqualified_id_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_unqualified_id_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_unqualified_id_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_TILDE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unqualified_id_part_3;
+
+    m = sv_class_name(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_unqualified_id_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_unqualified_id_part_3:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_unqualified_id_part_4;
+
+    m = sv_literal_operator_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_unqualified_id_part_4;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_unqualified_id_part_4:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x10))
+        goto sv_unqualified_id_part_5;
+
+    m = sv_conversion_function_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_unqualified_id_part_5;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_unqualified_id_part_5:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x20))
+        goto sv_unqualified_id_part_6;
+
+    m = sv_operator_function_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_unqualified_id_part_6;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_unqualified_id_part_6:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x40))
+        goto sv_unqualified_id_part_7;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unqualified_id_part_7;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_unqualified_id_part_7:
+    clear_nested_name_specifier(ctx, node);
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_qualified_id(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x10;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x1f; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::QUALIFIED_ID, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // qualified-id:
+    //   operator("::") template-id
+    //   operator("::") literal-operator-id
+    //   operator("::") operator-function-id
+    //   operator("::") identifier()
+    //   nested-name-specifier [keyword("template")] unqualified-id
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_qualified_id_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SCOPE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_qualified_id_part_1;
+
+    m = sv_template_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_qualified_id_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_qualified_id_part_1:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_qualified_id_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SCOPE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_qualified_id_part_2;
+
+    m = sv_literal_operator_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_qualified_id_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_qualified_id_part_2:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_qualified_id_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SCOPE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_qualified_id_part_3;
+
+    m = sv_operator_function_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_qualified_id_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_qualified_id_part_3:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_qualified_id_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SCOPE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_qualified_id_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_qualified_id_part_4;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_qualified_id_part_4:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x10))
+        goto sv_qualified_id_part_5;
+
+    m = sv_nested_name_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_qualified_id_part_5;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_TEMPLATE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    m = sv_unqualified_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_qualified_id_part_5;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_qualified_id_part_5:
+    clear_nested_name_specifier(ctx, node);
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_nested_name_specifier_repeatable(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x7;
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NESTED_NAME_SPECIFIER_REPEATABLE, parent, true);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // nested-name-specifier-repeatable:
+    //   [keyword("template")] simple-template-id operator("::")
+    //   namespace-name operator("::")
+    //   type-name operator("::")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_nested_name_specifier_repeatable_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_TEMPLATE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    m = sv_simple_template_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_nested_name_specifier_repeatable_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SCOPE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_nested_name_specifier_repeatable_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    nested_name_specifier_repeatable_done(ctx, node);
+    return m;
+
+
+sv_nested_name_specifier_repeatable_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_nested_name_specifier_repeatable_part_2;
+
+    m = sv_namespace_name(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_nested_name_specifier_repeatable_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SCOPE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_nested_name_specifier_repeatable_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    nested_name_specifier_repeatable_done(ctx, node);
+    return m;
+
+
+sv_nested_name_specifier_repeatable_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_nested_name_specifier_repeatable_part_3;
+
+    m = sv_type_name(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_nested_name_specifier_repeatable_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SCOPE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_nested_name_specifier_repeatable_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    nested_name_specifier_repeatable_done(ctx, node);
+    return m;
+
+
+sv_nested_name_specifier_repeatable_part_3:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_nested_name_specifier_start(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x6;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_DECLTYPE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x6; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NESTED_NAME_SPECIFIER_START, parent, true);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // nested-name-specifier-start:
+    //   decltype-specifier operator("::")
+    //   [operator("::")] namespace-name operator("::")
+    //   [operator("::")] type-name operator("::")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_nested_name_specifier_start_part_1;
+
+    m = sv_decltype_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_nested_name_specifier_start_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SCOPE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_nested_name_specifier_start_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    nested_name_specifier_start_done(ctx, node);
+    return m;
+
+
+sv_nested_name_specifier_start_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_nested_name_specifier_start_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SCOPE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    m = sv_namespace_name(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_nested_name_specifier_start_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SCOPE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_nested_name_specifier_start_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    nested_name_specifier_start_done(ctx, node);
+    return m;
+
+
+sv_nested_name_specifier_start_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_nested_name_specifier_start_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SCOPE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    m = sv_type_name(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_nested_name_specifier_start_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SCOPE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_nested_name_specifier_start_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    nested_name_specifier_start_done(ctx, node);
+    return m;
+
+
+sv_nested_name_specifier_start_part_3:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_nested_name_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NESTED_NAME_SPECIFIER, parent);
+
+    // nested-name-specifier:
+    //   nested-name-specifier-start { nested-name-specifier-repeatable }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_nested_name_specifier_part_1;
+
+    m = sv_nested_name_specifier_start(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_nested_name_specifier_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_nested_name_specifier_repeatable(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_nested_name_specifier_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_lambda_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::LAMBDA_EXPRESSION, parent);
+
+    // lambda-expression:
+    //   lambda-introducer [lambda-declarator] compound-statement
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_lambda_expression_part_1;
+
+    m = sv_lambda_introducer(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_lambda_expression_part_1;
+
+    m = sv_lambda_declarator(ctx, node, m, &could_parse);
+
+    m = sv_compound_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_lambda_expression_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_lambda_expression_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_lambda_introducer(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::LAMBDA_INTRODUCER, parent);
+
+    // lambda-introducer:
+    //   operator("[") [lambda-capture] operator("]")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_lambda_introducer_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LBRACKET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_lambda_introducer_part_1;
+
+    m = sv_lambda_capture(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RBRACKET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_lambda_introducer_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_lambda_introducer_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_lambda_capture(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x2;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ASSIGN: viable |= 0x5; break;
+                    case ATOM_AMP: viable |= 0x7; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::LAMBDA_CAPTURE, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // lambda-capture:
+    //   capture-default operator(",") capture-list
+    //   capture-list
+    //   capture-default
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_lambda_capture_part_1;
+
+    m = sv_capture_default(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_lambda_capture_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COMMA))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_lambda_capture_part_1;
+
+    m = sv_capture_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_lambda_capture_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_lambda_capture_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_lambda_capture_part_2;
+
+    m = sv_capture_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_lambda_capture_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_lambda_capture_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_lambda_capture_part_3;
+
+    m = sv_capture_default(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_lambda_capture_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_lambda_capture_part_3:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_capture_default(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ASSIGN: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::CAPTURE_DEFAULT, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // capture-default:
+    //   operator("=")
+    //   operator("&")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_capture_default_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ASSIGN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_capture_default_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_capture_default_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_capture_default_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_AMP))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_capture_default_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_capture_default_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_capture_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_AMP: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::CAPTURE_LIST, parent);
+
+    // capture-list:
+    //   capture [operator("...")] { operator(",") capture [operator("...")] }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_capture_list_part_1;
+
+    m = sv_capture(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_capture_list_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ELLIPSIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COMMA))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_capture(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ELLIPSIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_capture_list_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_capture(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x4;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_THIS: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_AMP: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::CAPTURE, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // capture:
+    //   keyword("this")
+    //   operator("&") identifier()
+    //   identifier()
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_capture_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_THIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_capture_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_capture_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_capture_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_AMP))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_capture_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_capture_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_capture_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_capture_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_capture_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_capture_part_3:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_lambda_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::LAMBDA_DECLARATOR, parent);
+
+    // lambda-declarator:
+    //   operator("(") parameter-declaration-clause operator(")") [keyword("mutable")] [exception-specification] [attribute-specifier-seq] [trailing-return-type]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_lambda_declarator_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_lambda_declarator_part_1;
+
+    m = sv_parameter_declaration_clause(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_lambda_declarator_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_lambda_declarator_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_MUTABLE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    m = sv_exception_specification(ctx, node, m, &could_parse);
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_trailing_return_type(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_lambda_declarator_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_postfix_expression_repeatable(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_MINUS_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x2; break;
+                    case ATOM_ARROW: viable |= 0x14; break;
+                    case ATOM_DOT: viable |= 0x28; break;
+                    case ATOM_LPAREN: viable |= 0x40; break;
+                    case ATOM_LBRACKET: viable |= 0x180; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::POSTFIX_EXPRESSION_REPEATABLE, parent, true);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // postfix-expression-repeatable:
+    //   operator("--")
+    //   operator("++")
+    //   operator("->") pseudo-destructor-name
+    //   operator(".") pseudo-destructor-name
+    //   operator("->") [keyword("template")] id-expression
+    //   operator(".") [keyword("template")] id-expression
+    //   operator("(") [expression-list] operator(")")
+    //   operator("[") braced-init-list operator("]")
+    //   operator("[") expression operator("]")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_postfix_expression_repeatable_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_MINUS_MINUS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_repeatable_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_postfix_expression_repeatable_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_postfix_expression_repeatable_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_PLUS_PLUS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_repeatable_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_postfix_expression_repeatable_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_postfix_expression_repeatable_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ARROW))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_repeatable_part_3;
+
+    m = sv_pseudo_destructor_name(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_postfix_expression_repeatable_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_postfix_expression_repeatable_part_3:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_postfix_expression_repeatable_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_DOT))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_repeatable_part_4;
+
+    m = sv_pseudo_destructor_name(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_postfix_expression_repeatable_part_4;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_postfix_expression_repeatable_part_4:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x10))
+        goto sv_postfix_expression_repeatable_part_5;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ARROW))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_repeatable_part_5;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_TEMPLATE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    m = sv_id_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_postfix_expression_repeatable_part_5;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_postfix_expression_repeatable_part_5:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x20))
+        goto sv_postfix_expression_repeatable_part_6;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_DOT))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_repeatable_part_6;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_TEMPLATE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    m = sv_id_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_postfix_expression_repeatable_part_6;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_postfix_expression_repeatable_part_6:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x40))
+        goto sv_postfix_expression_repeatable_part_7;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_repeatable_part_7;
+
+    m = sv_expression_list(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_repeatable_part_7;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_postfix_expression_repeatable_part_7:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x80))
+        goto sv_postfix_expression_repeatable_part_8;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LBRACKET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_repeatable_part_8;
+
+    m = sv_braced_init_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_postfix_expression_repeatable_part_8;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RBRACKET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_repeatable_part_8;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_postfix_expression_repeatable_part_8:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x100))
+        goto sv_postfix_expression_repeatable_part_9;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LBRACKET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_repeatable_part_9;
+
+    m = sv_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_postfix_expression_repeatable_part_9;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RBRACKET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_repeatable_part_9;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_postfix_expression_repeatable_part_9:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_postfix_expression_start(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x680;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_TYPEID: viable |= 0x3; break;
+                    case ATOM_CONST_CAST: viable |= 0x4; break;
+                    case ATOM_REINTERPRET_CAST: viable |= 0x8; break;
+                    case ATOM_STATIC_CAST: viable |= 0x10; break;
+                    case ATOM_DYNAMIC_CAST: viable |= 0x20; break;
+                    case ATOM_TYPENAME: viable |= 0x140; break;
+                    default: break;
+                }
+                break;
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x400;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x680; break;
+                    case ATOM_LPAREN: viable |= 0x400; break;
+                    case ATOM_LBRACKET: viable |= 0x400; break;
+                    case ATOM_TILDE: viable |= 0x400; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::POSTFIX_EXPRESSION_START, parent, true);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // postfix-expression-start:
+    //   keyword("typeid") operator("(") type-id operator(")")
+    //   keyword("typeid") operator("(") expression operator(")")
+    //   keyword("const_cast") operator("<") type-id operator(">") operator("(") expression operator(")")
+    //   keyword("reinterpret_cast") operator("<") type-id operator(">") operator("(") expression operator(")")
+    //   keyword("static_cast") operator("<") type-id operator(">") operator("(") expression operator(")")
+    //   keyword("dynamic_cast") operator("<") type-id operator(">") operator("(") expression operator(")")
+    //   typename-specifier braced-init-list
+    //   simple-type-specifier braced-init-list
+    //   typename-specifier operator("(") [expression-list] operator(")")
+    //   simple-type-specifier operator("(") [expression-list] operator(")")
+    //   primary-expression
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_postfix_expression_start_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_TYPEID))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_1;
+
+    m = sv_type_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_postfix_expression_start_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_postfix_expression_start_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_postfix_expression_start_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_TYPEID))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_2;
+
+    m = sv_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_postfix_expression_start_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_postfix_expression_start_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_postfix_expression_start_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_CONST_CAST))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LESS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_3;
+
+    m = sv_type_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_postfix_expression_start_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_GREATER))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_3;
+
+    m = sv_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_postfix_expression_start_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_postfix_expression_start_part_3:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_postfix_expression_start_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_REINTERPRET_CAST))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LESS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_4;
+
+    m = sv_type_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_postfix_expression_start_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_GREATER))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_4;
+
+    m = sv_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_postfix_expression_start_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_4;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_postfix_expression_start_part_4:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x10))
+        goto sv_postfix_expression_start_part_5;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_STATIC_CAST))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_5;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LESS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_5;
+
+    m = sv_type_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_postfix_expression_start_part_5;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_GREATER))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_5;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_5;
+
+    m = sv_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_postfix_expression_start_part_5;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_5;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_postfix_expression_start_part_5:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x20))
+        goto sv_postfix_expression_start_part_6;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_DYNAMIC_CAST))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_6;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LESS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_6;
+
+    m = sv_type_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_postfix_expression_start_part_6;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_GREATER))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_6;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_6;
+
+    m = sv_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_postfix_expression_start_part_6;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_6;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_postfix_expression_start_part_6:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x40))
+        goto sv_postfix_expression_start_part_7;
+
+    m = sv_typename_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_postfix_expression_start_part_7;
+
+    m = sv_braced_init_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_postfix_expression_start_part_7;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_postfix_expression_start_part_7:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x80))
+        goto sv_postfix_expression_start_part_8;
+
+    m = sv_simple_type_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_postfix_expression_start_part_8;
+
+    m = sv_braced_init_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_postfix_expression_start_part_8;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_postfix_expression_start_part_8:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x100))
+        goto sv_postfix_expression_start_part_9;
+
+    m = sv_typename_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_postfix_expression_start_part_9;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_9;
+
+    m = sv_expression_list(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_9;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_postfix_expression_start_part_9:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x200))
+        goto sv_postfix_expression_start_part_10;
+
+    m = sv_simple_type_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_postfix_expression_start_part_10;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_10;
+
+    m = sv_expression_list(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_postfix_expression_start_part_10;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_postfix_expression_start_part_10:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x400))
+        goto sv_postfix_expression_start_part_11;
+
+    m = sv_primary_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_postfix_expression_start_part_11;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_postfix_expression_start_part_11:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_postfix_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x1;
+                break;
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::POSTFIX_EXPRESSION, parent);
+
+    // postfix-expression:
+    //   postfix-expression-start { postfix-expression-repeatable }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_postfix_expression_part_1;
+
+    m = sv_postfix_expression_start(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_postfix_expression_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_postfix_expression_repeatable(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_postfix_expression_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_expression_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x1;
+                break;
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x1; break;
+                    case ATOM_LBRACE: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_DELETE: viable |= 0x1; break;
+                    case ATOM_NEW: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    case ATOM_EXCLAIM: viable |= 0x1; break;
+                    case ATOM_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::EXPRESSION_LIST, parent);
+
+    // expression-list:
+    //   initializer-list
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_expression_list_part_1;
+
+    m = sv_initializer_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_expression_list_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_expression_list_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_pseudo_destructor_name(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0xe;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_TILDE: viable |= 0x3; break;
+                    case ATOM_SCOPE: viable |= 0xe; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::PSEUDO_DESTRUCTOR_NAME, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // pseudo-destructor-name:
+    //   operator("~") decltype-specifier
+    //   [nested-name-specifier] operator("~") type-name
+    //   nested-name-specifier keyword("template") simple-template-id operator("::") operator("~") type-name
+    //   [nested-name-specifier] type-name operator("::") operator("~") type-name
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_pseudo_destructor_name_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_TILDE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_pseudo_destructor_name_part_1;
+
+    m = sv_decltype_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_pseudo_destructor_name_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_pseudo_destructor_name_part_1:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_pseudo_destructor_name_part_2;
+
+    m = sv_nested_name_specifier(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_TILDE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_pseudo_destructor_name_part_2;
+
+    m = sv_type_name(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_pseudo_destructor_name_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_pseudo_destructor_name_part_2:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_pseudo_destructor_name_part_3;
+
+    m = sv_nested_name_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_pseudo_destructor_name_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_TEMPLATE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_pseudo_destructor_name_part_3;
+
+    m = sv_simple_template_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_pseudo_destructor_name_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SCOPE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_pseudo_destructor_name_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_TILDE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_pseudo_destructor_name_part_3;
+
+    m = sv_type_name(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_pseudo_destructor_name_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_pseudo_destructor_name_part_3:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_pseudo_destructor_name_part_4;
+
+    m = sv_nested_name_specifier(ctx, node, m, &could_parse);
+
+    m = sv_type_name(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_pseudo_destructor_name_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SCOPE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_pseudo_destructor_name_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_TILDE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_pseudo_destructor_name_part_4;
+
+    m = sv_type_name(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_pseudo_destructor_name_part_4;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_pseudo_destructor_name_part_4:
+    clear_nested_name_specifier(ctx, node);
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_unary_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x400;
+                break;
+            case token::IDENTIFIER:
+                viable = 0x400;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_NOEXCEPT: viable |= 0x4; break;
+                    case ATOM_ALIGNOF: viable |= 0x8; break;
+                    case ATOM_SIZEOF: viable |= 0x70; break;
+                    default: break;
+                }
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x403; break;
+                    case ATOM_DELETE: viable |= 0x1; break;
+                    case ATOM_NEW: viable |= 0x2; break;
+                    case ATOM_TILDE: viable |= 0x480; break;
+                    case ATOM_EXCLAIM: viable |= 0x80; break;
+                    case ATOM_MINUS: viable |= 0x80; break;
+                    case ATOM_PLUS: viable |= 0x80; break;
+                    case ATOM_AMP: viable |= 0x80; break;
+                    case ATOM_STAR: viable |= 0x80; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x100; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x200; break;
+                    case ATOM_LPAREN: viable |= 0x400; break;
+                    case ATOM_LBRACKET: viable |= 0x400; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::UNARY_EXPRESSION, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // unary-expression:
+    //   delete-expression
+    //   new-expression
+    //   noexcept-expression
+    //   keyword("alignof") operator("(") type-id operator(")")
+    //   keyword("sizeof") operator("...") operator("(") identifier() operator(")")
+    //   keyword("sizeof") operator("(") type-id operator(")")
+    //   keyword("sizeof") unary-expression
+    //   unary-operator cast-expression
+    //   operator("--") cast-expression
+    //   operator("++") cast-expression
+    //   postfix-expression
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_unary_expression_part_1;
+
+    m = sv_delete_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_unary_expression_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_unary_expression_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_unary_expression_part_2;
+
+    m = sv_new_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_unary_expression_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_unary_expression_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_unary_expression_part_3;
+
+    m = sv_noexcept_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_unary_expression_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_unary_expression_part_3:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_unary_expression_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_ALIGNOF))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unary_expression_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unary_expression_part_4;
+
+    m = sv_type_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_unary_expression_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unary_expression_part_4;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_unary_expression_part_4:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x10))
+        goto sv_unary_expression_part_5;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_SIZEOF))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unary_expression_part_5;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ELLIPSIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unary_expression_part_5;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unary_expression_part_5;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unary_expression_part_5;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unary_expression_part_5;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_unary_expression_part_5:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x20))
+        goto sv_unary_expression_part_6;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_SIZEOF))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unary_expression_part_6;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unary_expression_part_6;
+
+    m = sv_type_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_unary_expression_part_6;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unary_expression_part_6;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_unary_expression_part_6:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x40))
+        goto sv_unary_expression_part_7;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_SIZEOF))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unary_expression_part_7;
+
+    m = sv_unary_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_unary_expression_part_7;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_unary_expression_part_7:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x80))
+        goto sv_unary_expression_part_8;
+
+    m = sv_unary_operator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_unary_expression_part_8;
+
+    m = sv_cast_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_unary_expression_part_8;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_unary_expression_part_8:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x100))
+        goto sv_unary_expression_part_9;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_MINUS_MINUS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unary_expression_part_9;
+
+    m = sv_cast_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_unary_expression_part_9;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_unary_expression_part_9:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x200))
+        goto sv_unary_expression_part_10;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_PLUS_PLUS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unary_expression_part_10;
+
+    m = sv_cast_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_unary_expression_part_10;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_unary_expression_part_10:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x400))
+        goto sv_unary_expression_part_11;
+
+    m = sv_postfix_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_unary_expression_part_11;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_unary_expression_part_11:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_unary_operator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    case ATOM_EXCLAIM: viable |= 0x2; break;
+                    case ATOM_MINUS: viable |= 0x4; break;
+                    case ATOM_PLUS: viable |= 0x8; break;
+                    case ATOM_AMP: viable |= 0x10; break;
+                    case ATOM_STAR: viable |= 0x20; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::UNARY_OPERATOR, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // unary-operator:
+    //   operator("~")
+    //   operator("!")
+    //   operator("-")
+    //   operator("+")
+    //   operator("&")
+    //   operator("*")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_unary_operator_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_TILDE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unary_operator_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_unary_operator_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_unary_operator_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_EXCLAIM))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unary_operator_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_unary_operator_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_unary_operator_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_MINUS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unary_operator_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_unary_operator_part_3:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_unary_operator_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_PLUS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unary_operator_part_4;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_unary_operator_part_4:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x10))
+        goto sv_unary_operator_part_5;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_AMP))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unary_operator_part_5;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_unary_operator_part_5:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x20))
+        goto sv_unary_operator_part_6;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_STAR))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unary_operator_part_6;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_unary_operator_part_6:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_new_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x3; break;
+                    case ATOM_NEW: viable |= 0x3; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NEW_EXPRESSION, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // new-expression:
+    //   [operator("::")] operator("new") [new-placement] operator("(") type-id operator(")") [new-initializer]
+    //   [operator("::")] operator("new") [new-placement] new-type-id [new-initializer]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_new_expression_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SCOPE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_NEW))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_new_expression_part_1;
+
+    m = sv_new_placement(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_new_expression_part_1;
+
+    m = sv_type_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_new_expression_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_new_expression_part_1;
+
+    m = sv_new_initializer(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_new_expression_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_new_expression_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SCOPE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_NEW))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_new_expression_part_2;
+
+    m = sv_new_placement(ctx, node, m, &could_parse);
+
+    m = sv_new_type_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_new_expression_part_2;
+
+    m = sv_new_initializer(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_new_expression_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_new_placement(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NEW_PLACEMENT, parent);
+
+    // new-placement:
+    //   operator("(") expression-list operator(")")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_new_placement_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_new_placement_part_1;
+
+    m = sv_expression_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_new_placement_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_new_placement_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_new_placement_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_new_type_id(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NEW_TYPE_ID, parent);
+
+    // new-type-id:
+    //   type-specifier-seq [new-declarator]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_new_type_id_part_1;
+
+    m = sv_type_specifier_seq(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_new_type_id_part_1;
+
+    m = sv_new_declarator(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_new_type_id_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_new_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_AMP_AMP: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NEW_DECLARATOR, parent);
+
+    // new-declarator:
+    //   { ptr-operator } noptr-new-declarator
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_new_declarator_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_ptr_operator(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    m = sv_noptr_new_declarator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_new_declarator_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_new_declarator_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_noptr_new_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NOPTR_NEW_DECLARATOR, parent);
+
+    // noptr-new-declarator:
+    //   operator("[") expression operator("]") [attribute-specifier-seq] { operator("[") constant-expression operator("]") [attribute-specifier-seq] }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_noptr_new_declarator_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LBRACKET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_noptr_new_declarator_part_1;
+
+    m = sv_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_noptr_new_declarator_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RBRACKET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_noptr_new_declarator_part_1;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LBRACKET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_constant_expression(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RBRACKET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_noptr_new_declarator_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_new_initializer(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACE: viable |= 0x1; break;
+                    case ATOM_LPAREN: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NEW_INITIALIZER, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // new-initializer:
+    //   braced-init-list
+    //   operator("(") [expression-list] operator(")")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_new_initializer_part_1;
+
+    m = sv_braced_init_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_new_initializer_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_new_initializer_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_new_initializer_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_new_initializer_part_2;
+
+    m = sv_expression_list(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_new_initializer_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_new_initializer_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_delete_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x3; break;
+                    case ATOM_DELETE: viable |= 0x3; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::DELETE_EXPRESSION, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // delete-expression:
+    //   [operator("::")] operator("delete") operator("[") operator("]") cast-expression
+    //   [operator("::")] operator("delete") cast-expression
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_delete_expression_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SCOPE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_DELETE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_delete_expression_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LBRACKET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_delete_expression_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RBRACKET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_delete_expression_part_1;
+
+    m = sv_cast_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_delete_expression_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_delete_expression_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_delete_expression_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SCOPE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_DELETE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_delete_expression_part_2;
+
+    m = sv_cast_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_delete_expression_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_delete_expression_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_noexcept_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_NOEXCEPT: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NOEXCEPT_EXPRESSION, parent);
+
+    // noexcept-expression:
+    //   keyword("noexcept") operator("(") expression operator(")")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_noexcept_expression_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_NOEXCEPT))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_noexcept_expression_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_noexcept_expression_part_1;
+
+    m = sv_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_noexcept_expression_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_noexcept_expression_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_noexcept_expression_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_cast_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x1;
+                break;
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_DELETE: viable |= 0x1; break;
+                    case ATOM_NEW: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    case ATOM_EXCLAIM: viable |= 0x1; break;
+                    case ATOM_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::CAST_EXPRESSION, parent);
+
+    // cast-expression:
+    //   { operator("(") type-id operator(")") } unary-expression
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_cast_expression_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_type_id(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    m = sv_unary_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_cast_expression_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_cast_expression_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_pm_operator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ARROW_STAR: viable |= 0x1; break;
+                    case ATOM_DOT_STAR: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::PM_OPERATOR, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // pm-operator:
+    //   operator("->*")
+    //   operator(".*")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_pm_operator_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ARROW_STAR))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_pm_operator_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_pm_operator_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_pm_operator_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_DOT_STAR))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_pm_operator_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_pm_operator_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_pm_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x1;
+                break;
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_DELETE: viable |= 0x1; break;
+                    case ATOM_NEW: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    case ATOM_EXCLAIM: viable |= 0x1; break;
+                    case ATOM_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::PM_EXPRESSION, parent);
+
+    // pm-expression:
+    //   cast-expression { pm-operator cast-expression }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_pm_expression_part_1;
+
+    m = sv_cast_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_pm_expression_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_pm_operator(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_cast_expression(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_pm_expression_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_multiplicative_operator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_PERCENT: viable |= 0x1; break;
+                    case ATOM_SLASH: viable |= 0x2; break;
+                    case ATOM_STAR: viable |= 0x4; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::MULTIPLICATIVE_OPERATOR, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // multiplicative-operator:
+    //   operator("%")
+    //   operator("/")
+    //   operator("*")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_multiplicative_operator_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_PERCENT))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_multiplicative_operator_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_multiplicative_operator_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_multiplicative_operator_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SLASH))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_multiplicative_operator_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_multiplicative_operator_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_multiplicative_operator_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_STAR))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_multiplicative_operator_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_multiplicative_operator_part_3:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_multiplicative_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x1;
+                break;
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_DELETE: viable |= 0x1; break;
+                    case ATOM_NEW: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    case ATOM_EXCLAIM: viable |= 0x1; break;
+                    case ATOM_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::MULTIPLICATIVE_EXPRESSION, parent);
+
+    // multiplicative-expression:
+    //   pm-expression { multiplicative-operator pm-expression }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_multiplicative_expression_part_1;
+
+    m = sv_pm_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_multiplicative_expression_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_multiplicative_operator(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_pm_expression(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_multiplicative_expression_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_additive_operator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ADDITIVE_OPERATOR, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // additive-operator:
+    //   operator("-")
+    //   operator("+")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_additive_operator_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_MINUS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_additive_operator_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_additive_operator_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_additive_operator_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_PLUS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_additive_operator_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_additive_operator_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_additive_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x1;
+                break;
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_DELETE: viable |= 0x1; break;
+                    case ATOM_NEW: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    case ATOM_EXCLAIM: viable |= 0x1; break;
+                    case ATOM_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ADDITIVE_EXPRESSION, parent);
+
+    // additive-expression:
+    //   multiplicative-expression { additive-operator multiplicative-expression }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_additive_expression_part_1;
+
+    m = sv_multiplicative_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_additive_expression_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_additive_operator(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_multiplicative_expression(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_additive_expression_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_shift_operator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_GREATER: viable |= 0x1; break;
+                    case ATOM_LSHIFT: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::SHIFT_OPERATOR, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // shift-operator:
+    //   right-shift
+    //   operator("<<")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_shift_operator_part_1;
+
+    m = sv_right_shift(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_shift_operator_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_shift_operator_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_shift_operator_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LSHIFT))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_shift_operator_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_shift_operator_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_shift_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x1;
+                break;
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_DELETE: viable |= 0x1; break;
+                    case ATOM_NEW: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    case ATOM_EXCLAIM: viable |= 0x1; break;
+                    case ATOM_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::SHIFT_EXPRESSION, parent);
+
+    // shift-expression:
+    //   additive-expression { shift-operator additive-expression }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_shift_expression_part_1;
+
+    m = sv_additive_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_shift_expression_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_shift_operator(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_additive_expression(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_shift_expression_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_relational_operator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_GE: viable |= 0x1; break;
+                    case ATOM_LE: viable |= 0x2; break;
+                    case ATOM_GREATER: viable |= 0x4; break;
+                    case ATOM_LESS: viable |= 0x8; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::RELATIONAL_OPERATOR, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // relational-operator:
+    //   operator(">=")
+    //   operator("<=")
+    //   operator(">")
+    //   operator("<")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_relational_operator_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_GE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_relational_operator_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_relational_operator_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_relational_operator_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_relational_operator_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_relational_operator_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_relational_operator_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_GREATER))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_relational_operator_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_relational_operator_part_3:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_relational_operator_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LESS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_relational_operator_part_4;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_relational_operator_part_4:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_relational_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x1;
+                break;
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_DELETE: viable |= 0x1; break;
+                    case ATOM_NEW: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    case ATOM_EXCLAIM: viable |= 0x1; break;
+                    case ATOM_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::RELATIONAL_EXPRESSION, parent);
+
+    // relational-expression:
+    //   shift-expression { relational-operator shift-expression }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_relational_expression_part_1;
+
+    m = sv_shift_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_relational_expression_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_relational_operator(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_shift_expression(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_relational_expression_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_equality_operator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_NE: viable |= 0x1; break;
+                    case ATOM_EQ: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::EQUALITY_OPERATOR, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // equality-operator:
+    //   operator("!=")
+    //   operator("==")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_equality_operator_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_NE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_equality_operator_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_equality_operator_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_equality_operator_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_EQ))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_equality_operator_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_equality_operator_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_equality_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x1;
+                break;
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_DELETE: viable |= 0x1; break;
+                    case ATOM_NEW: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    case ATOM_EXCLAIM: viable |= 0x1; break;
+                    case ATOM_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::EQUALITY_EXPRESSION, parent);
+
+    // equality-expression:
+    //   relational-expression { equality-operator relational-expression }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_equality_expression_part_1;
+
+    m = sv_relational_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_equality_expression_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_equality_operator(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_relational_expression(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_equality_expression_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_and_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x1;
+                break;
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_DELETE: viable |= 0x1; break;
+                    case ATOM_NEW: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    case ATOM_EXCLAIM: viable |= 0x1; break;
+                    case ATOM_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::AND_EXPRESSION, parent);
+
+    // and-expression:
+    //   equality-expression { operator("&") equality-expression }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_and_expression_part_1;
+
+    m = sv_equality_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_and_expression_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_AMP))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_equality_expression(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_and_expression_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_exclusive_or_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x1;
+                break;
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_DELETE: viable |= 0x1; break;
+                    case ATOM_NEW: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    case ATOM_EXCLAIM: viable |= 0x1; break;
+                    case ATOM_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::EXCLUSIVE_OR_EXPRESSION, parent);
+
+    // exclusive-or-expression:
+    //   and-expression { operator("^") and-expression }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_exclusive_or_expression_part_1;
+
+    m = sv_and_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_exclusive_or_expression_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_CARET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_and_expression(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_exclusive_or_expression_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_inclusive_or_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x1;
+                break;
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_DELETE: viable |= 0x1; break;
+                    case ATOM_NEW: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    case ATOM_EXCLAIM: viable |= 0x1; break;
+                    case ATOM_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::INCLUSIVE_OR_EXPRESSION, parent);
+
+    // inclusive-or-expression:
+    //   exclusive-or-expression { operator("|") exclusive-or-expression }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_inclusive_or_expression_part_1;
+
+    m = sv_exclusive_or_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_inclusive_or_expression_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_PIPE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_exclusive_or_expression(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_inclusive_or_expression_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_logical_and_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x1;
+                break;
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_DELETE: viable |= 0x1; break;
+                    case ATOM_NEW: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    case ATOM_EXCLAIM: viable |= 0x1; break;
+                    case ATOM_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::LOGICAL_AND_EXPRESSION, parent);
+
+    // logical-and-expression:
+    //   inclusive-or-expression { operator("&&") inclusive-or-expression }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_logical_and_expression_part_1;
+
+    m = sv_inclusive_or_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_logical_and_expression_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_AMP_AMP))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_inclusive_or_expression(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_logical_and_expression_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_logical_or_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x1;
+                break;
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_DELETE: viable |= 0x1; break;
+                    case ATOM_NEW: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    case ATOM_EXCLAIM: viable |= 0x1; break;
+                    case ATOM_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::LOGICAL_OR_EXPRESSION, parent);
+
+    // logical-or-expression:
+    //   logical-and-expression { operator("||") logical-and-expression }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_logical_or_expression_part_1;
+
+    m = sv_logical_and_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_logical_or_expression_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_PIPE_PIPE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_logical_and_expression(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_logical_or_expression_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_conditional_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x3;
+                break;
+            case token::IDENTIFIER:
+                viable = 0x3;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x3; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x3; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x3; break;
+                    case ATOM_SCOPE: viable |= 0x3; break;
+                    case ATOM_DELETE: viable |= 0x3; break;
+                    case ATOM_NEW: viable |= 0x3; break;
+                    case ATOM_TILDE: viable |= 0x3; break;
+                    case ATOM_EXCLAIM: viable |= 0x3; break;
+                    case ATOM_MINUS: viable |= 0x3; break;
+                    case ATOM_PLUS: viable |= 0x3; break;
+                    case ATOM_AMP: viable |= 0x3; break;
+                    case ATOM_STAR: viable |= 0x3; break;
+                    case ATOM_LBRACKET: viable |= 0x3; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::CONDITIONAL_EXPRESSION, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // conditional-expression:
+    //   logical-or-expression operator("?") expression operator(":") assignment-expression
+    //   logical-or-expression
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_conditional_expression_part_1;
+
+    m = sv_logical_or_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_conditional_expression_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_QUESTION))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_conditional_expression_part_1;
+
+    m = sv_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_conditional_expression_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_conditional_expression_part_1;
+
+    m = sv_assignment_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_conditional_expression_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_conditional_expression_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_conditional_expression_part_2;
+
+    m = sv_logical_or_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_conditional_expression_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_conditional_expression_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_assignment_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x6;
+                break;
+            case token::IDENTIFIER:
+                viable = 0x6;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_THROW: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x6; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x6; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x6; break;
+                    case ATOM_SCOPE: viable |= 0x6; break;
+                    case ATOM_DELETE: viable |= 0x6; break;
+                    case ATOM_NEW: viable |= 0x6; break;
+                    case ATOM_TILDE: viable |= 0x6; break;
+                    case ATOM_EXCLAIM: viable |= 0x6; break;
+                    case ATOM_MINUS: viable |= 0x6; break;
+                    case ATOM_PLUS: viable |= 0x6; break;
+                    case ATOM_AMP: viable |= 0x6; break;
+                    case ATOM_STAR: viable |= 0x6; break;
+                    case ATOM_LBRACKET: viable |= 0x6; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ASSIGNMENT_EXPRESSION, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // assignment-expression:
+    //   throw-expression
+    //   logical-or-expression assignment-operator initializer-clause
+    //   conditional-expression
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_assignment_expression_part_1;
+
+    m = sv_throw_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_assignment_expression_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_assignment_expression_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_assignment_expression_part_2;
+
+    m = sv_logical_or_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_assignment_expression_part_2;
+
+    m = sv_assignment_operator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_assignment_expression_part_2;
+
+    m = sv_initializer_clause(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_assignment_expression_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_assignment_expression_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_assignment_expression_part_3;
+
+    m = sv_conditional_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_assignment_expression_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_assignment_expression_part_3:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_assignment_operator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_PIPE_ASSIGN: viable |= 0x1; break;
+                    case ATOM_CARET_ASSIGN: viable |= 0x2; break;
+                    case ATOM_AMP_ASSIGN: viable |= 0x4; break;
+                    case ATOM_LSHIFT_ASSIGN: viable |= 0x8; break;
+                    case ATOM_GREATER: viable |= 0x10; break;
+                    case ATOM_MINUS_ASSIGN: viable |= 0x20; break;
+                    case ATOM_PLUS_ASSIGN: viable |= 0x40; break;
+                    case ATOM_PERCENT_ASSIGN: viable |= 0x80; break;
+                    case ATOM_SLASH_ASSIGN: viable |= 0x100; break;
+                    case ATOM_STAR_ASSIGN: viable |= 0x200; break;
+                    case ATOM_ASSIGN: viable |= 0x400; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ASSIGNMENT_OPERATOR, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // assignment-operator:
+    //   operator("|=")
+    //   operator("^=")
+    //   operator("&=")
+    //   operator("<<=")
+    //   right-shift-assignment
+    //   operator("-=")
+    //   operator("+=")
+    //   operator("%=")
+    //   operator("/=")
+    //   operator("*=")
+    //   operator("=")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_assignment_operator_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_PIPE_ASSIGN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_assignment_operator_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_assignment_operator_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_assignment_operator_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_CARET_ASSIGN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_assignment_operator_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_assignment_operator_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_assignment_operator_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_AMP_ASSIGN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_assignment_operator_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_assignment_operator_part_3:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_assignment_operator_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LSHIFT_ASSIGN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_assignment_operator_part_4;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_assignment_operator_part_4:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x10))
+        goto sv_assignment_operator_part_5;
+
+    m = sv_right_shift_assignment(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_assignment_operator_part_5;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_assignment_operator_part_5:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x20))
+        goto sv_assignment_operator_part_6;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_MINUS_ASSIGN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_assignment_operator_part_6;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_assignment_operator_part_6:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x40))
+        goto sv_assignment_operator_part_7;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_PLUS_ASSIGN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_assignment_operator_part_7;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_assignment_operator_part_7:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x80))
+        goto sv_assignment_operator_part_8;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_PERCENT_ASSIGN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_assignment_operator_part_8;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_assignment_operator_part_8:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x100))
+        goto sv_assignment_operator_part_9;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SLASH_ASSIGN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_assignment_operator_part_9;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_assignment_operator_part_9:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x200))
+        goto sv_assignment_operator_part_10;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_STAR_ASSIGN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_assignment_operator_part_10;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_assignment_operator_part_10:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x400))
+        goto sv_assignment_operator_part_11;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ASSIGN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_assignment_operator_part_11;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_assignment_operator_part_11:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x1;
+                break;
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_DELETE: viable |= 0x1; break;
+                    case ATOM_NEW: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    case ATOM_EXCLAIM: viable |= 0x1; break;
+                    case ATOM_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::EXPRESSION, parent);
+
+    // expression:
+    //   assignment-expression { operator(",") assignment-expression }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_expression_part_1;
+
+    m = sv_assignment_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_expression_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COMMA))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_assignment_expression(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_expression_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_constant_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x1;
+                break;
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_DELETE: viable |= 0x1; break;
+                    case ATOM_NEW: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    case ATOM_EXCLAIM: viable |= 0x1; break;
+                    case ATOM_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::CONSTANT_EXPRESSION, parent);
+
+    // constant-expression:
+    //   conditional-expression
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_constant_expression_part_1;
+
+    m = sv_conditional_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_constant_expression_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_constant_expression_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_statement(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0xc1;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ALIGNAS: viable |= 0x3e; break;
+                    case ATOM_TRY: viable |= 0x2; break;
+                    case ATOM_GOTO: viable |= 0x4; break;
+                    case ATOM_RETURN: viable |= 0x4; break;
+                    case ATOM_CONTINUE: viable |= 0x4; break;
+                    case ATOM_BREAK: viable |= 0x4; break;
+                    case ATOM_FOR: viable |= 0x8; break;
+                    case ATOM_DO: viable |= 0x8; break;
+                    case ATOM_WHILE: viable |= 0x8; break;
+                    case ATOM_SWITCH: viable |= 0x10; break;
+                    case ATOM_IF: viable |= 0x10; break;
+                    default: break;
+                }
+                break;
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x40;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0xff; break;
+                    case ATOM_LBRACE: viable |= 0x20; break;
+                    case ATOM_LPAREN: viable |= 0xc0; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x40; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x40; break;
+                    case ATOM_SEMICOLON: viable |= 0xc0; break;
+                    case ATOM_SCOPE: viable |= 0xc0; break;
+                    case ATOM_DELETE: viable |= 0x40; break;
+                    case ATOM_NEW: viable |= 0x40; break;
+                    case ATOM_TILDE: viable |= 0xc0; break;
+                    case ATOM_EXCLAIM: viable |= 0x40; break;
+                    case ATOM_MINUS: viable |= 0x40; break;
+                    case ATOM_PLUS: viable |= 0x40; break;
+                    case ATOM_AMP: viable |= 0xc0; break;
+                    case ATOM_STAR: viable |= 0xc0; break;
+                    case ATOM_ELLIPSIS: viable |= 0x80; break;
+                    case ATOM_AMP_AMP: viable |= 0x80; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::STATEMENT, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // statement:
+    //   labeled-statement
+    //   [attribute-specifier-seq] try-block
+    //   [attribute-specifier-seq] jump-statement
+    //   [attribute-specifier-seq] iteration-statement
+    //   [attribute-specifier-seq] selection-statement
+    //   [attribute-specifier-seq] compound-statement
+    //   [attribute-specifier-seq] expression-statement
+    //   declaration-statement
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_statement_part_1;
+
+    m = sv_labeled_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_statement_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_statement_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_statement_part_2;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_try_block(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_statement_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_statement_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_statement_part_3;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_jump_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_statement_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_statement_part_3:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_statement_part_4;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_iteration_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_statement_part_4;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_statement_part_4:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x10))
+        goto sv_statement_part_5;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_selection_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_statement_part_5;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_statement_part_5:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x20))
+        goto sv_statement_part_6;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_compound_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_statement_part_6;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_statement_part_6:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x40))
+        goto sv_statement_part_7;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_expression_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_statement_part_7;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_statement_part_7:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x80))
+        goto sv_statement_part_8;
+
+    m = sv_declaration_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_statement_part_8;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_statement_part_8:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_labeled_statement(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x4;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ALIGNAS: viable |= 0x3; break;
+                    case ATOM_DEFAULT: viable |= 0x1; break;
+                    case ATOM_CASE: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x7; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::LABELED_STATEMENT, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // labeled-statement:
+    //   [attribute-specifier-seq] keyword("default") operator(":") statement
+    //   [attribute-specifier-seq] keyword("case") constant-expression operator(":") statement
+    //   [attribute-specifier-seq] identifier() operator(":") statement
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_labeled_statement_part_1;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_DEFAULT))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_labeled_statement_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_labeled_statement_part_1;
+
+    m = sv_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_labeled_statement_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_labeled_statement_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_labeled_statement_part_2;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_CASE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_labeled_statement_part_2;
+
+    m = sv_constant_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_labeled_statement_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_labeled_statement_part_2;
+
+    m = sv_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_labeled_statement_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_labeled_statement_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_labeled_statement_part_3;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_labeled_statement_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_labeled_statement_part_3;
+
+    m = sv_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_labeled_statement_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_labeled_statement_part_3:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_expression_statement(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x1;
+                break;
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_DELETE: viable |= 0x1; break;
+                    case ATOM_NEW: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    case ATOM_EXCLAIM: viable |= 0x1; break;
+                    case ATOM_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    case ATOM_SEMICOLON: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::EXPRESSION_STATEMENT, parent);
+
+    // expression-statement:
+    //   [expression] operator(";")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_expression_statement_part_1;
+
+    m = sv_expression(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SEMICOLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_expression_statement_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_expression_statement_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_compound_statement(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::COMPOUND_STATEMENT, parent);
+
+    // compound-statement:
+    //   operator("{") [statement-seq] operator("}")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_compound_statement_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LBRACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_compound_statement_part_1;
+
+    m = sv_statement_seq(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RBRACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_compound_statement_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_compound_statement_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_statement_seq(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACE: viable |= 0x1; break;
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x1; break;
+                    case ATOM_SEMICOLON: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_DELETE: viable |= 0x1; break;
+                    case ATOM_NEW: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    case ATOM_EXCLAIM: viable |= 0x1; break;
+                    case ATOM_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_ELLIPSIS: viable |= 0x1; break;
+                    case ATOM_AMP_AMP: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::STATEMENT_SEQ, parent);
+
+    // statement-seq:
+    //   statement { statement }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_statement_seq_part_1;
+
+    m = sv_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_statement_seq_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_statement(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_statement_seq_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_selection_statement(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SWITCH: viable |= 0x1; break;
+                    case ATOM_IF: viable |= 0x6; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::SELECTION_STATEMENT, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // selection-statement:
+    //   keyword("switch") operator("(") condition operator(")") statement
+    //   keyword("if") operator("(") condition operator(")") statement keyword("else") statement
+    //   keyword("if") operator("(") condition operator(")") statement
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_selection_statement_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_SWITCH))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_selection_statement_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_selection_statement_part_1;
+
+    m = sv_condition(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_selection_statement_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_selection_statement_part_1;
+
+    m = sv_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_selection_statement_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_selection_statement_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_selection_statement_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_IF))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_selection_statement_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_selection_statement_part_2;
+
+    m = sv_condition(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_selection_statement_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_selection_statement_part_2;
+
+    m = sv_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_selection_statement_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_ELSE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_selection_statement_part_2;
+
+    m = sv_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_selection_statement_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_selection_statement_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_selection_statement_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_IF))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_selection_statement_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_selection_statement_part_3;
+
+    m = sv_condition(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_selection_statement_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_selection_statement_part_3;
+
+    m = sv_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_selection_statement_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_selection_statement_part_3:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_condition(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x7;
+                break;
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x4;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x7; break;
+                    case ATOM_SCOPE: viable |= 0x7; break;
+                    case ATOM_LPAREN: viable |= 0x4; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x4; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x4; break;
+                    case ATOM_DELETE: viable |= 0x4; break;
+                    case ATOM_NEW: viable |= 0x4; break;
+                    case ATOM_TILDE: viable |= 0x4; break;
+                    case ATOM_EXCLAIM: viable |= 0x4; break;
+                    case ATOM_MINUS: viable |= 0x4; break;
+                    case ATOM_PLUS: viable |= 0x4; break;
+                    case ATOM_AMP: viable |= 0x4; break;
+                    case ATOM_STAR: viable |= 0x4; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::CONDITION, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // condition:
+    //   [attribute-specifier-seq] decl-specifier-seq declarator braced-init-list
+    //   [attribute-specifier-seq] decl-specifier-seq declarator operator("=") initializer-clause
+    //   expression
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_condition_part_1;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_decl_specifier_seq(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_condition_part_1;
+
+    m = sv_declarator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_condition_part_1;
+
+    m = sv_braced_init_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_condition_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_condition_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_condition_part_2;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_decl_specifier_seq(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_condition_part_2;
+
+    m = sv_declarator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_condition_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ASSIGN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_condition_part_2;
+
+    m = sv_initializer_clause(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_condition_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_condition_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_condition_part_3;
+
+    m = sv_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_condition_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_condition_part_3:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_iteration_statement(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_FOR: viable |= 0x3; break;
+                    case ATOM_DO: viable |= 0x4; break;
+                    case ATOM_WHILE: viable |= 0x8; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ITERATION_STATEMENT, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // iteration-statement:
+    //   keyword("for") operator("(") for-range-declaration operator(":") for-range-initializer operator(")") statement
+    //   keyword("for") operator("(") for-init-statement [condition] operator(";") [expression] operator(")") statement
+    //   keyword("do") statement keyword("while") operator("(") expression operator(")") operator(";")
+    //   keyword("while") operator("(") condition operator(")") statement
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_iteration_statement_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_FOR))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_iteration_statement_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_iteration_statement_part_1;
+
+    m = sv_for_range_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_iteration_statement_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_iteration_statement_part_1;
+
+    m = sv_for_range_initializer(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_iteration_statement_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_iteration_statement_part_1;
+
+    m = sv_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_iteration_statement_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_iteration_statement_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_iteration_statement_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_FOR))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_iteration_statement_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_iteration_statement_part_2;
+
+    m = sv_for_init_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_iteration_statement_part_2;
+
+    m = sv_condition(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SEMICOLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_iteration_statement_part_2;
+
+    m = sv_expression(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_iteration_statement_part_2;
+
+    m = sv_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_iteration_statement_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_iteration_statement_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_iteration_statement_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_DO))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_iteration_statement_part_3;
+
+    m = sv_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_iteration_statement_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_WHILE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_iteration_statement_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_iteration_statement_part_3;
+
+    m = sv_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_iteration_statement_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_iteration_statement_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SEMICOLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_iteration_statement_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_iteration_statement_part_3:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_iteration_statement_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_WHILE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_iteration_statement_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_iteration_statement_part_4;
+
+    m = sv_condition(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_iteration_statement_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_iteration_statement_part_4;
+
+    m = sv_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_iteration_statement_part_4;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_iteration_statement_part_4:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_for_init_statement(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x3;
+                break;
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x2;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SEMICOLON: viable |= 0x3; break;
+                    case ATOM_LBRACKET: viable |= 0x3; break;
+                    case ATOM_SCOPE: viable |= 0x3; break;
+                    case ATOM_LPAREN: viable |= 0x3; break;
+                    case ATOM_ELLIPSIS: viable |= 0x1; break;
+                    case ATOM_AMP_AMP: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x3; break;
+                    case ATOM_STAR: viable |= 0x3; break;
+                    case ATOM_TILDE: viable |= 0x3; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x2; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x2; break;
+                    case ATOM_DELETE: viable |= 0x2; break;
+                    case ATOM_NEW: viable |= 0x2; break;
+                    case ATOM_EXCLAIM: viable |= 0x2; break;
+                    case ATOM_MINUS: viable |= 0x2; break;
+                    case ATOM_PLUS: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::FOR_INIT_STATEMENT, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // for-init-statement:
+    //   simple-declaration
+    //   expression-statement
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_for_init_statement_part_1;
+
+    m = sv_simple_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_for_init_statement_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_for_init_statement_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_for_init_statement_part_2;
+
+    m = sv_expression_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_for_init_statement_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_for_init_statement_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_for_range_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::FOR_RANGE_DECLARATION, parent);
+
+    // for-range-declaration:
+    //   [attribute-specifier-seq] decl-specifier-seq declarator
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_for_range_declaration_part_1;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_decl_specifier_seq(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_for_range_declaration_part_1;
+
+    m = sv_declarator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_for_range_declaration_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_for_range_declaration_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_for_range_initializer(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x2;
+                break;
+            case token::IDENTIFIER:
+                viable = 0x2;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACE: viable |= 0x1; break;
+                    case ATOM_LPAREN: viable |= 0x2; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x2; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x2; break;
+                    case ATOM_SCOPE: viable |= 0x2; break;
+                    case ATOM_DELETE: viable |= 0x2; break;
+                    case ATOM_NEW: viable |= 0x2; break;
+                    case ATOM_TILDE: viable |= 0x2; break;
+                    case ATOM_EXCLAIM: viable |= 0x2; break;
+                    case ATOM_MINUS: viable |= 0x2; break;
+                    case ATOM_PLUS: viable |= 0x2; break;
+                    case ATOM_AMP: viable |= 0x2; break;
+                    case ATOM_STAR: viable |= 0x2; break;
+                    case ATOM_LBRACKET: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::FOR_RANGE_INITIALIZER, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // for-range-initializer:
+    //   braced-init-list
+    //   expression
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_for_range_initializer_part_1;
+
+    m = sv_braced_init_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_for_range_initializer_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_for_range_initializer_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_for_range_initializer_part_2;
+
+    m = sv_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_for_range_initializer_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_for_range_initializer_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_jump_statement(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_GOTO: viable |= 0x1; break;
+                    case ATOM_RETURN: viable |= 0x6; break;
+                    case ATOM_CONTINUE: viable |= 0x8; break;
+                    case ATOM_BREAK: viable |= 0x10; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::JUMP_STATEMENT, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // jump-statement:
+    //   keyword("goto") identifier() operator(";")
+    //   keyword("return") braced-init-list operator(";")
+    //   keyword("return") [expression] operator(";")
+    //   keyword("continue") operator(";")
+    //   keyword("break") operator(";")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_jump_statement_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_GOTO))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_jump_statement_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_jump_statement_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SEMICOLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_jump_statement_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_jump_statement_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_jump_statement_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_RETURN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_jump_statement_part_2;
+
+    m = sv_braced_init_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_jump_statement_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SEMICOLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_jump_statement_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_jump_statement_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_jump_statement_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_RETURN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_jump_statement_part_3;
+
+    m = sv_expression(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SEMICOLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_jump_statement_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_jump_statement_part_3:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_jump_statement_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_CONTINUE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_jump_statement_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SEMICOLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_jump_statement_part_4;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_jump_statement_part_4:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x10))
+        goto sv_jump_statement_part_5;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_BREAK))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_jump_statement_part_5;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SEMICOLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_jump_statement_part_5;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_jump_statement_part_5:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_declaration_statement(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SEMICOLON: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_ELLIPSIS: viable |= 0x1; break;
+                    case ATOM_AMP_AMP: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::DECLARATION_STATEMENT, parent);
+
+    // declaration-statement:
+    //   block-declaration
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_declaration_statement_part_1;
+
+    m = sv_block_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_declaration_statement_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_declaration_statement_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_declaration_seq(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SEMICOLON: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_ELLIPSIS: viable |= 0x1; break;
+                    case ATOM_AMP_AMP: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::DECLARATION_SEQ, parent);
+
+    // declaration-seq:
+    //   declaration { declaration }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_declaration_seq_part_1;
+
+    m = sv_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_declaration_seq_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_declaration(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_declaration_seq_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x180;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ALIGNAS: viable |= 0x1; break;
+                    case ATOM_INLINE: viable |= 0x4; break;
+                    case ATOM_NAMESPACE: viable |= 0x4; break;
+                    case ATOM_EXTERN: viable |= 0x48; break;
+                    case ATOM_TEMPLATE: viable |= 0x70; break;
+                    default: break;
+                }
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x181; break;
+                    case ATOM_SEMICOLON: viable |= 0x102; break;
+                    case ATOM_LPAREN: viable |= 0x180; break;
+                    case ATOM_SCOPE: viable |= 0x180; break;
+                    case ATOM_ELLIPSIS: viable |= 0x180; break;
+                    case ATOM_AMP_AMP: viable |= 0x180; break;
+                    case ATOM_AMP: viable |= 0x180; break;
+                    case ATOM_STAR: viable |= 0x180; break;
+                    case ATOM_TILDE: viable |= 0x180; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::DECLARATION, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // declaration:
+    //   attribute-declaration
+    //   empty-declaration
+    //   namespace-definition
+    //   linkage-specification
+    //   explicit-specialization
+    //   template-declaration
+    //   explicit-instantiation
+    //   function-definition
+    //   block-declaration
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_declaration_part_1;
+
+    m = sv_attribute_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_declaration_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_declaration_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_declaration_part_2;
+
+    m = sv_empty_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_declaration_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_declaration_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_declaration_part_3;
+
+    m = sv_namespace_definition(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_declaration_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_declaration_part_3:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_declaration_part_4;
+
+    m = sv_linkage_specification(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_declaration_part_4;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_declaration_part_4:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x10))
+        goto sv_declaration_part_5;
+
+    m = sv_explicit_specialization(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_declaration_part_5;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_declaration_part_5:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x20))
+        goto sv_declaration_part_6;
+
+    m = sv_template_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_declaration_part_6;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_declaration_part_6:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x40))
+        goto sv_declaration_part_7;
+
+    m = sv_explicit_instantiation(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_declaration_part_7;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_declaration_part_7:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x80))
+        goto sv_declaration_part_8;
+
+    m = sv_function_definition(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_declaration_part_8;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_declaration_part_8:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x100))
+        goto sv_declaration_part_9;
+
+    m = sv_block_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_declaration_part_9;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_declaration_part_9:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_block_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x80;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ENUM: viable |= 0x1; break;
+                    case ATOM_USING: viable |= 0x1a; break;
+                    case ATOM_STATIC_ASSERT: viable |= 0x4; break;
+                    case ATOM_ALIGNAS: viable |= 0x8; break;
+                    case ATOM_NAMESPACE: viable |= 0x20; break;
+                    case ATOM_ASM: viable |= 0x40; break;
+                    default: break;
+                }
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x88; break;
+                    case ATOM_SEMICOLON: viable |= 0x80; break;
+                    case ATOM_SCOPE: viable |= 0x80; break;
+                    case ATOM_LPAREN: viable |= 0x80; break;
+                    case ATOM_ELLIPSIS: viable |= 0x80; break;
+                    case ATOM_AMP_AMP: viable |= 0x80; break;
+                    case ATOM_AMP: viable |= 0x80; break;
+                    case ATOM_STAR: viable |= 0x80; break;
+                    case ATOM_TILDE: viable |= 0x80; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::BLOCK_DECLARATION, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // block-declaration:
+    //   opaque-enum-declaration
+    //   alias-declaration
+    //   static_assert-declaration
+    //   using-directive
+    //   using-declaration
+    //   namespace-alias-definition
+    //   asm-definition
+    //   simple-declaration
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_block_declaration_part_1;
+
+    m = sv_opaque_enum_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_block_declaration_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_block_declaration_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_block_declaration_part_2;
+
+    m = sv_alias_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_block_declaration_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_block_declaration_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_block_declaration_part_3;
+
+    m = sv_static_assert_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_block_declaration_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_block_declaration_part_3:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_block_declaration_part_4;
+
+    m = sv_using_directive(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_block_declaration_part_4;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_block_declaration_part_4:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x10))
+        goto sv_block_declaration_part_5;
+
+    m = sv_using_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_block_declaration_part_5;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_block_declaration_part_5:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x20))
+        goto sv_block_declaration_part_6;
+
+    m = sv_namespace_alias_definition(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_block_declaration_part_6;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_block_declaration_part_6:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x40))
+        goto sv_block_declaration_part_7;
+
+    m = sv_asm_definition(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_block_declaration_part_7;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_block_declaration_part_7:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x80))
+        goto sv_block_declaration_part_8;
+
+    m = sv_simple_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_block_declaration_part_8;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_block_declaration_part_8:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_alias_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_USING: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ALIAS_DECLARATION, parent);
+
+    // alias-declaration:
+    //   keyword("using") identifier() [attribute-specifier-seq] operator("=") type-id operator(";")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_alias_declaration_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_USING))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_alias_declaration_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_alias_declaration_part_1;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ASSIGN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_alias_declaration_part_1;
+
+    m = sv_type_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_alias_declaration_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SEMICOLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_alias_declaration_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_alias_declaration_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_simple_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x2;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ALIGNAS: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x2; break;
+                    case ATOM_LPAREN: viable |= 0x2; break;
+                    case ATOM_ELLIPSIS: viable |= 0x2; break;
+                    case ATOM_AMP_AMP: viable |= 0x2; break;
+                    case ATOM_AMP: viable |= 0x2; break;
+                    case ATOM_STAR: viable |= 0x2; break;
+                    case ATOM_TILDE: viable |= 0x2; break;
+                    case ATOM_SEMICOLON: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::SIMPLE_DECLARATION, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // simple-declaration:
+    //   attribute-specifier-seq [decl-specifier-seq] init-declarator-list [gcc-attribute-specifier-seq] operator(";")
+    //   [decl-specifier-seq] [init-declarator-list] [gcc-attribute-specifier-seq] operator(";")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_simple_declaration_part_1;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_simple_declaration_part_1;
+
+    m = sv_decl_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_init_declarator_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_simple_declaration_part_1;
+
+    m = sv_gcc_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SEMICOLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_simple_declaration_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    simple_declaration_done(ctx, node);
+    return m;
+
+
+sv_simple_declaration_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_simple_declaration_part_2;
+
+    m = sv_decl_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_init_declarator_list(ctx, node, m, &could_parse);
+
+    m = sv_gcc_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SEMICOLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_simple_declaration_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    simple_declaration_done(ctx, node);
+    return m;
+
+
+sv_simple_declaration_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_static_assert_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_STATIC_ASSERT: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::STATIC_ASSERT_DECLARATION, parent);
+
+    // static_assert-declaration:
+    //   keyword("static_assert") operator("(") constant-expression operator(",") lit-string() operator(")") operator(";")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_static_assert_declaration_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_STATIC_ASSERT))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_static_assert_declaration_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_static_assert_declaration_part_1;
+
+    m = sv_constant_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_static_assert_declaration_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COMMA))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_static_assert_declaration_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::LIT_STRING))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_static_assert_declaration_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_static_assert_declaration_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SEMICOLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_static_assert_declaration_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_static_assert_declaration_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_empty_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SEMICOLON: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::EMPTY_DECLARATION, parent);
+
+    // empty-declaration:
+    //   operator(";")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_empty_declaration_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SEMICOLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_empty_declaration_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_empty_declaration_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_attribute_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ALIGNAS: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ATTRIBUTE_DECLARATION, parent);
+
+    // attribute-declaration:
+    //   attribute-specifier-seq operator(";")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_attribute_declaration_part_1;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_attribute_declaration_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SEMICOLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_attribute_declaration_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_attribute_declaration_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_decl_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x10;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_CONSTEXPR: viable |= 0x1; break;
+                    case ATOM_TYPEDEF: viable |= 0x2; break;
+                    case ATOM_FRIEND: viable |= 0x4; break;
+                    case ATOM_EXPLICIT: viable |= 0x8; break;
+                    case ATOM_VIRTUAL: viable |= 0x8; break;
+                    case ATOM_INLINE: viable |= 0x8; break;
+                    case ATOM_MUTABLE: viable |= 0x20; break;
+                    case ATOM_EXTERN: viable |= 0x20; break;
+                    case ATOM_THREAD_LOCAL: viable |= 0x20; break;
+                    case ATOM_STATIC: viable |= 0x20; break;
+                    case ATOM_REGISTER: viable |= 0x20; break;
+                    default: break;
+                }
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x10; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::DECL_SPECIFIER, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // decl-specifier:
+    //   keyword("constexpr")
+    //   keyword("typedef")
+    //   keyword("friend")
+    //   function-specifier
+    //   type-specifier
+    //   storage-class-specifier
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_decl_specifier_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_CONSTEXPR))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_decl_specifier_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_decl_specifier_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_decl_specifier_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_TYPEDEF))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_decl_specifier_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_decl_specifier_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_decl_specifier_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_FRIEND))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_decl_specifier_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_decl_specifier_part_3:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_decl_specifier_part_4;
+
+    m = sv_function_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_decl_specifier_part_4;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_decl_specifier_part_4:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x10))
+        goto sv_decl_specifier_part_5;
+
+    m = sv_type_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_decl_specifier_part_5;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_decl_specifier_part_5:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x20))
+        goto sv_decl_specifier_part_6;
+
+    m = sv_storage_class_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_decl_specifier_part_6;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_decl_specifier_part_6:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_decl_specifier_seq(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::DECL_SPECIFIER_SEQ, parent);
+
+    // decl-specifier-seq:
+    //   decl-specifier { decl-specifier } [attribute-specifier-seq]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_decl_specifier_seq_part_1;
+
+    m = sv_decl_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_decl_specifier_seq_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_decl_specifier(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_decl_specifier_seq_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_storage_class_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_MUTABLE: viable |= 0x1; break;
+                    case ATOM_EXTERN: viable |= 0x2; break;
+                    case ATOM_THREAD_LOCAL: viable |= 0x4; break;
+                    case ATOM_STATIC: viable |= 0x8; break;
+                    case ATOM_REGISTER: viable |= 0x10; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::STORAGE_CLASS_SPECIFIER, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // storage-class-specifier:
+    //   keyword("mutable")
+    //   keyword("extern")
+    //   keyword("thread_local")
+    //   keyword("static")
+    //   keyword("register")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_storage_class_specifier_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_MUTABLE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_storage_class_specifier_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_storage_class_specifier_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_storage_class_specifier_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_EXTERN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_storage_class_specifier_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_storage_class_specifier_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_storage_class_specifier_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_THREAD_LOCAL))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_storage_class_specifier_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_storage_class_specifier_part_3:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_storage_class_specifier_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_STATIC))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_storage_class_specifier_part_4;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_storage_class_specifier_part_4:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x10))
+        goto sv_storage_class_specifier_part_5;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_REGISTER))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_storage_class_specifier_part_5;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_storage_class_specifier_part_5:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_function_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_EXPLICIT: viable |= 0x1; break;
+                    case ATOM_VIRTUAL: viable |= 0x2; break;
+                    case ATOM_INLINE: viable |= 0x4; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::FUNCTION_SPECIFIER, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // function-specifier:
+    //   keyword("explicit")
+    //   keyword("virtual")
+    //   keyword("inline")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_function_specifier_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_EXPLICIT))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_function_specifier_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_function_specifier_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_function_specifier_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_VIRTUAL))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_function_specifier_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_function_specifier_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_function_specifier_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_INLINE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_function_specifier_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_function_specifier_part_3:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_type_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x4;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ENUM: viable |= 0x1; break;
+                    case ATOM_UNION: viable |= 0x2; break;
+                    case ATOM_STRUCT: viable |= 0x2; break;
+                    case ATOM_CLASS: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x4; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TYPE_SPECIFIER, parent);
+    parse_mark children_mark = mark_parse(ctx);
+    push_null_namespace(ctx, node);
+
+    // type-specifier:
+    //   enum-specifier
+    //   class-specifier
+    //   trailing-type-specifier
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_type_specifier_part_1;
+
+    m = sv_enum_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_type_specifier_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_type_specifier_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_type_specifier_part_2;
+
+    m = sv_class_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_type_specifier_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_type_specifier_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_type_specifier_part_3;
+
+    m = sv_trailing_type_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_type_specifier_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_type_specifier_part_3:
+    clear_nested_name_specifier(ctx, node);
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_trailing_type_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x8;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_VOLATILE: viable |= 0x1; break;
+                    case ATOM_CONST: viable |= 0x1; break;
+                    case ATOM_TYPENAME: viable |= 0x2; break;
+                    case ATOM_ENUM: viable |= 0x4; break;
+                    case ATOM_UNION: viable |= 0x4; break;
+                    case ATOM_STRUCT: viable |= 0x4; break;
+                    case ATOM_CLASS: viable |= 0x4; break;
+                    default: break;
+                }
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x8; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TRAILING_TYPE_SPECIFIER, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // trailing-type-specifier:
+    //   cv-qualifier
+    //   typename-specifier
+    //   elaborated-type-specifier
+    //   simple-type-specifier
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_trailing_type_specifier_part_1;
+
+    m = sv_cv_qualifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_trailing_type_specifier_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_trailing_type_specifier_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_trailing_type_specifier_part_2;
+
+    m = sv_typename_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_trailing_type_specifier_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_trailing_type_specifier_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_trailing_type_specifier_part_3;
+
+    m = sv_elaborated_type_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_trailing_type_specifier_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_trailing_type_specifier_part_3:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_trailing_type_specifier_part_4;
+
+    m = sv_simple_type_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_trailing_type_specifier_part_4;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_trailing_type_specifier_part_4:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_type_specifier_seq(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TYPE_SPECIFIER_SEQ, parent);
+
+    // type-specifier-seq:
+    //   type-specifier { type-specifier } [attribute-specifier-seq]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_type_specifier_seq_part_1;
+
+    m = sv_type_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_type_specifier_seq_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_type_specifier(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_type_specifier_seq_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_trailing_type_specifier_seq(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TRAILING_TYPE_SPECIFIER_SEQ, parent);
+
+    // trailing-type-specifier-seq:
+    //   trailing-type-specifier { trailing-type-specifier } [attribute-specifier-seq]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_trailing_type_specifier_seq_part_1;
+
+    m = sv_trailing_type_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_trailing_type_specifier_seq_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_trailing_type_specifier(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_trailing_type_specifier_seq_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_simple_type_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x18000;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_DECLTYPE: viable |= 0x1; break;
+                    case ATOM_AUTO: viable |= 0x2; break;
+                    case ATOM_VOID: viable |= 0x4; break;
+                    case ATOM_DOUBLE: viable |= 0x8; break;
+                    case ATOM_FLOAT: viable |= 0x10; break;
+                    case ATOM_UNSIGNED: viable |= 0x20; break;
+                    case ATOM_SIGNED: viable |= 0x40; break;
+                    case ATOM_LONG: viable |= 0x80; break;
+                    case ATOM_INT: viable |= 0x100; break;
+                    case ATOM_SHORT: viable |= 0x200; break;
+                    case ATOM_BOOL: viable |= 0x400; break;
+                    case ATOM_WCHAR_T: viable |= 0x800; break;
+                    case ATOM_CHAR32_T: viable |= 0x1000; break;
+                    case ATOM_CHAR16_T: viable |= 0x2000; break;
+                    case ATOM_CHAR: viable |= 0x4000; break;
+                    default: break;
+                }
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x18000; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::SIMPLE_TYPE_SPECIFIER, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // simple-type-specifier:
+    //   decltype-specifier
+    //   keyword("auto")
+    //   keyword("void")
+    //   keyword("double")
+    //   keyword("float")
+    //   keyword("unsigned")
+    //   keyword("signed")
+    //   keyword("long")
+    //   keyword("int")
+    //   keyword("short")
+    //   keyword("bool")
+    //   keyword("wchar_t")
+    //   keyword("char32_t")
+    //   keyword("char16_t")
+    //   keyword("char")
+    //   nested-name-specifier keyword("template") simple-template-id
+    //   [nested-name-specifier] type-name
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_simple_type_specifier_part_1;
+
+    m = sv_decltype_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_simple_type_specifier_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_simple_type_specifier_part_1:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_simple_type_specifier_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_AUTO))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_simple_type_specifier_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_simple_type_specifier_part_2:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_simple_type_specifier_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_VOID))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_simple_type_specifier_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_simple_type_specifier_part_3:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_simple_type_specifier_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_DOUBLE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_simple_type_specifier_part_4;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_simple_type_specifier_part_4:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x10))
+        goto sv_simple_type_specifier_part_5;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_FLOAT))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_simple_type_specifier_part_5;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_simple_type_specifier_part_5:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x20))
+        goto sv_simple_type_specifier_part_6;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_UNSIGNED))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_simple_type_specifier_part_6;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_simple_type_specifier_part_6:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x40))
+        goto sv_simple_type_specifier_part_7;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_SIGNED))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_simple_type_specifier_part_7;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_simple_type_specifier_part_7:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x80))
+        goto sv_simple_type_specifier_part_8;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_LONG))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_simple_type_specifier_part_8;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_simple_type_specifier_part_8:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x100))
+        goto sv_simple_type_specifier_part_9;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_INT))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_simple_type_specifier_part_9;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_simple_type_specifier_part_9:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x200))
+        goto sv_simple_type_specifier_part_10;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_SHORT))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_simple_type_specifier_part_10;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_simple_type_specifier_part_10:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x400))
+        goto sv_simple_type_specifier_part_11;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_BOOL))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_simple_type_specifier_part_11;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_simple_type_specifier_part_11:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x800))
+        goto sv_simple_type_specifier_part_12;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_WCHAR_T))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_simple_type_specifier_part_12;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_simple_type_specifier_part_12:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x1000))
+        goto sv_simple_type_specifier_part_13;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_CHAR32_T))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_simple_type_specifier_part_13;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_simple_type_specifier_part_13:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2000))
+        goto sv_simple_type_specifier_part_14;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_CHAR16_T))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_simple_type_specifier_part_14;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_simple_type_specifier_part_14:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4000))
+        goto sv_simple_type_specifier_part_15;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_CHAR))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_simple_type_specifier_part_15;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_simple_type_specifier_part_15:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8000))
+        goto sv_simple_type_specifier_part_16;
+
+    m = sv_nested_name_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_simple_type_specifier_part_16;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_TEMPLATE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_simple_type_specifier_part_16;
+
+    m = sv_simple_template_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_simple_type_specifier_part_16;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_simple_type_specifier_part_16:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x10000))
+        goto sv_simple_type_specifier_part_17;
+
+    m = sv_nested_name_specifier(ctx, node, m, &could_parse);
+
+    m = sv_type_name(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_simple_type_specifier_part_17;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_simple_type_specifier_part_17:
+    clear_nested_name_specifier(ctx, node);
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_type_name(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0xf;
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TYPE_NAME, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // type-name:
+    //   simple-template-id
+    //   typedef-name
+    //   enum-name
+    //   class-name
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_type_name_part_1;
+
+    m = sv_simple_template_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_type_name_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_type_name_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_type_name_part_2;
+
+    m = sv_typedef_name(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_type_name_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_type_name_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_type_name_part_3;
+
+    m = sv_enum_name(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_type_name_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_type_name_part_3:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_type_name_part_4;
+
+    m = sv_class_name(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_type_name_part_4;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_type_name_part_4:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_decltype_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_DECLTYPE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::DECLTYPE_SPECIFIER, parent);
+
+    // decltype-specifier:
+    //   keyword("decltype") operator("(") expression operator(")")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_decltype_specifier_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_DECLTYPE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_decltype_specifier_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_decltype_specifier_part_1;
+
+    m = sv_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_decltype_specifier_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_decltype_specifier_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_decltype_specifier_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_elaborated_type_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ENUM: viable |= 0x1; break;
+                    case ATOM_UNION: viable |= 0x6; break;
+                    case ATOM_STRUCT: viable |= 0x6; break;
+                    case ATOM_CLASS: viable |= 0x6; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ELABORATED_TYPE_SPECIFIER, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // elaborated-type-specifier:
+    //   keyword("enum") [nested-name-specifier] identifier()
+    //   class-key [nested-name-specifier] keyword("template") simple-template-id
+    //   class-key [attribute-specifier-seq] [nested-name-specifier] identifier()
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_elaborated_type_specifier_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_ENUM))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_elaborated_type_specifier_part_1;
+
+    m = sv_nested_name_specifier(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_elaborated_type_specifier_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_elaborated_type_specifier_part_1:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_elaborated_type_specifier_part_2;
+
+    m = sv_class_key(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_elaborated_type_specifier_part_2;
+
+    m = sv_nested_name_specifier(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_TEMPLATE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_elaborated_type_specifier_part_2;
+
+    m = sv_simple_template_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_elaborated_type_specifier_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_elaborated_type_specifier_part_2:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_elaborated_type_specifier_part_3;
+
+    m = sv_class_key(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_elaborated_type_specifier_part_3;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_nested_name_specifier(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_elaborated_type_specifier_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_elaborated_type_specifier_part_3:
+    clear_nested_name_specifier(ctx, node);
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_enum_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ENUM: viable |= 0x3; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ENUM_SPECIFIER, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // enum-specifier:
+    //   enum-head operator("{") [enumerator-list] operator("}")
+    //   enum-head operator("{") enumerator-list operator(",") operator("}")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_enum_specifier_part_1;
+
+    m = sv_enum_head(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_enum_specifier_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LBRACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_enum_specifier_part_1;
+
+    m = sv_enumerator_list(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RBRACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_enum_specifier_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_enum_specifier_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_enum_specifier_part_2;
+
+    m = sv_enum_head(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_enum_specifier_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LBRACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_enum_specifier_part_2;
+
+    m = sv_enumerator_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_enum_specifier_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COMMA))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_enum_specifier_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RBRACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_enum_specifier_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_enum_specifier_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_enum_head(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ENUM: viable |= 0x3; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ENUM_HEAD, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // enum-head:
+    //   enum-key [attribute-specifier-seq] nested-name-specifier identifier() [enum-base]
+    //   enum-key [attribute-specifier-seq] [identifier()] [enum-base]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_enum_head_part_1;
+
+    m = sv_enum_key(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_enum_head_part_1;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_nested_name_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_enum_head_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_enum_head_part_1;
+
+    m = sv_enum_base(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_enum_head_part_1:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_enum_head_part_2;
+
+    m = sv_enum_key(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_enum_head_part_2;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    m = sv_enum_base(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_enum_head_part_2:
+    clear_nested_name_specifier(ctx, node);
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_opaque_enum_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ENUM: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::OPAQUE_ENUM_DECLARATION, parent);
+
+    // opaque-enum-declaration:
+    //   enum-key [attribute-specifier-seq] identifier() [enum-base] operator(";")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_opaque_enum_declaration_part_1;
+
+    m = sv_enum_key(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_opaque_enum_declaration_part_1;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_opaque_enum_declaration_part_1;
+
+    m = sv_enum_base(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SEMICOLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_opaque_enum_declaration_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_opaque_enum_declaration_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_enum_key(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ENUM: viable |= 0x7; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ENUM_KEY, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // enum-key:
+    //   keyword("enum") keyword("struct")
+    //   keyword("enum") keyword("class")
+    //   keyword("enum")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_enum_key_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_ENUM))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_enum_key_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_STRUCT))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_enum_key_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_enum_key_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_enum_key_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_ENUM))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_enum_key_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_CLASS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_enum_key_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_enum_key_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_enum_key_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_ENUM))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_enum_key_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_enum_key_part_3:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_enum_base(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_COLON: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ENUM_BASE, parent);
+
+    // enum-base:
+    //   operator(":") type-specifier-seq
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_enum_base_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_enum_base_part_1;
+
+    m = sv_type_specifier_seq(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_enum_base_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_enum_base_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_enumerator_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ENUMERATOR_LIST, parent);
+
+    // enumerator-list:
+    //   enumerator-definition { operator(",") enumerator-definition }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_enumerator_list_part_1;
+
+    m = sv_enumerator_definition(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_enumerator_list_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COMMA))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_enumerator_definition(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_enumerator_list_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_enumerator_definition(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x3;
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ENUMERATOR_DEFINITION, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // enumerator-definition:
+    //   enumerator operator("=") constant-expression
+    //   enumerator
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_enumerator_definition_part_1;
+
+    m = sv_enumerator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_enumerator_definition_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ASSIGN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_enumerator_definition_part_1;
+
+    m = sv_constant_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_enumerator_definition_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_enumerator_definition_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_enumerator_definition_part_2;
+
+    m = sv_enumerator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_enumerator_definition_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_enumerator_definition_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_enumerator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ENUMERATOR, parent);
+
+    // enumerator:
+    //   identifier()
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_enumerator_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_enumerator_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_enumerator_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_namespace_name(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x3;
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NAMESPACE_NAME, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // namespace-name:
+    //   namespace-alias
+    //   original-namespace-name
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_namespace_name_part_1;
+
+    m = sv_namespace_alias(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_namespace_name_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_namespace_name_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_namespace_name_part_2;
+
+    m = sv_original_namespace_name(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_namespace_name_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_namespace_name_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_namespace_definition(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_INLINE: viable |= 0x3; break;
+                    case ATOM_NAMESPACE: viable |= 0x3; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NAMESPACE_DEFINITION, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // namespace-definition:
+    //   unnamed-namespace-definition
+    //   named-namespace-definition
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_namespace_definition_part_1;
+
+    m = sv_unnamed_namespace_definition(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_namespace_definition_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_namespace_definition_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_namespace_definition_part_2;
+
+    m = sv_named_namespace_definition(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_namespace_definition_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_namespace_definition_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_named_namespace_definition(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_INLINE: viable |= 0x3; break;
+                    case ATOM_NAMESPACE: viable |= 0x3; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NAMED_NAMESPACE_DEFINITION, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // named-namespace-definition:
+    //   extension-namespace-definition
+    //   original-namespace-definition
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_named_namespace_definition_part_1;
+
+    m = sv_extension_namespace_definition(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_named_namespace_definition_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_named_namespace_definition_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_named_namespace_definition_part_2;
+
+    m = sv_original_namespace_definition(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_named_namespace_definition_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_named_namespace_definition_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_original_namespace_definition(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_INLINE: viable |= 0x1; break;
+                    case ATOM_NAMESPACE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ORIGINAL_NAMESPACE_DEFINITION, parent);
+
+    // original-namespace-definition:
+    //   [keyword("inline")] keyword("namespace") identifier() [gcc-attribute-specifier-seq] operator("{") namespace-body operator("}")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_original_namespace_definition_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_INLINE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_NAMESPACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_original_namespace_definition_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_original_namespace_definition_part_1;
+
+    m = sv_gcc_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LBRACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_original_namespace_definition_part_1;
+
+    m = sv_namespace_body(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_original_namespace_definition_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RBRACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_original_namespace_definition_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    original_namespace_definition_done(ctx, node);
+    return m;
+
+
+sv_original_namespace_definition_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_extension_namespace_definition(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_INLINE: viable |= 0x1; break;
+                    case ATOM_NAMESPACE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::EXTENSION_NAMESPACE_DEFINITION, parent);
+
+    // extension-namespace-definition:
+    //   [keyword("inline")] keyword("namespace") original-namespace-name [gcc-attribute-specifier-seq] operator("{") namespace-body operator("}")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_extension_namespace_definition_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_INLINE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_NAMESPACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_extension_namespace_definition_part_1;
+
+    m = sv_original_namespace_name(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_extension_namespace_definition_part_1;
+
+    m = sv_gcc_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LBRACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_extension_namespace_definition_part_1;
+
+    m = sv_namespace_body(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_extension_namespace_definition_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RBRACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_extension_namespace_definition_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_extension_namespace_definition_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_unnamed_namespace_definition(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_INLINE: viable |= 0x1; break;
+                    case ATOM_NAMESPACE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::UNNAMED_NAMESPACE_DEFINITION, parent);
+
+    // unnamed-namespace-definition:
+    //   [keyword("inline")] keyword("namespace") [gcc-attribute-specifier-seq] operator("{") namespace-body operator("}")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_unnamed_namespace_definition_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_INLINE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_NAMESPACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unnamed_namespace_definition_part_1;
+
+    m = sv_gcc_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LBRACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unnamed_namespace_definition_part_1;
+
+    m = sv_namespace_body(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_unnamed_namespace_definition_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RBRACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_unnamed_namespace_definition_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_unnamed_namespace_definition_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_namespace_body(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x1;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x1;
+                break;
+            default:
+                viable = 0x1;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NAMESPACE_BODY, parent);
+
+    // namespace-body:
+    //   [declaration-seq]
+
+    range_t m = b;
+
+
+    m = sv_declaration_seq(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_namespace_alias_definition(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_NAMESPACE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NAMESPACE_ALIAS_DEFINITION, parent);
+
+    // namespace-alias-definition:
+    //   keyword("namespace") identifier() operator("=") qualified-namespace-specifier operator(";")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_namespace_alias_definition_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_NAMESPACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_namespace_alias_definition_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_namespace_alias_definition_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ASSIGN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_namespace_alias_definition_part_1;
+
+    m = sv_qualified_namespace_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_namespace_alias_definition_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SEMICOLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_namespace_alias_definition_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_namespace_alias_definition_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_qualified_namespace_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::QUALIFIED_NAMESPACE_SPECIFIER, parent);
+
+    // qualified-namespace-specifier:
+    //   [nested-name-specifier] namespace-name
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_qualified_namespace_specifier_part_1;
+
+    m = sv_nested_name_specifier(ctx, node, m, &could_parse);
+
+    m = sv_namespace_name(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_qualified_namespace_specifier_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_qualified_namespace_specifier_part_1:
+    clear_nested_name_specifier(ctx, node);
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_using_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_USING: viable |= 0x3; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::USING_DECLARATION, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // using-declaration:
+    //   keyword("using") operator("::") unqualified-id operator(";")
+    //   keyword("using") [keyword("typename")] nested-name-specifier unqualified-id operator(";")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_using_declaration_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_USING))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_using_declaration_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SCOPE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_using_declaration_part_1;
+
+    m = sv_unqualified_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_using_declaration_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SEMICOLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_using_declaration_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_using_declaration_part_1:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_using_declaration_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_USING))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_using_declaration_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_TYPENAME))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    m = sv_nested_name_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_using_declaration_part_2;
+
+    m = sv_unqualified_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_using_declaration_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SEMICOLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_using_declaration_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_using_declaration_part_2:
+    clear_nested_name_specifier(ctx, node);
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_using_directive(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ALIGNAS: viable |= 0x1; break;
+                    case ATOM_USING: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::USING_DIRECTIVE, parent);
+
+    // using-directive:
+    //   [attribute-specifier-seq] keyword("using") keyword("namespace") [nested-name-specifier] namespace-name operator(";")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_using_directive_part_1;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_USING))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_using_directive_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_NAMESPACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_using_directive_part_1;
+
+    m = sv_nested_name_specifier(ctx, node, m, &could_parse);
+
+    m = sv_namespace_name(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_using_directive_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SEMICOLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_using_directive_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_using_directive_part_1:
+    clear_nested_name_specifier(ctx, node);
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_asm_definition(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ASM: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ASM_DEFINITION, parent);
+
+    // asm-definition:
+    //   keyword("asm") operator("(") lit-string() operator(")") operator(";")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_asm_definition_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_ASM))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_asm_definition_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_asm_definition_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::LIT_STRING))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_asm_definition_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_asm_definition_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SEMICOLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_asm_definition_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_asm_definition_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_linkage_specification(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_EXTERN: viable |= 0x3; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::LINKAGE_SPECIFICATION, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // linkage-specification:
+    //   keyword("extern") lit-string() declaration
+    //   keyword("extern") lit-string() operator("{") [declaration-seq] operator("}")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_linkage_specification_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_EXTERN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_linkage_specification_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::LIT_STRING))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_linkage_specification_part_1;
+
+    m = sv_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_linkage_specification_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_linkage_specification_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_linkage_specification_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_EXTERN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_linkage_specification_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::LIT_STRING))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_linkage_specification_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LBRACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_linkage_specification_part_2;
+
+    m = sv_declaration_seq(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RBRACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_linkage_specification_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_linkage_specification_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_attribute_specifier_seq(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ALIGNAS: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ATTRIBUTE_SPECIFIER_SEQ, parent);
+
+    // attribute-specifier-seq:
+    //   attribute-specifier { attribute-specifier }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_attribute_specifier_seq_part_1;
+
+    m = sv_attribute_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_attribute_specifier_seq_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_attribute_specifier(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_attribute_specifier_seq_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_attribute_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ALIGNAS: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ATTRIBUTE_SPECIFIER, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // attribute-specifier:
+    //   alignment-specifier
+    //   operator("[") operator("[") attribute-list operator("]") operator("]")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_attribute_specifier_part_1;
+
+    m = sv_alignment_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_attribute_specifier_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_attribute_specifier_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_attribute_specifier_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LBRACKET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_attribute_specifier_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LBRACKET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_attribute_specifier_part_2;
+
+    m = sv_attribute_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_attribute_specifier_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RBRACKET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_attribute_specifier_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RBRACKET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_attribute_specifier_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_attribute_specifier_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_gcc_attribute_specifier_seq(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ATTRIBUTE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::GCC_ATTRIBUTE_SPECIFIER_SEQ, parent);
+
+    // gcc-attribute-specifier-seq:
+    //   identifier("__attribute__") operator("(") operator("(") { gcc-attribute-specifier } operator(")") operator(")")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_gcc_attribute_specifier_seq_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_ATTRIBUTE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_gcc_attribute_specifier_seq_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_gcc_attribute_specifier_seq_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_gcc_attribute_specifier_seq_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_gcc_attribute_specifier(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_gcc_attribute_specifier_seq_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_gcc_attribute_specifier_seq_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_gcc_attribute_specifier_seq_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_gcc_attribute_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::GCC_ATTRIBUTE_SPECIFIER, parent);
+
+    // gcc-attribute-specifier:
+    //   identifier() [balanced-token]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_gcc_attribute_specifier_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_gcc_attribute_specifier_part_1;
+
+    m = sv_balanced_token(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_gcc_attribute_specifier_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_alignment_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ALIGNAS: viable |= 0x3; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ALIGNMENT_SPECIFIER, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // alignment-specifier:
+    //   keyword("alignas") operator("(") assignment-expression [operator("...")] operator(")")
+    //   keyword("alignas") operator("(") type-id [operator("...")] operator(")")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_alignment_specifier_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_ALIGNAS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_alignment_specifier_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_alignment_specifier_part_1;
+
+    m = sv_assignment_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_alignment_specifier_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ELLIPSIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_alignment_specifier_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_alignment_specifier_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_alignment_specifier_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_ALIGNAS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_alignment_specifier_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_alignment_specifier_part_2;
+
+    m = sv_type_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_alignment_specifier_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ELLIPSIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_alignment_specifier_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_alignment_specifier_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_attribute_list_entry(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ATTRIBUTE_LIST_ENTRY, parent);
+
+    // attribute-list-entry:
+    //   attribute [operator("...")]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_attribute_list_entry_part_1;
+
+    m = sv_attribute(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_attribute_list_entry_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ELLIPSIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_attribute_list_entry_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_attribute_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x1;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x1;
+                break;
+            default:
+                viable = 0x1;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ATTRIBUTE_LIST, parent);
+
+    // attribute-list:
+    //   [attribute-list-entry] { operator(",") [attribute-list-entry] }
+
+    range_t m = b;
+
+
+    m = sv_attribute_list_entry(ctx, node, m, &could_parse);
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COMMA))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_attribute_list_entry(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_attribute(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ATTRIBUTE, parent);
+
+    // attribute:
+    //   attribute-token [attribute-argument-clause]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_attribute_part_1;
+
+    m = sv_attribute_token(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_attribute_part_1;
+
+    m = sv_attribute_argument_clause(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_attribute_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_attribute_token(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x3;
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ATTRIBUTE_TOKEN, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // attribute-token:
+    //   attribute-scoped-token
+    //   identifier()
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_attribute_token_part_1;
+
+    m = sv_attribute_scoped_token(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_attribute_token_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_attribute_token_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_attribute_token_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_attribute_token_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_attribute_token_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_attribute_scoped_token(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ATTRIBUTE_SCOPED_TOKEN, parent);
+
+    // attribute-scoped-token:
+    //   attribute-namespace operator("::") identifier()
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_attribute_scoped_token_part_1;
+
+    m = sv_attribute_namespace(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_attribute_scoped_token_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SCOPE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_attribute_scoped_token_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_attribute_scoped_token_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_attribute_scoped_token_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_attribute_namespace(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ATTRIBUTE_NAMESPACE, parent);
+
+    // attribute-namespace:
+    //   identifier()
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_attribute_namespace_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_attribute_namespace_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_attribute_namespace_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_attribute_argument_clause(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ATTRIBUTE_ARGUMENT_CLAUSE, parent);
+
+    // attribute-argument-clause:
+    //   operator("(") balanced-token-seq operator(")")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_attribute_argument_clause_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_attribute_argument_clause_part_1;
+
+    m = sv_balanced_token_seq(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_attribute_argument_clause_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_attribute_argument_clause_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_attribute_argument_clause_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_balanced_token_seq(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x1;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x1;
+                break;
+            default:
+                viable = 0x1;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::BALANCED_TOKEN_SEQ, parent);
+
+    // balanced-token-seq:
+    //   { balanced-token }
+
+    range_t m = b;
+
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_balanced_token(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_balanced_token(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x8;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x2; break;
+                    case ATOM_LBRACE: viable |= 0x4; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x8;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::BALANCED_TOKEN, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // balanced-token:
+    //   operator("(") balanced-token-seq operator(")")
+    //   operator("[") balanced-token-seq operator("]")
+    //   operator("{") balanced-token-seq operator("}")
+    //   trivially-balanced-token
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_balanced_token_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_balanced_token_part_1;
+
+    m = sv_balanced_token_seq(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_balanced_token_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_balanced_token_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_balanced_token_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_balanced_token_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LBRACKET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_balanced_token_part_2;
+
+    m = sv_balanced_token_seq(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_balanced_token_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RBRACKET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_balanced_token_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_balanced_token_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_balanced_token_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LBRACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_balanced_token_part_3;
+
+    m = sv_balanced_token_seq(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_balanced_token_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RBRACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_balanced_token_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_balanced_token_part_3:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    m = sv_trivially_balanced_token(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_balanced_token_part_4;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_balanced_token_part_4:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_init_declarator_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_ELLIPSIS: viable |= 0x1; break;
+                    case ATOM_AMP_AMP: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::INIT_DECLARATOR_LIST, parent);
+
+    // init-declarator-list:
+    //   init-declarator { operator(",") init-declarator }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_init_declarator_list_part_1;
+
+    m = sv_init_declarator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_init_declarator_list_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COMMA))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_init_declarator(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_init_declarator_list_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_init_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_ELLIPSIS: viable |= 0x1; break;
+                    case ATOM_AMP_AMP: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::INIT_DECLARATOR, parent);
+
+    // init-declarator:
+    //   declarator [initializer]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_init_declarator_part_1;
+
+    m = sv_declarator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_init_declarator_part_1;
+
+    m = sv_initializer(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_init_declarator_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x3;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x3; break;
+                    case ATOM_SCOPE: viable |= 0x3; break;
+                    case ATOM_ELLIPSIS: viable |= 0x3; break;
+                    case ATOM_TILDE: viable |= 0x3; break;
+                    case ATOM_AMP_AMP: viable |= 0x2; break;
+                    case ATOM_AMP: viable |= 0x2; break;
+                    case ATOM_STAR: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::DECLARATOR, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // declarator:
+    //   noptr-declarator parameters-and-qualifiers trailing-return-type
+    //   ptr-declarator
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_declarator_part_1;
+
+    m = sv_noptr_declarator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_declarator_part_1;
+
+    m = sv_parameters_and_qualifiers(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_declarator_part_1;
+
+    m = sv_trailing_return_type(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_declarator_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_declarator_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_declarator_part_2;
+
+    m = sv_ptr_declarator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_declarator_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_declarator_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_ptr_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_AMP_AMP: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_ELLIPSIS: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::PTR_DECLARATOR, parent);
+
+    // ptr-declarator:
+    //   { ptr-operator } noptr-declarator
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_ptr_declarator_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_ptr_operator(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    m = sv_noptr_declarator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_ptr_declarator_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_ptr_declarator_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_noptr_declarator_repeatable(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    case ATOM_LPAREN: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NOPTR_DECLARATOR_REPEATABLE, parent, true);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // noptr-declarator-repeatable:
+    //   operator("[") [constant-expression] operator("]") [attribute-specifier-seq]
+    //   parameters-and-qualifiers
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_noptr_declarator_repeatable_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LBRACKET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_noptr_declarator_repeatable_part_1;
+
+    m = sv_constant_expression(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RBRACKET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_noptr_declarator_repeatable_part_1;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_noptr_declarator_repeatable_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_noptr_declarator_repeatable_part_2;
+
+    m = sv_parameters_and_qualifiers(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_noptr_declarator_repeatable_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_noptr_declarator_repeatable_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_noptr_declarator_start(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x2;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x2; break;
+                    case ATOM_ELLIPSIS: viable |= 0x2; break;
+                    case ATOM_TILDE: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NOPTR_DECLARATOR_START, parent, true);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // noptr-declarator-start:
+    //   operator("(") ptr-declarator operator(")")
+    //   declarator-id [attribute-specifier-seq]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_noptr_declarator_start_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_noptr_declarator_start_part_1;
+
+    m = sv_ptr_declarator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_noptr_declarator_start_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_noptr_declarator_start_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_noptr_declarator_start_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_noptr_declarator_start_part_2;
+
+    m = sv_declarator_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_noptr_declarator_start_part_2;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_noptr_declarator_start_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_noptr_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_ELLIPSIS: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NOPTR_DECLARATOR, parent);
+
+    // noptr-declarator:
+    //   noptr-declarator-start { noptr-declarator-repeatable }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_noptr_declarator_part_1;
+
+    m = sv_noptr_declarator_start(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_noptr_declarator_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_noptr_declarator_repeatable(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    m = repair_noptr_declarator(ctx, node, m, success);
+    return m;
+
+
+sv_noptr_declarator_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_parameters_and_qualifiers(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::PARAMETERS_AND_QUALIFIERS, parent);
+
+    // parameters-and-qualifiers:
+    //   operator("(") parameter-declaration-clause operator(")") [attribute-specifier-seq] [cv-qualifier-seq] [ref-qualifier] [exception-specification]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_parameters_and_qualifiers_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_parameters_and_qualifiers_part_1;
+
+    m = sv_parameter_declaration_clause(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_parameters_and_qualifiers_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_parameters_and_qualifiers_part_1;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_cv_qualifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_ref_qualifier(ctx, node, m, &could_parse);
+
+    m = sv_exception_specification(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_parameters_and_qualifiers_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_trailing_return_type(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ARROW: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TRAILING_RETURN_TYPE, parent);
+
+    // trailing-return-type:
+    //   operator("->") trailing-type-specifier-seq [abstract-declarator]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_trailing_return_type_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ARROW))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_trailing_return_type_part_1;
+
+    m = sv_trailing_type_specifier_seq(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_trailing_return_type_part_1;
+
+    m = sv_abstract_declarator(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_trailing_return_type_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_ptr_operator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_AMP_AMP: viable |= 0x2; break;
+                    case ATOM_AMP: viable |= 0x4; break;
+                    case ATOM_STAR: viable |= 0x8; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::PTR_OPERATOR, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // ptr-operator:
+    //   nested-name-specifier operator("*") [attribute-specifier-seq] [cv-qualifier-seq]
+    //   operator("&&") [attribute-specifier-seq]
+    //   operator("&") [attribute-specifier-seq]
+    //   operator("*") [attribute-specifier-seq] [cv-qualifier]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_ptr_operator_part_1;
+
+    m = sv_nested_name_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_ptr_operator_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_STAR))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_ptr_operator_part_1;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_cv_qualifier_seq(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_ptr_operator_part_1:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_ptr_operator_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_AMP_AMP))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_ptr_operator_part_2;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_ptr_operator_part_2:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_ptr_operator_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_AMP))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_ptr_operator_part_3;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_ptr_operator_part_3:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_ptr_operator_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_STAR))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_ptr_operator_part_4;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_cv_qualifier(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_ptr_operator_part_4:
+    clear_nested_name_specifier(ctx, node);
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_cv_qualifier_seq(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_VOLATILE: viable |= 0x1; break;
+                    case ATOM_CONST: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::CV_QUALIFIER_SEQ, parent);
+
+    // cv-qualifier-seq:
+    //   cv_qualifier { cv_qualifier }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_cv_qualifier_seq_part_1;
+
+    m = sv_cv_qualifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_cv_qualifier_seq_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_cv_qualifier(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_cv_qualifier_seq_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_cv_qualifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_VOLATILE: viable |= 0x1; break;
+                    case ATOM_CONST: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::CV_QUALIFIER, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // cv_qualifier:
+    //   keyword("volatile")
+    //   keyword("const")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_cv_qualifier_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_VOLATILE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_cv_qualifier_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_cv_qualifier_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_cv_qualifier_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_CONST))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_cv_qualifier_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_cv_qualifier_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_ref_qualifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_AMP_AMP: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::REF_QUALIFIER, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // ref-qualifier:
+    //   operator("&&")
+    //   operator("&")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_ref_qualifier_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_AMP_AMP))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_ref_qualifier_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_ref_qualifier_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_ref_qualifier_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_AMP))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_ref_qualifier_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_ref_qualifier_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_declarator_id(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x3;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x3; break;
+                    case ATOM_ELLIPSIS: viable |= 0x2; break;
+                    case ATOM_TILDE: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::DECLARATOR_ID, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // declarator-id:
+    //   [nested-name-specifier] class-name
+    //   [operator("...")] id-expression
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_declarator_id_part_1;
+
+    m = sv_nested_name_specifier(ctx, node, m, &could_parse);
+
+    m = sv_class_name(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_declarator_id_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_declarator_id_part_1:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_declarator_id_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ELLIPSIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    m = sv_id_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_declarator_id_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_declarator_id_part_2:
+    clear_nested_name_specifier(ctx, node);
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_type_id(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TYPE_ID, parent);
+
+    // type-id:
+    //   type-specifier-seq [abstract-declarator]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_type_id_part_1;
+
+    m = sv_type_specifier_seq(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_type_id_part_1;
+
+    m = sv_abstract_declarator(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_type_id_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_abstract_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x5;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x5; break;
+                    case ATOM_AMP_AMP: viable |= 0x5; break;
+                    case ATOM_AMP: viable |= 0x5; break;
+                    case ATOM_STAR: viable |= 0x5; break;
+                    case ATOM_ELLIPSIS: viable |= 0x1; break;
+                    case ATOM_LPAREN: viable |= 0x6; break;
+                    case ATOM_LBRACKET: viable |= 0x6; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ABSTRACT_DECLARATOR, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // abstract-declarator:
+    //   abstract-pack-declarator
+    //   [noptr-abstract-declarator] parameters-and-qualifiers trailing-return-type
+    //   ptr-abstract-declarator
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_abstract_declarator_part_1;
+
+    m = sv_abstract_pack_declarator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_abstract_declarator_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_abstract_declarator_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_abstract_declarator_part_2;
+
+    m = sv_noptr_abstract_declarator(ctx, node, m, &could_parse);
+
+    m = sv_parameters_and_qualifiers(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_abstract_declarator_part_2;
+
+    m = sv_trailing_return_type(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_abstract_declarator_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_abstract_declarator_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_abstract_declarator_part_3;
+
+    m = sv_ptr_abstract_declarator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_abstract_declarator_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_abstract_declarator_part_3:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_ptr_abstract_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x2;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x2; break;
+                    case ATOM_AMP_AMP: viable |= 0x2; break;
+                    case ATOM_AMP: viable |= 0x2; break;
+                    case ATOM_STAR: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::PTR_ABSTRACT_DECLARATOR, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // ptr-abstract-declarator:
+    //   noptr-abstract-declarator
+    //   ptr-operator { ptr-operator } [noptr-abstract-declarator]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_ptr_abstract_declarator_part_1;
+
+    m = sv_noptr_abstract_declarator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_ptr_abstract_declarator_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_ptr_abstract_declarator_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_ptr_abstract_declarator_part_2;
+
+    m = sv_ptr_operator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_ptr_abstract_declarator_part_2;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_ptr_operator(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    m = sv_noptr_abstract_declarator(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_ptr_abstract_declarator_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_noptr_abstract_declarator_repeatable(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    case ATOM_LPAREN: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NOPTR_ABSTRACT_DECLARATOR_REPEATABLE, parent, true);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // noptr-abstract-declarator-repeatable:
+    //   operator("[") [constant-expression] operator("]") [attribute-specifier-seq]
+    //   parameters-and-qualifiers
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_noptr_abstract_declarator_repeatable_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LBRACKET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_noptr_abstract_declarator_repeatable_part_1;
+
+    m = sv_constant_expression(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RBRACKET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_noptr_abstract_declarator_repeatable_part_1;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_noptr_abstract_declarator_repeatable_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_noptr_abstract_declarator_repeatable_part_2;
+
+    m = sv_parameters_and_qualifiers(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_noptr_abstract_declarator_repeatable_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_noptr_abstract_declarator_repeatable_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_noptr_abstract_declarator_start(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NOPTR_ABSTRACT_DECLARATOR_START, parent, true);
+
+    // noptr-abstract-declarator-start:
+    //   operator("(") ptr-abstract-declarator operator(")")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_noptr_abstract_declarator_start_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_noptr_abstract_declarator_start_part_1;
+
+    m = sv_ptr_abstract_declarator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_noptr_abstract_declarator_start_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_noptr_abstract_declarator_start_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_noptr_abstract_declarator_start_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_noptr_abstract_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x3; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NOPTR_ABSTRACT_DECLARATOR, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // noptr-abstract-declarator:
+    //   [noptr-abstract-declarator-start] noptr-abstract-declarator-repeatable { noptr-abstract-declarator-repeatable }
+    //   noptr-abstract-declarator-start
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_noptr_abstract_declarator_part_1;
+
+    m = sv_noptr_abstract_declarator_start(ctx, node, m, &could_parse);
+
+    m = sv_noptr_abstract_declarator_repeatable(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_noptr_abstract_declarator_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_noptr_abstract_declarator_repeatable(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_noptr_abstract_declarator_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_noptr_abstract_declarator_part_2;
+
+    m = sv_noptr_abstract_declarator_start(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_noptr_abstract_declarator_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_noptr_abstract_declarator_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_abstract_pack_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_AMP_AMP: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_ELLIPSIS: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ABSTRACT_PACK_DECLARATOR, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // abstract-pack-declarator:
+    //   ptr-operator abstract-pack-declarator
+    //   noptr-abstract-pack-declarator
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_abstract_pack_declarator_part_1;
+
+    m = sv_ptr_operator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_abstract_pack_declarator_part_1;
+
+    m = sv_abstract_pack_declarator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_abstract_pack_declarator_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_abstract_pack_declarator_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_abstract_pack_declarator_part_2;
+
+    m = sv_noptr_abstract_pack_declarator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_abstract_pack_declarator_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_abstract_pack_declarator_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_noptr_abstract_pack_declarator_repeatable(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    case ATOM_LPAREN: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NOPTR_ABSTRACT_PACK_DECLARATOR_REPEATABLE, parent, true);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // noptr-abstract-pack-declarator-repeatable:
+    //   operator("[") [constant-expression] operator("]") [attribute-specifier-seq]
+    //   parameters-and-qualifiers
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_noptr_abstract_pack_declarator_repeatable_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LBRACKET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_noptr_abstract_pack_declarator_repeatable_part_1;
+
+    m = sv_constant_expression(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RBRACKET))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_noptr_abstract_pack_declarator_repeatable_part_1;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_noptr_abstract_pack_declarator_repeatable_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_noptr_abstract_pack_declarator_repeatable_part_2;
+
+    m = sv_parameters_and_qualifiers(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_noptr_abstract_pack_declarator_repeatable_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_noptr_abstract_pack_declarator_repeatable_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_noptr_abstract_pack_declarator_start(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ELLIPSIS: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NOPTR_ABSTRACT_PACK_DECLARATOR_START, parent, true);
+
+    // noptr-abstract-pack-declarator-start:
+    //   operator("...")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_noptr_abstract_pack_declarator_start_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ELLIPSIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_noptr_abstract_pack_declarator_start_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_noptr_abstract_pack_declarator_start_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_noptr_abstract_pack_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ELLIPSIS: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NOPTR_ABSTRACT_PACK_DECLARATOR, parent);
+
+    // noptr-abstract-pack-declarator:
+    //   noptr-abstract-pack-declarator-start { noptr-abstract-pack-declarator-repeatable }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_noptr_abstract_pack_declarator_part_1;
+
+    m = sv_noptr_abstract_pack_declarator_start(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_noptr_abstract_pack_declarator_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_noptr_abstract_pack_declarator_repeatable(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_noptr_abstract_pack_declarator_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_parameter_declaration_clause(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x2;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x3;
+                break;
+            case token::OPERATOR:
+                viable = 0x2;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x2;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::PARAMETER_DECLARATION_CLAUSE, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // parameter-declaration-clause:
+    //   parameter-declaration-list operator(",") operator("...")
+    //   [parameter-declaration-list] [operator("...")]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_parameter_declaration_clause_part_1;
+
+    m = sv_parameter_declaration_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_parameter_declaration_clause_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COMMA))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_parameter_declaration_clause_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ELLIPSIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_parameter_declaration_clause_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_parameter_declaration_clause_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    m = sv_parameter_declaration_list(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ELLIPSIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_parameter_declaration_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::PARAMETER_DECLARATION_LIST, parent);
+
+    // parameter-declaration-list:
+    //   parameter-declaration { operator(",") parameter-declaration }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_parameter_declaration_list_part_1;
+
+    m = sv_parameter_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_parameter_declaration_list_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COMMA))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_parameter_declaration(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_parameter_declaration_list_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_parameter_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0xf;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0xf; break;
+                    case ATOM_SCOPE: viable |= 0xf; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::PARAMETER_DECLARATION, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // parameter-declaration:
+    //   [attribute-specifier-seq] decl-specifier-seq declarator operator("=") initializer-clause
+    //   [attribute-specifier-seq] decl-specifier-seq declarator
+    //   [attribute-specifier-seq] decl-specifier-seq [abstract-declarator] operator("=") initializer-clause
+    //   [attribute-specifier-seq] decl-specifier-seq [abstract-declarator]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_parameter_declaration_part_1;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_decl_specifier_seq(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_parameter_declaration_part_1;
+
+    m = sv_declarator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_parameter_declaration_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ASSIGN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_parameter_declaration_part_1;
+
+    m = sv_initializer_clause(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_parameter_declaration_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_parameter_declaration_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_parameter_declaration_part_2;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_decl_specifier_seq(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_parameter_declaration_part_2;
+
+    m = sv_declarator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_parameter_declaration_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_parameter_declaration_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_parameter_declaration_part_3;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_decl_specifier_seq(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_parameter_declaration_part_3;
+
+    m = sv_abstract_declarator(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ASSIGN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_parameter_declaration_part_3;
+
+    m = sv_initializer_clause(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_parameter_declaration_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_parameter_declaration_part_3:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_parameter_declaration_part_4;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_decl_specifier_seq(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_parameter_declaration_part_4;
+
+    m = sv_abstract_declarator(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_parameter_declaration_part_4:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_function_definition(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_ELLIPSIS: viable |= 0x1; break;
+                    case ATOM_AMP_AMP: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::FUNCTION_DEFINITION, parent);
+
+    // function-definition:
+    //   [attribute-specifier-seq] [decl-specifier-seq] declarator [virt-specifier-seq] function-body
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_function_definition_part_1;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_decl_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_declarator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_function_definition_part_1;
+
+    m = sv_virt_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_function_body(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_function_definition_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_function_definition_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_function_body(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ASSIGN: viable |= 0x3; break;
+                    case ATOM_COLON: viable |= 0x8; break;
+                    case ATOM_LBRACE: viable |= 0x8; break;
+                    default: break;
+                }
+                break;
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_TRY: viable |= 0x4; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::FUNCTION_BODY, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // function-body:
+    //   operator("=") operator("delete") operator(";")
+    //   operator("=") keyword("default") operator(";")
+    //   function-try-block
+    //   [ctor-initializer] compound-statement
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_function_body_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ASSIGN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_function_body_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_DELETE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_function_body_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SEMICOLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_function_body_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_function_body_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_function_body_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ASSIGN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_function_body_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_DEFAULT))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_function_body_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SEMICOLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_function_body_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_function_body_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_function_body_part_3;
+
+    m = sv_function_try_block(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_function_body_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_function_body_part_3:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_function_body_part_4;
+
+    m = sv_ctor_initializer(ctx, node, m, &could_parse);
+
+    m = sv_compound_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_function_body_part_4;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_function_body_part_4:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_initializer(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_ASSIGN: viable |= 0x2; break;
+                    case ATOM_LBRACE: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::INITIALIZER, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // initializer:
+    //   operator("(") expression-list operator(")")
+    //   brace-or-equal-initializer
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_initializer_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_initializer_part_1;
+
+    m = sv_expression_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_initializer_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_initializer_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_initializer_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_initializer_part_2;
+
+    m = sv_brace_or_equal_initializer(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_initializer_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_initializer_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_brace_or_equal_initializer(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACE: viable |= 0x1; break;
+                    case ATOM_ASSIGN: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::BRACE_OR_EQUAL_INITIALIZER, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // brace-or-equal-initializer:
+    //   braced-init-list
+    //   operator("=") initializer-clause
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_brace_or_equal_initializer_part_1;
+
+    m = sv_braced_init_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_brace_or_equal_initializer_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_brace_or_equal_initializer_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_brace_or_equal_initializer_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ASSIGN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_brace_or_equal_initializer_part_2;
+
+    m = sv_initializer_clause(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_brace_or_equal_initializer_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_brace_or_equal_initializer_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_initializer_clause(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x2;
+                break;
+            case token::IDENTIFIER:
+                viable = 0x2;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACE: viable |= 0x1; break;
+                    case ATOM_LPAREN: viable |= 0x2; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x2; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x2; break;
+                    case ATOM_SCOPE: viable |= 0x2; break;
+                    case ATOM_DELETE: viable |= 0x2; break;
+                    case ATOM_NEW: viable |= 0x2; break;
+                    case ATOM_TILDE: viable |= 0x2; break;
+                    case ATOM_EXCLAIM: viable |= 0x2; break;
+                    case ATOM_MINUS: viable |= 0x2; break;
+                    case ATOM_PLUS: viable |= 0x2; break;
+                    case ATOM_AMP: viable |= 0x2; break;
+                    case ATOM_STAR: viable |= 0x2; break;
+                    case ATOM_LBRACKET: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::INITIALIZER_CLAUSE, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // initializer-clause:
+    //   braced-init-list
+    //   assignment-expression
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_initializer_clause_part_1;
+
+    m = sv_braced_init_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_initializer_clause_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_initializer_clause_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_initializer_clause_part_2;
+
+    m = sv_assignment_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_initializer_clause_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_initializer_clause_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_initializer_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x1;
+                break;
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x1; break;
+                    case ATOM_LBRACE: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_DELETE: viable |= 0x1; break;
+                    case ATOM_NEW: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    case ATOM_EXCLAIM: viable |= 0x1; break;
+                    case ATOM_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::INITIALIZER_LIST, parent);
+
+    // initializer-list:
+    //   initializer-clause [operator("...")] { operator(",") initializer-clause [operator("...")] }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_initializer_list_part_1;
+
+    m = sv_initializer_clause(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_initializer_list_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ELLIPSIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COMMA))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_initializer_clause(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ELLIPSIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_initializer_list_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_braced_init_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACE: viable |= 0x3; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::BRACED_INIT_LIST, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // braced-init-list:
+    //   operator("{") operator("}")
+    //   operator("{") initializer-list [operator(",")] operator("}")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_braced_init_list_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LBRACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_braced_init_list_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RBRACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_braced_init_list_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_braced_init_list_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_braced_init_list_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LBRACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_braced_init_list_part_2;
+
+    m = sv_initializer_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_braced_init_list_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COMMA))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RBRACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_braced_init_list_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_braced_init_list_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_class_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_UNION: viable |= 0x1; break;
+                    case ATOM_STRUCT: viable |= 0x1; break;
+                    case ATOM_CLASS: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::CLASS_SPECIFIER, parent);
+
+    // class-specifier:
+    //   class-head operator("{") [member-specification] operator("}")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_class_specifier_part_1;
+
+    m = sv_class_head(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_class_specifier_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LBRACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_class_specifier_part_1;
+
+    m = sv_member_specification(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RBRACE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_class_specifier_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    class_specifier_done(ctx, node);
+    return m;
+
+
+sv_class_specifier_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_class_head(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_UNION: viable |= 0x3; break;
+                    case ATOM_STRUCT: viable |= 0x3; break;
+                    case ATOM_CLASS: viable |= 0x3; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::CLASS_HEAD, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // class-head:
+    //   class-key [attribute-specifier-seq] class-head-name [class-virt-specifier] [base-clause]
+    //   class-key [attribute-specifier-seq] [base-clause]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_class_head_part_1;
+
+    m = sv_class_key(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_class_head_part_1;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_class_head_name(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_class_head_part_1;
+
+    m = sv_class_virt_specifier(ctx, node, m, &could_parse);
+
+    m = sv_base_clause(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_class_head_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_class_head_part_2;
+
+    m = sv_class_key(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_class_head_part_2;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_base_clause(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_class_head_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_class_head_name(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::CLASS_HEAD_NAME, parent);
+
+    // class-head-name:
+    //   [nested-name-specifier] class-name
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_class_head_name_part_1;
+
+    m = sv_nested_name_specifier(ctx, node, m, &could_parse);
+
+    m = sv_class_name(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_class_head_name_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_class_head_name_part_1:
+    clear_nested_name_specifier(ctx, node);
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_class_virt_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_FINAL: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::CLASS_VIRT_SPECIFIER, parent);
+
+    // class-virt-specifier:
+    //   identifier("final")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_class_virt_specifier_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_FINAL))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_class_virt_specifier_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_class_virt_specifier_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_class_key(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_UNION: viable |= 0x1; break;
+                    case ATOM_STRUCT: viable |= 0x2; break;
+                    case ATOM_CLASS: viable |= 0x4; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::CLASS_KEY, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // class-key:
+    //   keyword("union")
+    //   keyword("struct")
+    //   keyword("class")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_class_key_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_UNION))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_class_key_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_class_key_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_class_key_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_STRUCT))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_class_key_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_class_key_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_class_key_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_CLASS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_class_key_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_class_key_part_3:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_member_specification(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x2;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_PUBLIC: viable |= 0x1; break;
+                    case ATOM_PROTECTED: viable |= 0x1; break;
+                    case ATOM_PRIVATE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SEMICOLON: viable |= 0x2; break;
+                    case ATOM_LBRACKET: viable |= 0x2; break;
+                    case ATOM_LPAREN: viable |= 0x2; break;
+                    case ATOM_SCOPE: viable |= 0x2; break;
+                    case ATOM_ELLIPSIS: viable |= 0x2; break;
+                    case ATOM_AMP_AMP: viable |= 0x2; break;
+                    case ATOM_AMP: viable |= 0x2; break;
+                    case ATOM_STAR: viable |= 0x2; break;
+                    case ATOM_COLON: viable |= 0x2; break;
+                    case ATOM_TILDE: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::MEMBER_SPECIFICATION, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // member-specification:
+    //   access-specifier operator(":") [member-specification]
+    //   member-declaration [member-specification]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_member_specification_part_1;
+
+    m = sv_access_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_member_specification_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_member_specification_part_1;
+
+    m = sv_member_specification(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_member_specification_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_member_specification_part_2;
+
+    m = sv_member_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_member_specification_part_2;
+
+    m = sv_member_specification(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_member_specification_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_member_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x30;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_USING: viable |= 0x9; break;
+                    case ATOM_TEMPLATE: viable |= 0x2; break;
+                    case ATOM_STATIC_ASSERT: viable |= 0x4; break;
+                    default: break;
+                }
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x30; break;
+                    case ATOM_LPAREN: viable |= 0x30; break;
+                    case ATOM_SCOPE: viable |= 0x30; break;
+                    case ATOM_ELLIPSIS: viable |= 0x30; break;
+                    case ATOM_AMP_AMP: viable |= 0x30; break;
+                    case ATOM_AMP: viable |= 0x30; break;
+                    case ATOM_STAR: viable |= 0x30; break;
+                    case ATOM_TILDE: viable |= 0x30; break;
+                    case ATOM_COLON: viable |= 0x20; break;
+                    case ATOM_SEMICOLON: viable |= 0x20; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::MEMBER_DECLARATION, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // member-declaration:
+    //   alias-declaration
+    //   template-declaration
+    //   static_assert-declaration
+    //   using-declaration
+    //   function-definition [operator(";")]
+    //   [attribute-specifier-seq] [decl-specifier-seq] [member-declarator-list] operator(";")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_member_declaration_part_1;
+
+    m = sv_alias_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_member_declaration_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_member_declaration_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_member_declaration_part_2;
+
+    m = sv_template_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_member_declaration_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_member_declaration_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_member_declaration_part_3;
+
+    m = sv_static_assert_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_member_declaration_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_member_declaration_part_3:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_member_declaration_part_4;
+
+    m = sv_using_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_member_declaration_part_4;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_member_declaration_part_4:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x10))
+        goto sv_member_declaration_part_5;
+
+    m = sv_function_definition(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_member_declaration_part_5;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SEMICOLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_member_declaration_part_5:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x20))
+        goto sv_member_declaration_part_6;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_decl_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_member_declarator_list(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_SEMICOLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_member_declaration_part_6;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_member_declaration_part_6:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_member_declarator_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_COLON: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_ELLIPSIS: viable |= 0x1; break;
+                    case ATOM_AMP_AMP: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::MEMBER_DECLARATOR_LIST, parent);
+
+    // member-declarator-list:
+    //   member-declarator { operator(",") member-declarator }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_member_declarator_list_part_1;
+
+    m = sv_member_declarator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_member_declarator_list_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COMMA))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_member_declarator(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_member_declarator_list_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_member_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x7;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    case ATOM_COLON: viable |= 0x1; break;
+                    case ATOM_LPAREN: viable |= 0x6; break;
+                    case ATOM_SCOPE: viable |= 0x6; break;
+                    case ATOM_ELLIPSIS: viable |= 0x6; break;
+                    case ATOM_AMP_AMP: viable |= 0x6; break;
+                    case ATOM_AMP: viable |= 0x6; break;
+                    case ATOM_STAR: viable |= 0x6; break;
+                    case ATOM_TILDE: viable |= 0x6; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::MEMBER_DECLARATOR, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // member-declarator:
+    //   [identifier()] [attribute-specifier-seq] operator(":") constant-expression
+    //   declarator [brace-or-equal-initializer]
+    //   declarator [virt-specifier-seq] [pure-specifier]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_member_declarator_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_member_declarator_part_1;
+
+    m = sv_constant_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_member_declarator_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_member_declarator_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_member_declarator_part_2;
+
+    m = sv_declarator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_member_declarator_part_2;
+
+    m = sv_brace_or_equal_initializer(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_member_declarator_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_member_declarator_part_3;
+
+    m = sv_declarator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_member_declarator_part_3;
+
+    m = sv_virt_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_pure_specifier(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_member_declarator_part_3:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_virt_specifier_seq(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_FINAL: viable |= 0x1; break;
+                    case ATOM_OVERRIDE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::VIRT_SPECIFIER_SEQ, parent);
+
+    // virt-specifier-seq:
+    //   virt-specifier { virt-specifier }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_virt_specifier_seq_part_1;
+
+    m = sv_virt_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_virt_specifier_seq_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_virt_specifier(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_virt_specifier_seq_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_virt_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_FINAL: viable |= 0x1; break;
+                    case ATOM_OVERRIDE: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::VIRT_SPECIFIER, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // virt-specifier:
+    //   identifier("final")
+    //   identifier("override")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_virt_specifier_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_FINAL))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_virt_specifier_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_virt_specifier_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_virt_specifier_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_OVERRIDE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_virt_specifier_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_virt_specifier_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_pure_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ASSIGN: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::PURE_SPECIFIER, parent);
+
+    // pure-specifier:
+    //   operator("=") lit-integer(0)
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_pure_specifier_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ASSIGN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_pure_specifier_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::LIT_INTEGER) && (ctx->tokens->integer_value(m).value.s == 0))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_pure_specifier_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_pure_specifier_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_base_clause(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_COLON: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::BASE_CLAUSE, parent);
+
+    // base-clause:
+    //   operator(":") base-specifier-list
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_base_clause_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_base_clause_part_1;
+
+    m = sv_base_specifier_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_base_clause_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_base_clause_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_base_specifier_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::BASE_SPECIFIER_LIST, parent);
+
+    // base-specifier-list:
+    //   base-specifier [operator("...")] { operator(",") base-specifier [operator("...")] }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_base_specifier_list_part_1;
+
+    m = sv_base_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_base_specifier_list_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ELLIPSIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COMMA))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_base_specifier(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ELLIPSIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_base_specifier_list_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_base_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x4;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ALIGNAS: viable |= 0x3; break;
+                    case ATOM_VIRTUAL: viable |= 0x1; break;
+                    case ATOM_PUBLIC: viable |= 0x2; break;
+                    case ATOM_PROTECTED: viable |= 0x2; break;
+                    case ATOM_PRIVATE: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x7; break;
+                    case ATOM_SCOPE: viable |= 0x4; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::BASE_SPECIFIER, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // base-specifier:
+    //   [attribute-specifier-seq] keyword("virtual") [access-specifier] base-type-specifier
+    //   [attribute-specifier-seq] access-specifier [keyword("virtual")] base-type-specifier
+    //   [attribute-specifier-seq] base-type-specifier
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_base_specifier_part_1;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_VIRTUAL))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_base_specifier_part_1;
+
+    m = sv_access_specifier(ctx, node, m, &could_parse);
+
+    m = sv_base_type_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_base_specifier_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_base_specifier_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_base_specifier_part_2;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_access_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_base_specifier_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_VIRTUAL))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    m = sv_base_type_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_base_specifier_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_base_specifier_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_base_specifier_part_3;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_base_type_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_base_specifier_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_base_specifier_part_3:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_class_or_decltype(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x2;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_DECLTYPE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::CLASS_OR_DECLTYPE, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // class-or-decltype:
+    //   decltype-specifier
+    //   [nested-name-specifier] class-name
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_class_or_decltype_part_1;
+
+    m = sv_decltype_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_class_or_decltype_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_class_or_decltype_part_1:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_class_or_decltype_part_2;
+
+    m = sv_nested_name_specifier(ctx, node, m, &could_parse);
+
+    m = sv_class_name(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_class_or_decltype_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_class_or_decltype_part_2:
+    clear_nested_name_specifier(ctx, node);
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_base_type_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::BASE_TYPE_SPECIFIER, parent);
+
+    // base-type-specifier:
+    //   class-or-decltype
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_base_type_specifier_part_1;
+
+    m = sv_class_or_decltype(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_base_type_specifier_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_base_type_specifier_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_access_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_PUBLIC: viable |= 0x1; break;
+                    case ATOM_PROTECTED: viable |= 0x2; break;
+                    case ATOM_PRIVATE: viable |= 0x4; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ACCESS_SPECIFIER, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // access-specifier:
+    //   keyword("public")
+    //   keyword("protected")
+    //   keyword("private")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_access_specifier_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_PUBLIC))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_access_specifier_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_access_specifier_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_access_specifier_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_PROTECTED))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_access_specifier_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_access_specifier_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_access_specifier_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_PRIVATE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_access_specifier_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_access_specifier_part_3:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_conversion_function_id(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_OPERATOR: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::CONVERSION_FUNCTION_ID, parent);
+
+    // conversion-function-id:
+    //   keyword("operator") conversion-type-id
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_conversion_function_id_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_OPERATOR))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_conversion_function_id_part_1;
+
+    m = sv_conversion_type_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_conversion_function_id_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_conversion_function_id_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_conversion_type_id(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::CONVERSION_TYPE_ID, parent);
+
+    // conversion-type-id:
+    //   type-specifier-seq [conversion-declarator]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_conversion_type_id_part_1;
+
+    m = sv_type_specifier_seq(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_conversion_type_id_part_1;
+
+    m = sv_conversion_declarator(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_conversion_type_id_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_conversion_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_AMP_AMP: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::CONVERSION_DECLARATOR, parent);
+
+    // conversion-declarator:
+    //   ptr-operator [conversion-declarator]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_conversion_declarator_part_1;
+
+    m = sv_ptr_operator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_conversion_declarator_part_1;
+
+    m = sv_conversion_declarator(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_conversion_declarator_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_ctor_initializer(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_COLON: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::CTOR_INITIALIZER, parent);
+
+    // ctor-initializer:
+    //   operator(":") mem-initializer-list
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_ctor_initializer_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COLON))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_ctor_initializer_part_1;
+
+    m = sv_mem_initializer_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_ctor_initializer_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_ctor_initializer_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_mem_initializer_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::MEM_INITIALIZER_LIST, parent);
+
+    // mem-initializer-list:
+    //   mem-initializer [operator("...")] { operator(",") mem-initializer [operator("...")] }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_mem_initializer_list_part_1;
+
+    m = sv_mem_initializer(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_mem_initializer_list_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ELLIPSIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COMMA))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_mem_initializer(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ELLIPSIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_mem_initializer_list_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_mem_initializer(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x3;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x3; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::MEM_INITIALIZER, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // mem-initializer:
+    //   mem-initializer-id braced-init-list
+    //   mem-initializer-id operator("(") [expression-list] operator(")")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_mem_initializer_part_1;
+
+    m = sv_mem_initializer_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_mem_initializer_part_1;
+
+    m = sv_braced_init_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_mem_initializer_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_mem_initializer_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_mem_initializer_part_2;
+
+    m = sv_mem_initializer_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_mem_initializer_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_mem_initializer_part_2;
+
+    m = sv_expression_list(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_mem_initializer_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_mem_initializer_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_mem_initializer_id(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x3;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::MEM_INITIALIZER_ID, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // mem-initializer-id:
+    //   class-or-decltype
+    //   identifier()
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_mem_initializer_id_part_1;
+
+    m = sv_class_or_decltype(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_mem_initializer_id_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_mem_initializer_id_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_mem_initializer_id_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_mem_initializer_id_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_mem_initializer_id_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_operator_function_id(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_OPERATOR: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::OPERATOR_FUNCTION_ID, parent);
+
+    // operator-function-id:
+    //   keyword("operator") overloadable-operator
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_operator_function_id_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_OPERATOR))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_operator_function_id_part_1;
+
+    m = sv_overloadable_operator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_operator_function_id_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_operator_function_id_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_literal_operator_id(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_OPERATOR: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::LITERAL_OPERATOR_ID, parent);
+
+    // literal-operator-id:
+    //   keyword("operator") lit-string("") identifier()
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_literal_operator_id_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_OPERATOR))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_literal_operator_id_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::LIT_STRING) && ctx->tokens->string_is(m, ""))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_literal_operator_id_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_literal_operator_id_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_literal_operator_id_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_template_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_TEMPLATE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TEMPLATE_DECLARATION, parent);
+
+    // template-declaration:
+    //   keyword("template") operator("<") template-parameter-list operator(">") declaration
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_template_declaration_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_TEMPLATE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_template_declaration_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LESS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_template_declaration_part_1;
+
+    m = sv_template_parameter_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_template_declaration_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_GREATER))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_template_declaration_part_1;
+
+    m = sv_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_template_declaration_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    template_declaration_done(ctx, node);
+    return m;
+
+
+sv_template_declaration_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_template_parameter_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TEMPLATE_PARAMETER_LIST, parent);
+
+    // template-parameter-list:
+    //   template-parameter { operator(",") template-parameter }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_template_parameter_list_part_1;
+
+    m = sv_template_parameter(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_template_parameter_list_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COMMA))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_template_parameter(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_template_parameter_list_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_template_parameter(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x2;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_TEMPLATE: viable |= 0x1; break;
+                    case ATOM_TYPENAME: viable |= 0x1; break;
+                    case ATOM_CLASS: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LBRACKET: viable |= 0x2; break;
+                    case ATOM_SCOPE: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TEMPLATE_PARAMETER, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // template-parameter:
+    //   type-parameter
+    //   parameter-declaration
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_template_parameter_part_1;
+
+    m = sv_type_parameter(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_template_parameter_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    template_parameter_done(ctx, node);
+    return m;
+
+
+sv_template_parameter_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_template_parameter_part_2;
+
+    m = sv_parameter_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_template_parameter_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    template_parameter_done(ctx, node);
+    return m;
+
+
+sv_template_parameter_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_type_parameter(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_TEMPLATE: viable |= 0x3; break;
+                    case ATOM_TYPENAME: viable |= 0xc; break;
+                    case ATOM_CLASS: viable |= 0x30; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TYPE_PARAMETER, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // type-parameter:
+    //   keyword("template") operator("<") template-parameter-list operator(">") keyword("class") [identifier()] operator("=") id-expression
+    //   keyword("template") operator("<") template-parameter-list operator(">") keyword("class") [operator("...")] [identifier()]
+    //   keyword("typename") [identifier()] operator("=") type-id
+    //   keyword("typename") [operator("...")] [identifier()]
+    //   keyword("class") [identifier()] operator("=") type-id
+    //   keyword("class") [operator("...")] [identifier()]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_type_parameter_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_TEMPLATE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_type_parameter_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LESS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_type_parameter_part_1;
+
+    m = sv_template_parameter_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_type_parameter_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_GREATER))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_type_parameter_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_CLASS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_type_parameter_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ASSIGN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_type_parameter_part_1;
+
+    m = sv_id_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_type_parameter_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_type_parameter_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_type_parameter_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_TEMPLATE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_type_parameter_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LESS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_type_parameter_part_2;
+
+    m = sv_template_parameter_list(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_type_parameter_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_GREATER))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_type_parameter_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_CLASS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_type_parameter_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ELLIPSIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_type_parameter_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_type_parameter_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_TYPENAME))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_type_parameter_part_3;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ASSIGN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_type_parameter_part_3;
+
+    m = sv_type_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_type_parameter_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_type_parameter_part_3:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x8))
+        goto sv_type_parameter_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_TYPENAME))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_type_parameter_part_4;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ELLIPSIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_type_parameter_part_4:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x10))
+        goto sv_type_parameter_part_5;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_CLASS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_type_parameter_part_5;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ASSIGN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_type_parameter_part_5;
+
+    m = sv_type_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_type_parameter_part_5;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_type_parameter_part_5:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x20))
+        goto sv_type_parameter_part_6;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_CLASS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_type_parameter_part_6;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ELLIPSIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_type_parameter_part_6:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_simple_template_id(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::SIMPLE_TEMPLATE_ID, parent);
+
+    // simple-template-id:
+    //   template-name operator("<") [template-argument-list] operator(">")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_simple_template_id_part_1;
+
+    m = sv_template_name(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_simple_template_id_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LESS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_simple_template_id_part_1;
+
+    m = sv_template_argument_list(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_GREATER))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_simple_template_id_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_simple_template_id_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_template_id(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x4;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_OPERATOR: viable |= 0x3; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TEMPLATE_ID, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // template-id:
+    //   literal-operator-id operator("<") [template-argument-list] operator(">")
+    //   operator-function-id operator("<") [template-argument-list] operator(">")
+    //   simple-template-id
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_template_id_part_1;
+
+    m = sv_literal_operator_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_template_id_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LESS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_template_id_part_1;
+
+    m = sv_template_argument_list(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_GREATER))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_template_id_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_template_id_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_template_id_part_2;
+
+    m = sv_operator_function_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_template_id_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LESS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_template_id_part_2;
+
+    m = sv_template_argument_list(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_GREATER))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_template_id_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_template_id_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_template_id_part_3;
+
+    m = sv_simple_template_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_template_id_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_template_id_part_3:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_template_argument_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_LPAREN: viable |= 0x1; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x1; break;
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    case ATOM_TILDE: viable |= 0x1; break;
+                    case ATOM_DELETE: viable |= 0x1; break;
+                    case ATOM_NEW: viable |= 0x1; break;
+                    case ATOM_EXCLAIM: viable |= 0x1; break;
+                    case ATOM_MINUS: viable |= 0x1; break;
+                    case ATOM_PLUS: viable |= 0x1; break;
+                    case ATOM_AMP: viable |= 0x1; break;
+                    case ATOM_STAR: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TEMPLATE_ARGUMENT_LIST, parent);
+
+    // template-argument-list:
+    //   template-argument [operator("...")] { operator(",") template-argument [operator("...")] }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_template_argument_list_part_1;
+
+    m = sv_template_argument(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_template_argument_list_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ELLIPSIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COMMA))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_template_argument(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ELLIPSIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_template_argument_list_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_template_argument(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x7;
+                break;
+            case token::LIT_INTEGER:
+            case token::LIT_FLOAT:
+            case token::LIT_BOOL:
+            case token::LIT_POINTER:
+            case token::LIT_STRING:
+            case token::LIT_CHAR:
+                viable = 0x4;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x7; break;
+                    case ATOM_TILDE: viable |= 0x6; break;
+                    case ATOM_LPAREN: viable |= 0x4; break;
+                    case ATOM_MINUS_MINUS: viable |= 0x4; break;
+                    case ATOM_PLUS_PLUS: viable |= 0x4; break;
+                    case ATOM_DELETE: viable |= 0x4; break;
+                    case ATOM_NEW: viable |= 0x4; break;
+                    case ATOM_EXCLAIM: viable |= 0x4; break;
+                    case ATOM_MINUS: viable |= 0x4; break;
+                    case ATOM_PLUS: viable |= 0x4; break;
+                    case ATOM_AMP: viable |= 0x4; break;
+                    case ATOM_STAR: viable |= 0x4; break;
+                    case ATOM_LBRACKET: viable |= 0x4; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TEMPLATE_ARGUMENT, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // template-argument:
+    //   type-id
+    //   id-expression
+    //   constant-expression
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_template_argument_part_1;
+
+    m = sv_type_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_template_argument_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_template_argument_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_template_argument_part_2;
+
+    m = sv_id_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_template_argument_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_template_argument_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_template_argument_part_3;
+
+    m = sv_constant_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_template_argument_part_3;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_template_argument_part_3:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_typename_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_TYPENAME: viable |= 0x3; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TYPENAME_SPECIFIER, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // typename-specifier:
+    //   keyword("typename") nested-name-specifier [keyword("template")] simple-template-id
+    //   keyword("typename") nested-name-specifier identifier()
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_typename_specifier_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_TYPENAME))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_typename_specifier_part_1;
+
+    m = sv_nested_name_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_typename_specifier_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_TEMPLATE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    m = sv_simple_template_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_typename_specifier_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_typename_specifier_part_1:
+    clear_nested_name_specifier(ctx, node);
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_typename_specifier_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_TYPENAME))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_typename_specifier_part_2;
+
+    m = sv_nested_name_specifier(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_typename_specifier_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_identifier(ctx, node, m, ATOM_NONE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_typename_specifier_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    clear_nested_name_specifier(ctx, node);
+    return m;
+
+
+sv_typename_specifier_part_2:
+    clear_nested_name_specifier(ctx, node);
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_explicit_instantiation(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_EXTERN: viable |= 0x1; break;
+                    case ATOM_TEMPLATE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::EXPLICIT_INSTANTIATION, parent);
+
+    // explicit-instantiation:
+    //   [keyword("extern")] keyword("template") declaration
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_explicit_instantiation_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_EXTERN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_TEMPLATE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_explicit_instantiation_part_1;
+
+    m = sv_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_explicit_instantiation_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_explicit_instantiation_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_explicit_specialization(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_TEMPLATE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::EXPLICIT_SPECIALIZATION, parent);
+
+    // explicit-specialization:
+    //   keyword("template") operator("<") operator(">") declaration
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_explicit_specialization_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_TEMPLATE))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_explicit_specialization_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LESS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_explicit_specialization_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_GREATER))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_explicit_specialization_part_1;
+
+    m = sv_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_explicit_specialization_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_explicit_specialization_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_try_block(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_TRY: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TRY_BLOCK, parent);
+
+    // try-block:
+    //   keyword("try") compound-statement handler-seq
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_try_block_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_TRY))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_try_block_part_1;
+
+    m = sv_compound_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_try_block_part_1;
+
+    m = sv_handler_seq(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_try_block_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_try_block_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_function_try_block(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_TRY: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::FUNCTION_TRY_BLOCK, parent);
+
+    // function-try-block:
+    //   keyword("try") [ctor-initializer] compound-statement handler-seq
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_function_try_block_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_TRY))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_function_try_block_part_1;
+
+    m = sv_ctor_initializer(ctx, node, m, &could_parse);
+
+    m = sv_compound_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_function_try_block_part_1;
+
+    m = sv_handler_seq(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_function_try_block_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_function_try_block_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_handler_seq(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_CATCH: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::HANDLER_SEQ, parent);
+
+    // handler-seq:
+    //   handler { handler }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_handler_seq_part_1;
+
+    m = sv_handler(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_handler_seq_part_1;
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    m = sv_handler(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_handler_seq_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_handler(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_CATCH: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::HANDLER, parent);
+
+    // handler:
+    //   keyword("catch") operator("(") exception-declaration operator(")") compound-statement
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_handler_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_CATCH))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_handler_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_handler_part_1;
+
+    m = sv_exception_declaration(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_handler_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_handler_part_1;
+
+    m = sv_compound_statement(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_handler_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_handler_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_exception_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x6;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_ELLIPSIS: viable |= 0x1; break;
+                    case ATOM_LBRACKET: viable |= 0x6; break;
+                    case ATOM_SCOPE: viable |= 0x6; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::EXCEPTION_DECLARATION, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // exception-declaration:
+    //   operator("...")
+    //   [attribute-specifier-seq] type-specifier-seq declarator
+    //   [attribute-specifier-seq] type-specifier-seq [abstract-declarator]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_exception_declaration_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ELLIPSIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_exception_declaration_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_exception_declaration_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_exception_declaration_part_2;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_type_specifier_seq(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_exception_declaration_part_2;
+
+    m = sv_declarator(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_exception_declaration_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_exception_declaration_part_2:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x4))
+        goto sv_exception_declaration_part_3;
+
+    m = sv_attribute_specifier_seq(ctx, node, m, &could_parse);
+
+    m = sv_type_specifier_seq(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_exception_declaration_part_3;
+
+    m = sv_abstract_declarator(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_exception_declaration_part_3:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_throw_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_THROW: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::THROW_EXPRESSION, parent);
+
+    // throw-expression:
+    //   keyword("throw") [assignment-expression]
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_throw_expression_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_THROW))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_throw_expression_part_1;
+
+    m = sv_assignment_expression(ctx, node, m, &could_parse);
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_throw_expression_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_exception_specification(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_NOEXCEPT: viable |= 0x1; break;
+                    case ATOM_THROW: viable |= 0x2; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::EXCEPTION_SPECIFICATION, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // exception-specification:
+    //   noexcept-specification
+    //   dynamic-exception-specification
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_exception_specification_part_1;
+
+    m = sv_noexcept_specification(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_exception_specification_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_exception_specification_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_exception_specification_part_2;
+
+    m = sv_dynamic_exception_specification(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_exception_specification_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_exception_specification_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_dynamic_exception_specification(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_THROW: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::DYNAMIC_EXCEPTION_SPECIFICATION, parent);
+
+    // dynamic-exception-specification:
+    //   keyword("throw") operator("(") [type-id-list] operator(")")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_dynamic_exception_specification_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_THROW))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_dynamic_exception_specification_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_dynamic_exception_specification_part_1;
+
+    m = sv_type_id_list(ctx, node, m, &could_parse);
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_dynamic_exception_specification_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_dynamic_exception_specification_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_type_id_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x1;
+                break;
+            case token::OPERATOR:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_SCOPE: viable |= 0x1; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TYPE_ID_LIST, parent);
+
+    // type-id-list:
+    //   type-id [operator("...")] { operator(",") type-id [operator("...")] }
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_type_id_list_part_1;
+
+    m = sv_type_id(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_type_id_list_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ELLIPSIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+
+    {
+    range_t l;
+    parse_mark lm;
+    int incomplete;
+    do
+    {
+    l = m;
+    lm = mark_parse(ctx);
+    incomplete = 0;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_COMMA))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+    else
+    {
+        m = l;
+        break;
+    }
+
+    m = sv_type_id(ctx, node, m, &could_parse);
+    if (could_parse)
+        incomplete++;
+    else
+    {
+        m = l;
+        break;
+    }
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_ELLIPSIS))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+        incomplete++;
+    }
+
+    } while (l != m);
+    if (incomplete)
+    {
+        for (int i = 0; i < incomplete; i++) node->children.pop_back();
+        rollback_parse(ctx, lm);
+    }
+    }
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_type_id_list_part_1:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
+static range_t sv_noexcept_specification(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
+{
+    bool could_parse;
+
+    // Alternatives which may match the current token (FIRST sets)
+    unsigned viable;
+    if (!token_available(ctx, b))
+        viable = 0x0;
+    else
+    {
+        switch (token_type_at(ctx, b))
+        {
+            case token::IDENTIFIER:
+                viable = 0x0;
+                switch (token_atom_at(ctx, b))
+                {
+                    case ATOM_NOEXCEPT: viable |= 0x3; break;
+                    default: break;
+                }
+                break;
+            default:
+                viable = 0x0;
+        }
+    }
+
+    if (!viable)
+    {
+        *success = false;
+        return b;
+    }
+
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::NOEXCEPT_SPECIFICATION, parent);
+    parse_mark children_mark = mark_parse(ctx);
+
+    // noexcept-specification:
+    //   keyword("noexcept") operator("(") constant-expression operator(")")
+    //   keyword("noexcept")
+
+    range_t m = b;
+
+
+    if (!(viable & 0x1))
+        goto sv_noexcept_specification_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_NOEXCEPT))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_noexcept_specification_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_noexcept_specification_part_1;
+
+    m = sv_constant_expression(ctx, node, m, &could_parse);
+    if (!could_parse)
+        goto sv_noexcept_specification_part_1;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RPAREN))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_noexcept_specification_part_1;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_noexcept_specification_part_1:
+    node->children.clear();
+    rollback_parse(ctx, children_mark);
+    m = b;
+
+    if (!(viable & 0x2))
+        goto sv_noexcept_specification_part_2;
+
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::IDENTIFIER) && is_keyword(ctx, node, m, ATOM_NOEXCEPT))
+    {
+        syntax_tree_node *tok_node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node);
+        tok_node->ass_token = m;
+        if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
+    }
+    else
+        goto sv_noexcept_specification_part_2;
+
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    *success = true;
+    return m;
+
+
+sv_noexcept_specification_part_2:
+    node->detach();
+    rollback_parse(ctx, entry_mark);
+    *success = false;
+    return b;
+}
+
+
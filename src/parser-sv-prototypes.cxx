@@ -0,0 +1,204 @@
+static syntax_tree_node *sv_translation_unit(parser_context *ctx, range_t b, bool *success);
+static range_t sv_primary_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_literal(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_id_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_unqualified_id(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_qualified_id(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_nested_name_specifier_repeatable(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_nested_name_specifier_start(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_nested_name_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_lambda_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_lambda_introducer(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_lambda_capture(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_capture_default(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_capture_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_capture(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_lambda_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_postfix_expression_repeatable(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_postfix_expression_start(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_postfix_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_expression_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_pseudo_destructor_name(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_unary_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_unary_operator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_new_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_new_placement(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_new_type_id(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_new_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_noptr_new_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_new_initializer(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_delete_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_noexcept_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_cast_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_pm_operator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_pm_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_multiplicative_operator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_multiplicative_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_additive_operator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_additive_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_shift_operator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_shift_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_relational_operator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_relational_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_equality_operator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_equality_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_and_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_exclusive_or_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_inclusive_or_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_logical_and_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_logical_or_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_conditional_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_assignment_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_assignment_operator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_constant_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_statement(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_labeled_statement(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_expression_statement(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_compound_statement(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_statement_seq(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_selection_statement(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_condition(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_iteration_statement(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_for_init_statement(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_for_range_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_for_range_initializer(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_jump_statement(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_declaration_statement(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_declaration_seq(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_block_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_alias_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_simple_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_static_assert_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_empty_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_attribute_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_decl_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_decl_specifier_seq(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_storage_class_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_function_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_type_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_trailing_type_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_type_specifier_seq(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_trailing_type_specifier_seq(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_simple_type_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_type_name(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_decltype_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_elaborated_type_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_enum_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_enum_head(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_opaque_enum_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_enum_key(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_enum_base(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_enumerator_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_enumerator_definition(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_enumerator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_namespace_name(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_namespace_definition(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_named_namespace_definition(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_original_namespace_definition(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_extension_namespace_definition(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_unnamed_namespace_definition(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_namespace_body(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_namespace_alias_definition(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_qualified_namespace_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_using_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_using_directive(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_asm_definition(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_linkage_specification(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_attribute_specifier_seq(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_attribute_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_gcc_attribute_specifier_seq(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_gcc_attribute_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_alignment_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_attribute_list_entry(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_attribute_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_attribute(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_attribute_token(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_attribute_scoped_token(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_attribute_namespace(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_attribute_argument_clause(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_balanced_token_seq(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_balanced_token(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_init_declarator_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_init_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_ptr_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_noptr_declarator_repeatable(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_noptr_declarator_start(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_noptr_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_parameters_and_qualifiers(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_trailing_return_type(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_ptr_operator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_cv_qualifier_seq(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_cv_qualifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_ref_qualifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_declarator_id(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_type_id(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_abstract_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_ptr_abstract_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_noptr_abstract_declarator_repeatable(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_noptr_abstract_declarator_start(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_noptr_abstract_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_abstract_pack_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_noptr_abstract_pack_declarator_repeatable(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_noptr_abstract_pack_declarator_start(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_noptr_abstract_pack_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_parameter_declaration_clause(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_parameter_declaration_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_parameter_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_function_definition(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_function_body(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_initializer(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_brace_or_equal_initializer(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_initializer_clause(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_initializer_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_braced_init_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_class_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_class_head(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_class_head_name(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_class_virt_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_class_key(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_member_specification(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_member_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_member_declarator_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_member_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_virt_specifier_seq(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_virt_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_pure_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_base_clause(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_base_specifier_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_base_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_class_or_decltype(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_base_type_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_access_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_conversion_function_id(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_conversion_type_id(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_conversion_declarator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_ctor_initializer(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_mem_initializer_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_mem_initializer(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_mem_initializer_id(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_operator_function_id(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_literal_operator_id(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_template_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_template_parameter_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_template_parameter(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_type_parameter(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_simple_template_id(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_template_id(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_template_argument_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_template_argument(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_typename_specifier(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_explicit_instantiation(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_explicit_specialization(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_try_block(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_function_try_block(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_handler_seq(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_handler(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_exception_declaration(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_throw_expression(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_exception_specification(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_dynamic_exception_specification(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_type_id_list(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
+static range_t sv_noexcept_specification(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success);
@@ -1,9 +1,13 @@
 #include <cassert>
+#include <chrono>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
-#include <list>
+#include <exception>
+#include <mutex>
 #include <stack>
+#include <unordered_map>
 #include <vector>
 
 #include "error.hpp"
@@ -12,65 +16,547 @@
 #include "tokenize.hpp"
 
 
-struct keyword_entry
+// Links a name entry into the registration list of a node it depends on (see
+// syntax_tree_node::names)
+struct name_link
 {
-    const char *identifier;
+    struct name_entry *entry;
+    name_link *next, **pprev;
+};
+
+
+// Registration of a name as keyword and/or type, template or namespace name
+struct name_entry
+{
+    enum kind
+    {
+        KEYWORD   = 1 << 0,
+        TYPEDEF   = 1 << 1,
+        CLASS     = 1 << 2,
+        TEMPLATE  = 1 << 3,
+        NAMESPACE = 1 << 4,
+    };
+
+    atom_t name;
+    unsigned kinds;
     syntax_tree_node *declaration, *complete_declaration;
+    uint64_t serial;
+
+    // Entries of the same name, in order of registration
+    name_entry *prev_same, *next_same;
+    // All entries, in order of registration
+    name_entry *older, *newer;
+    // Links for declaration and complete_declaration
+    name_link owners[2];
 };
 
 
-// XXX: Make this into a prefix tree or something
-static std::list<keyword_entry> keywords, typedef_names, class_names, template_names, original_namespace_names;
+// Registrations of one name
+struct name_chain
+{
+    name_entry *first, *last;
+};
 
 
-syntax_tree_node::syntax_tree_node(sv_type t, syntax_tree_node *p, bool i):
-    parent(p), type(t), intermediate(i)
+typedef token_index range_t;
+
+
+struct parser_context;
+
+#include "parser-sv-prototypes.cxx"
+
+
+struct memo_entry
 {
-    if (p)
-        p->children.push_back(this);
+    enum
+    {
+        UNKNOWN,
+        PENDING,
+        FAILED,
+        SUCCEEDED
+    } outcome;
+
+    // Parser state the result depends on
+    uint64_t names;
+    syntax_tree_node *ns_scope;
+    const syntax_tree_node *anchor;
+    syntax_tree_node::sv_type parent_type;
+
+    range_t end;
+    // Subtree of the successful match (either still part of the tree or
+    // parked after its parent discarded it)
+    syntax_tree_node *tree;
+};
+
+
+struct namespace_scope_entry
+{
+    syntax_tree_node *scope;
+    syntax_tree_node *related;
+};
+
+
+// Everything a build_syntax_tree() run works on, so that any number of
+// translation units can be parsed at the same time
+struct parser_context
+{
+    // Token stream being parsed (with its hot arrays cached), and where more
+    // tokens come from (nullptr if it is complete already)
+    token_stream *tokens;
+    token_source *source;
+    const uint8_t *token_types;
+    const atom_t *token_atoms;
+    range_t token_count;
+
+    // All syntax tree nodes are allocated from here
+    arena *node_arena;
+    range_t maximum_extent;
+
+    // Registered names, indexed by atom
+    std::vector<name_chain> name_chains;
+    // Registration log
+    name_entry *oldest_name, *newest_name;
+    // Fingerprint of the set of currently registered names: XOR of the hashed
+    // serials of all live entries, so undoing a registration restores it.
+    uint64_t name_state, name_serial;
+
+    // Scope qualified names are looked up in (nullptr for the current one)
+    std::stack<namespace_scope_entry> namespace_scope_stack;
+    syntax_tree_node *namespace_scope;
+
+#ifdef PACKRAT_PARSER
+    // Packrat memo: maps (syntactic variable, token position) to the outcome
+    // of the last match attempt. Since matches depend on the names registered
+    // so far and on the current namespace scope, every entry records the
+    // state it was made in and is only reused if that state is the same
+    // again.
+    std::unordered_map<uint64_t, memo_entry> memo_table;
+    // Memoized subtrees whose parents have been discarded
+    std::vector<syntax_tree_node *> parked_trees;
+#endif
+
+#ifdef PARSER_PROFILE
+    // Counters by node type (see rule_probe), and the ticks spent in the
+    // calls the current handler has made so far
+    std::vector<rule_profile> profile;
+    uint64_t callee_ticks = 0;
+#endif
+
+    parser_context(token_stream *t, token_source *src, arena *nodes):
+        tokens(t), source(src), token_types(t->types.data()), token_atoms(t->atoms.data()), token_count(t->size()),
+        node_arena(nodes), maximum_extent(0),
+        oldest_name(nullptr), newest_name(nullptr), name_state(0), name_serial(0), namespace_scope(nullptr)
+    {}
+
+    ~parser_context(void);
+};
+
+
+/**
+ * Asks the token source for more tokens (this may block while a pipelined
+ * source is still tokenizing). Returns whether token t exists.
+ */
+static bool pull_tokens(parser_context *ctx, range_t t)
+{
+    if (!ctx->source)
+        return false;
+
+    ctx->source->fill(t);
+
+    ctx->token_types = ctx->tokens->types.data();
+    ctx->token_atoms = ctx->tokens->atoms.data();
+    ctx->token_count = ctx->tokens->size();
+
+    return t < ctx->token_count;
+}
+
+
+static inline bool token_available(parser_context *ctx, range_t t)
+{
+    return (t < ctx->token_count) || pull_tokens(ctx, t);
+}
+
+
+static inline token::token_type token_type_at(const parser_context *ctx, range_t t)
+{
+    return static_cast<token::token_type>(ctx->token_types[t]);
+}
+
+
+static inline atom_t token_atom_at(const parser_context *ctx, range_t t)
+{
+    return ctx->token_atoms[t];
 }
 
 
-syntax_tree_node::~syntax_tree_node(void)
+static inline uint64_t name_hash(uint64_t serial)
 {
-    for (syntax_tree_node *n: children)
-        delete n;
+    // splitmix64 finalizer
+    serial = (serial ^ (serial >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    serial = (serial ^ (serial >> 27)) * 0x94d049bb133111ebULL;
+    return serial ^ (serial >> 31);
+}
 
-    bool registered = false;
-    for (auto it = keywords.begin(); it != keywords.end();)
+
+/**
+ * Returns the first registration of the given name (further ones can be
+ * found through next_same).
+ */
+static inline const name_entry *first_name(const parser_context *ctx, atom_t name)
+{
+    return (name < ctx->name_chains.size()) ? ctx->name_chains[name].first : nullptr;
+}
+
+
+static void add_name(parser_context *ctx, atom_t name, unsigned kinds, syntax_tree_node *declaration, syntax_tree_node *complete_declaration)
+{
+    if (name >= ctx->name_chains.size())
+        ctx->name_chains.resize(atom_count(), {nullptr, nullptr});
+
+    name_chain &chain = ctx->name_chains[name];
+    name_entry *ne = new name_entry {name, kinds, declaration, complete_declaration, ++ctx->name_serial,
+                                     chain.last, nullptr, ctx->newest_name, nullptr, {}};
+
+    if (chain.last)
+        chain.last->next_same = ne;
+    else
+        chain.first = ne;
+    chain.last = ne;
+
+    if (ctx->newest_name)
+        ctx->newest_name->newer = ne;
+    else
+        ctx->oldest_name = ne;
+    ctx->newest_name = ne;
+
+    syntax_tree_node *owners[2] = {declaration, (complete_declaration != declaration) ? complete_declaration : nullptr};
+    for (int i = 0; i < 2; i++)
     {
-        auto it_next = it;
-        ++it_next;
+        name_link *link = &ne->owners[i];
+        link->entry = ne;
 
-        if ((this == (*it).declaration) || (this == (*it).complete_declaration))
+        if (owners[i])
         {
-            free(const_cast<char *>((*it).identifier));
-            keywords.erase(it);
-            registered = true;
+            link->next = owners[i]->names;
+            link->pprev = &owners[i]->names;
+            if (link->next)
+                link->next->pprev = &link->next;
+            owners[i]->names = link;
         }
+    }
+
+    ctx->name_state ^= name_hash(ctx->name_serial);
+}
+
+
+static void remove_name(parser_context *ctx, name_entry *ne)
+{
+    ctx->name_state ^= name_hash(ne->serial);
+
+    for (name_link &link: ne->owners)
+    {
+        if (link.pprev)
+        {
+            *link.pprev = link.next;
+            if (link.next)
+                link.next->pprev = link.pprev;
+        }
+    }
+
+    name_chain &chain = ctx->name_chains[ne->name];
+
+    if (ne->prev_same)
+        ne->prev_same->next_same = ne->next_same;
+    else
+        chain.first = ne->next_same;
+
+    if (ne->next_same)
+        ne->next_same->prev_same = ne->prev_same;
+    else
+        chain.last = ne->prev_same;
+
+    if (ne->older)
+        ne->older->newer = ne->newer;
+    else
+        ctx->oldest_name = ne->newer;
+
+    if (ne->newer)
+        ne->newer->older = ne->older;
+    else
+        ctx->newest_name = ne->older;
+
+    delete ne;
+}
+
+
+#ifdef PARSER_PROFILE
+static void profile_merge(const std::vector<rule_profile> &profile);
+#endif
+
+
+/**
+ * Drops all registrations. The nodes they refer to may not exist anymore, so
+ * they are not touched.
+ */
+parser_context::~parser_context(void)
+{
+    while (newest_name)
+    {
+        name_entry *older = newest_name->older;
+        delete newest_name;
+        newest_name = older;
+    }
+
+#ifdef PARSER_PROFILE
+    profile_merge(profile);
+#endif
+}
 
-        it = it_next;
+
+#ifdef PARSER_PROFILE
+// Nodes created by this thread so far
+static thread_local uint64_t nodes_created;
+
+// Counters of all parses that have finished
+static std::mutex profile_lock;
+static std::vector<rule_profile> profile_totals;
+
+
+static inline uint64_t profile_ticks(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+
+
+static void profile_merge(const std::vector<rule_profile> &profile)
+{
+    std::lock_guard<std::mutex> guard(profile_lock);
+
+    if (profile_totals.empty())
+    {
+        profile_totals = profile;
+        return;
     }
 
-    if (registered)
+    for (size_t i = 0; i < profile.size(); i++)
     {
-        for (std::list<keyword_entry> *kwl: {&typedef_names, &class_names, &template_names, &original_namespace_names})
+        const rule_profile &p = profile[i];
+        rule_profile &t = profile_totals[i];
+
+        t.entries += p.entries;
+        t.successes += p.successes;
+        t.failures += p.failures;
+        t.tokens += p.tokens;
+        t.nodes += p.nodes;
+        t.discarded += p.discarded;
+        t.inclusive += p.inclusive;
+        t.exclusive += p.exclusive;
+
+        for (size_t a = 0; a < p.attempts.size(); a++)
         {
-            for (auto it = kwl->begin(); it != kwl->end();)
+            t.attempts[a] += p.attempts[a];
+            t.matches[a] += p.matches[a];
+        }
+    }
+}
+
+
+/**
+ * Counts one call of a generated handler: created on entry, it adds the
+ * call's outcome, tokens, nodes and ticks to the handler's counters when it
+ * goes out of scope (after *success has been set).
+ */
+class rule_probe
+{
+    public:
+        rule_probe(parser_context *c, syntax_tree_node::sv_type rule, range_t b, const bool *s):
+            ctx(c), counters(&c->profile[rule]), start(b), end(b), alternative(-1), success(s),
+            nodes(nodes_created), outer_callee_ticks(c->callee_ticks), ticks(profile_ticks())
+        {
+            ctx->callee_ticks = 0;
+        }
+
+        ~rule_probe(void)
+        {
+            uint64_t elapsed = profile_ticks() - ticks;
+
+            // Calls left by an exception have no outcome
+            if (!std::uncaught_exception())
             {
-                auto it_next = it;
-                ++it_next;
+                uint64_t allocated = nodes_created - nodes;
 
-                if ((this == (*it).declaration) || (this == (*it).complete_declaration))
+                counters->entries++;
+                counters->nodes += allocated;
+                counters->inclusive += elapsed;
+                counters->exclusive += elapsed - ctx->callee_ticks;
+
+                if (*success)
                 {
-                    free(const_cast<char *>((*it).identifier));
-                    kwl->erase(it);
+                    counters->successes++;
+                    counters->tokens += end - start;
+                    if (alternative >= 0)
+                        counters->matches[alternative]++;
+                }
+                else
+                {
+                    counters->failures++;
+                    counters->discarded += allocated;
                 }
-
-                it = it_next;
             }
+
+            ctx->callee_ticks = outer_callee_ticks + elapsed;
+        }
+
+        void attempt(int i) { counters->attempts[i]++; }
+        void matched(int i, range_t m) { alternative = i; end = m; }
+        // Result of a memoized match
+        range_t recalled(range_t m) { end = m; return m; }
+
+    private:
+        parser_context *ctx;
+        rule_profile *counters;
+        range_t start, end;
+        int alternative;
+        const bool *success;
+        uint64_t nodes, outer_callee_ticks, ticks;
+};
+#endif
+
+
+// State to return to when discarding a failed match
+struct parse_mark
+{
+    arena::mark memory;
+    uint64_t names;
+};
+
+
+static inline parse_mark mark_parse(parser_context *ctx)
+{
+    return {ctx->node_arena->get_mark(), ctx->name_serial};
+}
+
+
+/**
+ * Discards all nodes allocated since the given mark. Names declared by those
+ * nodes are unregistered (note that names are only registered after the
+ * declaring node has been created, so only names registered after the mark
+ * need to be checked).
+ */
+static void rollback_parse(parser_context *ctx, const parse_mark &pm)
+{
+    name_entry *ne = ctx->newest_name;
+    while (ne && (ne->serial > pm.names))
+    {
+        name_entry *older = ne->older;
+
+        if (ctx->node_arena->allocated_since(pm.memory, ne->declaration) ||
+            ctx->node_arena->allocated_since(pm.memory, ne->complete_declaration))
+        {
+            remove_name(ctx, ne);
         }
+
+        ne = older;
     }
+
+    ctx->node_arena->rollback(pm.memory);
+}
+
+
+#ifdef PACKRAT_PARSER
+static void park_subtree(parser_context *ctx, syntax_tree_node *node);
+#endif
+
+static void discard_node(parser_context *ctx, syntax_tree_node *node);
+
+
+static void unregister_names(parser_context *ctx, const syntax_tree_node *node)
+{
+    while (node->names)
+        remove_name(ctx, node->names->entry);
+}
+
+
+// Discards all children of a node and empties its child list.
+static void discard_children(parser_context *ctx, syntax_tree_node *node)
+{
+    syntax_tree_node *c = node->children.front();
+    node->children.clear();
+
+    while (c)
+    {
+        // c's links are not touched by discarding it, but read them first
+        // anyway
+        syntax_tree_node *next = c->next_sibling;
+        discard_node(ctx, c);
+        c = next;
+    }
+}
+
+
+// Discards a node and its subtree (unregistering the names they declared),
+// unless it is the reusable subtree of a packrat memo entry. Its memory is
+// not released before the arena is.
+static void discard_node(parser_context *ctx, syntax_tree_node *node)
+{
+#ifdef PACKRAT_PARSER
+    if (node->memo)
+    {
+        park_subtree(ctx, node);
+        return;
+    }
+#endif
+
+    discard_children(ctx, node);
+    unregister_names(ctx, node);
+}
+
+
+#ifdef PACKRAT_PARSER
+// Discards the last count children of a node.
+static void discard_last_children(parser_context *ctx, syntax_tree_node *node, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        syntax_tree_node *c = node->children.back();
+        node->children.pop_back();
+        discard_node(ctx, c);
+    }
+}
+#endif
+
+
+/**
+ * Creates an error for the given message at token i (taking ownership of msg).
+ */
+static error *error_at(const token_stream &tokens, token_index i, char *msg)
+{
+    error *err = new error(tokens.line(i), tokens.column(i), msg);
+    if (const token_file *f = tokens.file(i))
+    {
+        err->file = f->name;
+        err->text = tokens.source + f->text_offset;
+    }
+
+    return err;
+}
+
+
+syntax_tree_node::syntax_tree_node(sv_type t, syntax_tree_node *p, bool i):
+    parent(p), next_sibling(nullptr), prev_sibling(nullptr), type(t), ass_token(NO_TOKEN), intermediate(i), names(nullptr), memo(nullptr)
+{
+    supplemental.declaration = nullptr;
+
+    if (p)
+        p->children.push_back(this);
+
+#ifdef PARSER_PROFILE
+    nodes_created++;
+#endif
 }
 
 
@@ -88,16 +574,16 @@ void syntax_tree_node::detach(void)
  * completely matched - furthermore, the current state of the code is that it
  * doesn't even consider declarations being wrongly matched and discarding
  * them later, soooooooo... */
-bool syntax_tree_node::sees(const syntax_tree_node *other) const
+bool syntax_tree_node::sees(const token_stream &tokens, const syntax_tree_node *other) const
 {
     if (!other)
         return true;
 
-    const syntax_tree_node *other_scope = other->scope();
+    const syntax_tree_node *other_scope = other->scope(tokens);
     if (!other_scope)
         return false;
 
-    for (const syntax_tree_node *s = scope(); s; s = s->scope_above())
+    for (const syntax_tree_node *s = scope(tokens); s; s = s->scope_above())
         if (s == other_scope)
             return true;
 
@@ -105,10 +591,10 @@ bool syntax_tree_node::sees(const syntax_tree_node *other) const
 }
 
 
-bool syntax_tree_node::sees_in_ns(const syntax_tree_node *other, const syntax_tree_node *ns) const
+bool syntax_tree_node::sees_in_ns(const token_stream &tokens, const syntax_tree_node *other, const syntax_tree_node *ns) const
 {
     // FIXME: Oh god does this even work
-    return ns ? (other->scope_above() == ns) : sees(other);
+    return ns ? (other->scope_above() == ns) : sees(tokens, other);
 }
 
 
@@ -118,7 +604,7 @@ bool syntax_tree_node::sees_in_ns(const syntax_tree_node *other, const syntax_tr
  *   - a class specifier
  *   - a declaration sequence
  */
-syntax_tree_node *syntax_tree_node::scope(void) const
+syntax_tree_node *syntax_tree_node::scope(const token_stream &tokens) const
 {
     for (syntax_tree_node *n = parent; n; n = n->parent)
     {
@@ -133,9 +619,9 @@ syntax_tree_node *syntax_tree_node::scope(void) const
         }
     }
 
-    token *tok = first_token();
-    if (tok)
-        throw format("%p Could not resolve scope of a %s node (%i:%i)", parent, parser_type_names[type], tok->line, tok->column);
+    token_index tok = first_token();
+    if (tok != NO_TOKEN)
+        throw error_at(tokens, tok, format("Could not resolve scope of a %s node", parser_type_names[type]));
     else
         throw format("Could not resolve scope of a %s node", parser_type_names[type]);
 }
@@ -197,8 +683,7 @@ void syntax_tree_node::contract(void)
             // i now points to the element after the newly adopted grandchildren
             // (this is correct, as there may be no intermediate nodes among
             // those due to child->contract() before)
-
-            delete child;
+            // child itself is simply dropped, its memory belongs to the arena.
         }
     }
 }
@@ -207,167 +692,155 @@ void syntax_tree_node::contract(void)
 /**
  * Returns the first token for this node.
  */
-token *syntax_tree_node::first_token(void) const
+token_index syntax_tree_node::first_token(void) const
 {
     if (type == syntax_tree_node::TOKEN)
         return ass_token;
 
     for (syntax_tree_node *c: children)
     {
-        token *t = c->first_token();
-        if (t)
+        token_index t = c->first_token();
+        if (t != NO_TOKEN)
             return t;
     }
 
-    return nullptr;
+    return NO_TOKEN;
 }
 
 
 /**
  * Fixes >> and >>= from > > and > >= (after we're sure it's not > > or > >=).
  */
-void syntax_tree_node::fix_right_shifts(void)
+void syntax_tree_node::fix_right_shifts(const token_stream &tokens)
 {
     if (type == syntax_tree_node::ASSIGNMENT_OPERATOR)
     {
-        if (!strcmp(reinterpret_cast<operator_token *>(children.front()->ass_token)->value, ">") &&
-            !strcmp(reinterpret_cast<operator_token *>(children.back ()->ass_token)->value, ">="))
+        supplemental.merged_operator = ATOM_NONE;
+
+        if ((tokens.atom(children.front()->ass_token) == ATOM_GREATER) && (tokens.atom(children.back()->ass_token) == ATOM_GE))
         {
+            // The two tokens are adjacent in the source
             children.pop_back();
-            operator_token *tok = reinterpret_cast<operator_token *>(children.front()->ass_token);
-            delete tok->content;
-
-            strcpy(tok->value = tok->content = new char[4], ">>=");
+            supplemental.merged_operator = ATOM_RSHIFT_ASSIGN;
         }
     }
     else if (type == syntax_tree_node::SHIFT_OPERATOR)
     {
-        if (!strcmp(reinterpret_cast<operator_token *>(children.front()->ass_token)->value, ">") &&
-            !strcmp(reinterpret_cast<operator_token *>(children.back ()->ass_token)->value, ">"))
+        supplemental.merged_operator = ATOM_NONE;
+
+        if ((tokens.atom(children.front()->ass_token) == ATOM_GREATER) && (tokens.atom(children.back()->ass_token) == ATOM_GREATER))
         {
             children.pop_back();
-            operator_token *tok = reinterpret_cast<operator_token *>(children.front()->ass_token);
-            delete tok->content;
-
-            strcpy(tok->value = tok->content = new char[3], ">>");
+            supplemental.merged_operator = ATOM_RSHIFT;
         }
     }
     else
         for (syntax_tree_node *c: children)
-            c->fix_right_shifts();
+            c->fix_right_shifts(tokens);
 }
 
 
-typedef std::vector<token *>::const_iterator range_t;
-
-static range_t maximum_extent;
-
-
-#include "parser-sv-prototypes.cxx"
-
-
 // Funny thing about C++: Only use the keyword/identifier separation for the
 // current namespace.
-static bool is_keyword(syntax_tree_node *parent, token *tok, const char *name)
+static bool is_keyword(const parser_context *ctx, syntax_tree_node *parent, token_index tok, atom_t name)
 {
-    (void)parent;
-
-    identifier_token *it = reinterpret_cast<identifier_token *>(tok);
-    if (name && strcmp(it->value, name))
+    if ((name != ATOM_NONE) && (token_atom_at(ctx, tok) != name))
         return false;
 
-    for (const keyword_entry &kw: keywords)
-        if (!strcmp(it->value, kw.identifier) && parent->sees(kw.declaration))
+    for (const name_entry *kw = first_name(ctx, token_atom_at(ctx, tok)); kw; kw = kw->next_same)
+        if ((kw->kinds & name_entry::KEYWORD) && parent->sees(*ctx->tokens, kw->declaration))
             return true;
 
     return false;
 }
 
 
-static bool is_identifier(syntax_tree_node *parent, token *tok, const char *name)
+static bool is_identifier(const parser_context *ctx, syntax_tree_node *parent, token_index tok, atom_t name)
 {
-    (void)parent;
-
-    identifier_token *it = reinterpret_cast<identifier_token *>(tok);
-    if (name && strcmp(it->value, name))
+    if ((name != ATOM_NONE) && (token_atom_at(ctx, tok) != name))
         return false;
 
-    for (const keyword_entry &kw: keywords)
-        if (!strcmp(it->value, kw.identifier) && parent->sees(kw.declaration))
+    for (const name_entry *kw = first_name(ctx, token_atom_at(ctx, tok)); kw; kw = kw->next_same)
+        if ((kw->kinds & name_entry::KEYWORD) && parent->sees(*ctx->tokens, kw->declaration))
             return false;
 
     return true;
 }
 
 
-static range_t sv_trivially_balanced_token(syntax_tree_node *parent, range_t b, range_t e, bool *success)
+static range_t sv_trivially_balanced_token(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
 {
-    if (b == e) { *success = false; return b; }
+    if (!token_available(ctx, b)) { *success = false; return b; }
 
-    if ((*b)->type == token::OPERATOR)
+    if (token_type_at(ctx, b) == token::OPERATOR)
     {
-        operator_token *tok = reinterpret_cast<operator_token *>(*b);
-        if (!strcmp(tok->value, "(") || !strcmp(tok->value, "[") || !strcmp(tok->value, "{") ||
-            !strcmp(tok->value, ")") || !strcmp(tok->value, "]") || !strcmp(tok->value, "}"))
+        switch (token_atom_at(ctx, b))
         {
-            *success = false;
-            return b;
+            case ATOM_LPAREN: case ATOM_LBRACKET: case ATOM_LBRACE:
+            case ATOM_RPAREN: case ATOM_RBRACKET: case ATOM_RBRACE:
+                *success = false;
+                return b;
         }
     }
 
-    syntax_tree_node *node = new syntax_tree_node(syntax_tree_node::TRIVIALLY_BALANCED_TOKEN, parent);
-    (new syntax_tree_node(syntax_tree_node::TOKEN, node))->ass_token = *b;
-    if (++b > maximum_extent) maximum_extent = b;
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TRIVIALLY_BALANCED_TOKEN, parent);
+    (new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node))->ass_token = b;
+    if (++b > ctx->maximum_extent) ctx->maximum_extent = b;
     *success = true;
     return b;
 }
 
 
 // excluding new, new[], delete, delete[], () and [].
-static const char *const overloadable_operators[] = {
-    "+", "-", "*", "/", "%", "^", "&", "|", "~", "!", "=", "<", ">", "+=", "-=",
-    "*=", "/=", "%=", "^=", "&=", "|=", "<<", ">>", ">>=", "<<=", "==", "!=",
-    "<=", ">=", "&&", "||", "++", "--", ",", "->*", "->"
+static const atom_t overloadable_operators[] = {
+    ATOM_PLUS, ATOM_MINUS, ATOM_STAR, ATOM_SLASH, ATOM_PERCENT, ATOM_CARET,
+    ATOM_AMP, ATOM_PIPE, ATOM_TILDE, ATOM_EXCLAIM, ATOM_ASSIGN, ATOM_LESS,
+    ATOM_GREATER, ATOM_PLUS_ASSIGN, ATOM_MINUS_ASSIGN, ATOM_STAR_ASSIGN,
+    ATOM_SLASH_ASSIGN, ATOM_PERCENT_ASSIGN, ATOM_CARET_ASSIGN, ATOM_AMP_ASSIGN,
+    ATOM_PIPE_ASSIGN, ATOM_LSHIFT, ATOM_RSHIFT, ATOM_RSHIFT_ASSIGN,
+    ATOM_LSHIFT_ASSIGN, ATOM_EQ, ATOM_NE, ATOM_LE, ATOM_GE, ATOM_AMP_AMP,
+    ATOM_PIPE_PIPE, ATOM_PLUS_PLUS, ATOM_MINUS_MINUS, ATOM_COMMA, ATOM_ARROW_STAR,
+    ATOM_ARROW
 };
 
-static range_t sv_overloadable_operator(syntax_tree_node *parent, range_t b, range_t e, bool *success)
+static range_t sv_overloadable_operator(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
 {
-    if (b == e) { *success = false; return b; }
+    if (!token_available(ctx, b)) { *success = false; return b; }
 
-    if ((*b)->type != token::OPERATOR)
+    if (token_type_at(ctx, b) != token::OPERATOR)
     {
         *success = false;
         return b;
     }
 
-    operator_token *tok = reinterpret_cast<operator_token *>(*b);
+    atom_t op = token_atom_at(ctx, b);
 
-    if (!strcmp(tok->value, "new") || !strcmp(tok->value, "delete"))
+    if ((op == ATOM_NEW) || (op == ATOM_DELETE))
     {
         range_t m = b;
 
         ++m;
-        if (((*m)->type == token::OPERATOR) && !strcmp(reinterpret_cast<operator_token *>(*m)->value, "["))
+        if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_LBRACKET))
         {
             ++m;
-            if (((*m)->type == token::OPERATOR) && !strcmp(reinterpret_cast<operator_token *>(*m)->value, "]"))
+            if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_RBRACKET))
             {
-                syntax_tree_node *node = new syntax_tree_node(syntax_tree_node::OVERLOADABLE_OPERATOR, parent);
-                (new syntax_tree_node(syntax_tree_node::TOKEN, node))->ass_token = *b;
-                (new syntax_tree_node(syntax_tree_node::TOKEN, node))->ass_token = *++b;
-                (new syntax_tree_node(syntax_tree_node::TOKEN, node))->ass_token = *++b;
-                if (++b > maximum_extent) maximum_extent = b;
+                syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::OVERLOADABLE_OPERATOR, parent);
+                (new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node))->ass_token = b;
+                (new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node))->ass_token = ++b;
+                (new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node))->ass_token = ++b;
+                if (++b > ctx->maximum_extent) ctx->maximum_extent = b;
                 *success = true;
                 return b;
             }
         }
     }
-    else if (!strcmp(tok->value, "(") || !strcmp(tok->value, "["))
+    else if ((op == ATOM_LPAREN) || (op == ATOM_LBRACKET))
     {
         range_t m = b;
 
         ++m;
-        if (((*m)->type != token::OPERATOR) || strcmp(reinterpret_cast<operator_token *>(*m)->value, (*tok->value == '(') ? ")" : "]"))
+        if (!token_available(ctx, m) || (token_type_at(ctx, m) != token::OPERATOR) || (token_atom_at(ctx, m) != ((op == ATOM_LPAREN) ? ATOM_RPAREN : ATOM_RBRACKET)))
         {
             *success = false;
             return b;
@@ -376,9 +849,9 @@ static range_t sv_overloadable_operator(syntax_tree_node *parent, range_t b, ran
     else
     {
         bool found = false;
-        for (const char *op: overloadable_operators)
+        for (atom_t overloadable: overloadable_operators)
         {
-            if (!strcmp(tok->value, op))
+            if (op == overloadable)
             {
                 found = true;
                 break;
@@ -393,44 +866,32 @@ static range_t sv_overloadable_operator(syntax_tree_node *parent, range_t b, ran
     }
 
 
-    syntax_tree_node *node = new syntax_tree_node(syntax_tree_node::OVERLOADABLE_OPERATOR, parent);
-    (new syntax_tree_node(syntax_tree_node::TOKEN, node))->ass_token = *b;
-    if (++b > maximum_extent) maximum_extent = b;
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::OVERLOADABLE_OPERATOR, parent);
+    (new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node))->ass_token = b;
+    if (++b > ctx->maximum_extent) ctx->maximum_extent = b;
     *success = true;
     return b;
 }
 
 
-struct namespace_scope_entry
-{
-    syntax_tree_node *scope;
-    syntax_tree_node *related;
-};
-
-std::stack<namespace_scope_entry> namespace_scope_stack;
-
-static syntax_tree_node *namespace_scope;
-
-
-static void push_plain_qualified_ids(syntax_tree_node *node, syntax_tree_node *declaration, std::list<keyword_entry> *target)
+static void push_plain_qualified_ids(parser_context *ctx, syntax_tree_node *node, syntax_tree_node *declaration, unsigned kind)
 {
     for (syntax_tree_node *c: node->children)
     {
         if ((c->type == syntax_tree_node::UNQUALIFIED_ID) &&
             (c->children.front()->type == syntax_tree_node::TOKEN) &&
-            (c->children.front()->ass_token->type == token::IDENTIFIER))
+            (token_type_at(ctx, c->children.front()->ass_token) == token::IDENTIFIER))
         {
             // FIXME: Use complete_declaration for type reference
-            target->push_back({strdup(reinterpret_cast<identifier_token *>(c->children.front()->ass_token)->value), declaration, nullptr});
-            keywords.push_back({strdup(reinterpret_cast<identifier_token *>(c->children.front()->ass_token)->value), declaration, nullptr});
+            add_name(ctx, token_atom_at(ctx, c->children.front()->ass_token), kind | name_entry::KEYWORD, declaration, nullptr);
         }
         else
-            push_plain_qualified_ids(c, declaration, target);
+            push_plain_qualified_ids(ctx, c, declaration, kind);
     }
 }
 
 
-static void simple_declaration_done(syntax_tree_node *node)
+static void simple_declaration_done(parser_context *ctx, syntax_tree_node *node)
 {
     syntax_tree_node *dss = nullptr, *idl = nullptr;
     for (syntax_tree_node *c: node->children)
@@ -447,13 +908,13 @@ static void simple_declaration_done(syntax_tree_node *node)
         {
             if ((c->type == syntax_tree_node::DECL_SPECIFIER) &&
                 (c->children.front()->type == syntax_tree_node::TOKEN) &&
-                (c->children.front()->ass_token->type == token::IDENTIFIER) &&
-                !strcmp(reinterpret_cast<identifier_token *>(c->children.front()->ass_token)->value, "typedef"))
+                (token_type_at(ctx, c->children.front()->ass_token) == token::IDENTIFIER) &&
+                (token_atom_at(ctx, c->children.front()->ass_token) == ATOM_TYPEDEF))
             {
                 // node: simple-declaration
                 // node->parent: block-declaration
                 // node->parent->parent: declaration
-                push_plain_qualified_ids(idl, node->parent->parent, &typedef_names);
+                push_plain_qualified_ids(ctx, idl, node->parent->parent, name_entry::TYPEDEF);
                 break;
             }
         }
@@ -466,25 +927,21 @@ static void simple_declaration_done(syntax_tree_node *node)
             if ((c = c->children.front())->type != syntax_tree_node::TYPE_SPECIFIER) continue;
             c = c->children.front();
 
-            identifier_token *tok = nullptr;
-
             if (c->type == syntax_tree_node::TRAILING_TYPE_SPECIFIER)
             {
                 if ((c = c->children.front())->type != syntax_tree_node::ELABORATED_TYPE_SPECIFIER) continue;
                 if (c->children.front()->type != syntax_tree_node::CLASS_KEY) continue;
                 if ((c = c->children.back())->type != syntax_tree_node::TOKEN) continue;
-                if (c->ass_token->type != token::IDENTIFIER) continue;
-                tok = reinterpret_cast<identifier_token *>(c->ass_token);
+                if (token_type_at(ctx, c->ass_token) != token::IDENTIFIER) continue;
 
-                class_names.push_back({strdup(tok->value), node->parent->parent, nullptr});
-                keywords.push_back({strdup(tok->value), node->parent->parent, nullptr});
+                add_name(ctx, token_atom_at(ctx, c->ass_token), name_entry::CLASS | name_entry::KEYWORD, node->parent->parent, nullptr);
             }
         }
     }
 }
 
 
-static void class_specifier_done(syntax_tree_node *node)
+static void class_specifier_done(parser_context *ctx, syntax_tree_node *node)
 {
     syntax_tree_node *c = node->children.front();
 
@@ -495,7 +952,7 @@ static void class_specifier_done(syntax_tree_node *node)
         {
             if ((cc = cc->children.back())->type != syntax_tree_node::CLASS_NAME) continue;
             if ((cc = cc->children.back())->type != syntax_tree_node::TOKEN) continue;
-            if (cc->ass_token->type != token::IDENTIFIER) continue;
+            if (token_type_at(ctx, cc->ass_token) != token::IDENTIFIER) continue;
 
             // TODO: Overwrite old entry, if it exists
 
@@ -503,8 +960,7 @@ static void class_specifier_done(syntax_tree_node *node)
             for (decl = node; decl && (decl->type != syntax_tree_node::DECLARATION) && (decl->type != syntax_tree_node::MEMBER_DECLARATION); decl = decl->parent);
             decl = decl ? decl : node;
 
-            class_names.push_back({strdup(reinterpret_cast<identifier_token *>(cc->ass_token)->value), decl, node});
-            keywords.push_back({strdup(reinterpret_cast<identifier_token *>(cc->ass_token)->value), decl, node});
+            add_name(ctx, token_atom_at(ctx, cc->ass_token), name_entry::CLASS | name_entry::KEYWORD, decl, node);
 
             return;
         }
@@ -512,17 +968,26 @@ static void class_specifier_done(syntax_tree_node *node)
 }
 
 
-static void template_declaration_done(syntax_tree_node *node)
+static void template_declaration_done(parser_context *ctx, syntax_tree_node *node)
 {
     for (syntax_tree_node *c: node->children)
-        if ((c->type == syntax_tree_node::DECLARATION) || (c->type == syntax_tree_node::MEMBER_DECLARATION))
-            for (const keyword_entry &kw: class_names)
-                if (kw.declaration == c)
-                    template_names.push_back({strdup(kw.identifier), node->parent, kw.complete_declaration});
+    {
+        if ((c->type != syntax_tree_node::DECLARATION) && (c->type != syntax_tree_node::MEMBER_DECLARATION))
+            continue;
+
+        // c->names lists the newest registration first
+        std::vector<const name_entry *> classes;
+        for (const name_link *link = c->names; link; link = link->next)
+            if ((link->entry->kinds & name_entry::CLASS) && (link->entry->declaration == c))
+                classes.push_back(link->entry);
+
+        for (auto kw = classes.rbegin(); kw != classes.rend(); ++kw)
+            add_name(ctx, (*kw)->name, name_entry::TEMPLATE, node->parent, (*kw)->complete_declaration);
+    }
 }
 
 
-static void template_parameter_done(syntax_tree_node *node)
+static void template_parameter_done(parser_context *ctx, syntax_tree_node *node)
 {
     // Not really a declaration but lol idc yours clici
 
@@ -531,31 +996,33 @@ static void template_parameter_done(syntax_tree_node *node)
 
     if (node->type == syntax_tree_node::TYPE_PARAMETER)
     {
-        const char *identifier = nullptr;
+        atom_t identifier = ATOM_NONE;
         // am i doin it rite
         for (syntax_tree_node *c: node->children)
         {
             if ((c->type == syntax_tree_node::TOKEN) &&
-                (c->ass_token->type == token::IDENTIFIER) &&
-                is_identifier(c, c->ass_token, nullptr))
+                (token_type_at(ctx, c->ass_token) == token::IDENTIFIER) &&
+                is_identifier(ctx, c, c->ass_token, ATOM_NONE))
             {
-                identifier = reinterpret_cast<identifier_token *>(c->ass_token)->value;
+                identifier = token_atom_at(ctx, c->ass_token);
                 break;
             }
         }
 
-        if (identifier)
+        if (identifier != ATOM_NONE)
         {
-            if (!strcmp(reinterpret_cast<identifier_token *>(node->children.front()->ass_token)->value, "template"))
-                template_names.push_back({strdup(identifier), declaration, nullptr});
-            else if (!strcmp(reinterpret_cast<identifier_token *>(node->children.front()->ass_token)->value, "typename"))
-                typedef_names.push_back({strdup(identifier), declaration, nullptr});
-            else if (!strcmp(reinterpret_cast<identifier_token *>(node->children.front()->ass_token)->value, "class"))
-                class_names.push_back({strdup(identifier), declaration, nullptr});
-            else
-                throw format("A type parameter must be precedented by template, typename or class. Check the syntax definition file.");
+            unsigned kind;
+
+            switch (token_atom_at(ctx, node->children.front()->ass_token))
+            {
+                case ATOM_TEMPLATE: kind = name_entry::TEMPLATE; break;
+                case ATOM_TYPENAME: kind = name_entry::TYPEDEF;  break;
+                case ATOM_CLASS:    kind = name_entry::CLASS;    break;
+                default:
+                    throw format("A type parameter must be precedented by template, typename or class. Check the syntax definition file.");
+            }
 
-            keywords.push_back({strdup(identifier), declaration, nullptr});
+            add_name(ctx, identifier, kind | name_entry::KEYWORD, declaration, nullptr);
         }
     }
     // Nothing to do for parameter-declaration, since this only introduces a
@@ -565,7 +1032,7 @@ static void template_parameter_done(syntax_tree_node *node)
 }
 
 
-static void original_namespace_definition_done(syntax_tree_node *node)
+static void original_namespace_definition_done(parser_context *ctx, syntax_tree_node *node)
 {
     auto i = node->children.begin();
     ++i;
@@ -573,32 +1040,30 @@ static void original_namespace_definition_done(syntax_tree_node *node)
     if ((*i)->type != syntax_tree_node::TOKEN)
         throw format("original-namespace-definition must start with at least two tokens. Check the syntax definition file.");
 
-    if (!strcmp(reinterpret_cast<identifier_token *>((*i)->ass_token)->value, "namespace")) // First was "inline", then
+    if (token_atom_at(ctx, (*i)->ass_token) == ATOM_NAMESPACE) // First was "inline", then
         ++i;
 
     if ((*i)->type != syntax_tree_node::TOKEN)
         throw format("Identifier missing in original-namespace-definition.");
 
-    original_namespace_names.push_back({strdup(reinterpret_cast<identifier_token *>((*i)->ass_token)->value), node, node});
-    keywords.push_back({strdup(reinterpret_cast<identifier_token *>((*i)->ass_token)->value), node, node});
+    add_name(ctx, token_atom_at(ctx, (*i)->ass_token), name_entry::NAMESPACE | name_entry::KEYWORD, node, node);
 }
 
 
-static range_t sv_typedef_name(syntax_tree_node *parent, range_t b, range_t e, bool *success)
+static range_t sv_typedef_name(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
 {
-    if (b == e) { *success = false; return b; }
+    if (!token_available(ctx, b)) { *success = false; return b; }
 
-    if ((*b)->type == token::IDENTIFIER)
+    if (token_type_at(ctx, b) == token::IDENTIFIER)
     {
-        for (const keyword_entry &typedefd: typedef_names)
+        for (const name_entry *typedefd = first_name(ctx, token_atom_at(ctx, b)); typedefd; typedefd = typedefd->next_same)
         {
-            if (!strcmp(reinterpret_cast<identifier_token *>(*b)->value, typedefd.identifier) &&
-                parent->sees_in_ns(typedefd.declaration, namespace_scope))
+            if ((typedefd->kinds & name_entry::TYPEDEF) && parent->sees_in_ns(*ctx->tokens, typedefd->declaration, ctx->namespace_scope))
             {
-                syntax_tree_node *node = new syntax_tree_node(syntax_tree_node::TYPEDEF_NAME, parent);
-                node->supplemental.declaration = typedefd.complete_declaration;
-                (new syntax_tree_node(syntax_tree_node::TOKEN, node))->ass_token = *b;
-                if (++b > maximum_extent) maximum_extent = b;
+                syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TYPEDEF_NAME, parent);
+                node->supplemental.declaration = typedefd->complete_declaration;
+                (new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node))->ass_token = b;
+                if (++b > ctx->maximum_extent) ctx->maximum_extent = b;
                 *success = true;
                 return b;
             }
@@ -610,21 +1075,20 @@ static range_t sv_typedef_name(syntax_tree_node *parent, range_t b, range_t e, b
 }
 
 
-static range_t sv_original_namespace_name(syntax_tree_node *parent, range_t b, range_t e, bool *success)
+static range_t sv_original_namespace_name(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
 {
-    if (b == e) { *success = false; return b; }
+    if (!token_available(ctx, b)) { *success = false; return b; }
 
-    if ((*b)->type == token::IDENTIFIER)
+    if (token_type_at(ctx, b) == token::IDENTIFIER)
     {
-        for (const keyword_entry &ns: original_namespace_names)
+        for (const name_entry *ns = first_name(ctx, token_atom_at(ctx, b)); ns; ns = ns->next_same)
         {
-            if (!strcmp(reinterpret_cast<identifier_token *>(*b)->value, ns.identifier) &&
-                parent->sees_in_ns(ns.declaration, namespace_scope))
+            if ((ns->kinds & name_entry::NAMESPACE) && parent->sees_in_ns(*ctx->tokens, ns->declaration, ctx->namespace_scope))
             {
-                syntax_tree_node *node = new syntax_tree_node(syntax_tree_node::ORIGINAL_NAMESPACE_NAME, parent);
-                node->supplemental.declaration = ns.complete_declaration;
-                (new syntax_tree_node(syntax_tree_node::TOKEN, node))->ass_token = *b;
-                if (++b > maximum_extent) maximum_extent = b;
+                syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::ORIGINAL_NAMESPACE_NAME, parent);
+                node->supplemental.declaration = ns->complete_declaration;
+                (new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node))->ass_token = b;
+                if (++b > ctx->maximum_extent) ctx->maximum_extent = b;
                 *success = true;
                 return b;
             }
@@ -636,36 +1100,38 @@ static range_t sv_original_namespace_name(syntax_tree_node *parent, range_t b, r
 }
 
 
-static range_t sv_namespace_alias(syntax_tree_node *parent, range_t b, range_t e, bool *success)
+static range_t sv_namespace_alias(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
 {
+    (void)ctx;
     (void)parent;
 
-    if (b == e) { *success = false; return b; }
+    if (!token_available(ctx, b)) { *success = false; return b; }
 
     *success = false;
     return b;
 }
 
 
-static range_t sv_class_name(syntax_tree_node *parent, range_t b, range_t e, bool *success)
+static range_t sv_class_name(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
 {
-    if (b == e) { *success = false; return b; }
+    if (!token_available(ctx, b)) { *success = false; return b; }
 
-    syntax_tree_node *node = new syntax_tree_node(syntax_tree_node::CLASS_NAME, parent);
+    parse_mark entry_mark = mark_parse(ctx);
+    syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::CLASS_NAME, parent);
 
     // FIXME: God please this is shit (read: only accept templates resolving to classes here)
     bool could_parse;
-    range_t m = sv_simple_template_id(node, b, e, &could_parse);
+    range_t m = sv_simple_template_id(ctx, node, b, &could_parse);
     if (could_parse)
     {
         //                             class-name   simple-template-id  template-name
         node->supplemental.declaration = node->children.front()->children.front()->supplemental.declaration;
-        if (m > maximum_extent) maximum_extent = m;
+        if (m > ctx->maximum_extent) ctx->maximum_extent = m;
         *success = true;
         return m;
     }
 
-    if ((*b)->type == token::IDENTIFIER)
+    if (token_type_at(ctx, b) == token::IDENTIFIER)
     {
         if (parent->type == syntax_tree_node::CLASS_HEAD_NAME)
         {
@@ -674,40 +1140,38 @@ static range_t sv_class_name(syntax_tree_node *parent, range_t b, range_t e, boo
             // partial specialization etc.) and any identifier in general.
             // However, they have to be true identifiers (no keywords).
 
-            if (is_identifier(parent, *b, nullptr))
+            if (is_identifier(ctx, parent, b, ATOM_NONE))
             {
                 // class-head-name -> class-head -> class-specifier
                 node->supplemental.declaration = parent->parent->parent;
-                (new syntax_tree_node(syntax_tree_node::TOKEN, node))->ass_token = *b;
-                if (++b > maximum_extent) maximum_extent = b;
+                (new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node))->ass_token = b;
+                if (++b > ctx->maximum_extent) ctx->maximum_extent = b;
                 *success = true;
                 return b;
             }
         }
 
-        for (const keyword_entry &cn: class_names)
+        for (const name_entry *cn = first_name(ctx, token_atom_at(ctx, b)); cn; cn = cn->next_same)
         {
-            if (!strcmp(reinterpret_cast<identifier_token *>(*b)->value, cn.identifier) &&
-                parent->sees_in_ns(cn.declaration, namespace_scope))
+            if ((cn->kinds & name_entry::CLASS) && parent->sees_in_ns(*ctx->tokens, cn->declaration, ctx->namespace_scope))
             {
-                node->supplemental.declaration = cn.complete_declaration;
-                (new syntax_tree_node(syntax_tree_node::TOKEN, node))->ass_token = *b;
-                if (++b > maximum_extent) maximum_extent = b;
+                node->supplemental.declaration = cn->complete_declaration;
+                (new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node))->ass_token = b;
+                if (++b > ctx->maximum_extent) ctx->maximum_extent = b;
                 *success = true;
                 return b;
             }
         }
 
         // FIXME: Only accept class typedefs here (i.e., resolve typedef)
-        for (const keyword_entry &typedefd: typedef_names)
+        for (const name_entry *typedefd = first_name(ctx, token_atom_at(ctx, b)); typedefd; typedefd = typedefd->next_same)
         {
-            if (!strcmp(reinterpret_cast<identifier_token *>(*b)->value, typedefd.identifier) &&
-                parent->sees_in_ns(typedefd.declaration, namespace_scope))
+            if ((typedefd->kinds & name_entry::TYPEDEF) && parent->sees_in_ns(*ctx->tokens, typedefd->declaration, ctx->namespace_scope))
             {
                 // FIXME: RESOLVE NAO
-                node->supplemental.declaration = typedefd.complete_declaration;
-                (new syntax_tree_node(syntax_tree_node::TOKEN, node))->ass_token = *b;
-                if (++b > maximum_extent) maximum_extent = b;
+                node->supplemental.declaration = typedefd->complete_declaration;
+                (new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node))->ass_token = b;
+                if (++b > ctx->maximum_extent) ctx->maximum_extent = b;
                 *success = true;
                 return b;
             }
@@ -715,38 +1179,37 @@ static range_t sv_class_name(syntax_tree_node *parent, range_t b, range_t e, boo
     }
 
     node->detach();
-    delete node;
+    rollback_parse(ctx, entry_mark);
 
     *success = false;
     return b;
 }
 
 
-static range_t sv_enum_name(syntax_tree_node *parent, range_t b, range_t e, bool *success)
+static range_t sv_enum_name(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
 {
+    (void)ctx;
     (void)parent;
-    (void)e;
 
     *success = false;
     return b;
 }
 
 
-static range_t sv_template_name(syntax_tree_node *parent, range_t b, range_t e, bool *success)
+static range_t sv_template_name(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
 {
-    if (b == e) { *success = false; return b; }
+    if (!token_available(ctx, b)) { *success = false; return b; }
 
-    if ((*b)->type == token::IDENTIFIER)
+    if (token_type_at(ctx, b) == token::IDENTIFIER)
     {
-        for (const keyword_entry &tn: template_names)
+        for (const name_entry *tn = first_name(ctx, token_atom_at(ctx, b)); tn; tn = tn->next_same)
         {
-            if (!strcmp(reinterpret_cast<identifier_token *>(*b)->value, tn.identifier) &&
-                parent->sees_in_ns(tn.declaration, namespace_scope))
+            if ((tn->kinds & name_entry::TEMPLATE) && parent->sees_in_ns(*ctx->tokens, tn->declaration, ctx->namespace_scope))
             {
-                syntax_tree_node *node = new syntax_tree_node(syntax_tree_node::TEMPLATE_NAME, parent);
-                node->supplemental.declaration = tn.complete_declaration;
-                (new syntax_tree_node(syntax_tree_node::TOKEN, node))->ass_token = *b;
-                if (++b > maximum_extent) maximum_extent = b;
+                syntax_tree_node *node = new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TEMPLATE_NAME, parent);
+                node->supplemental.declaration = tn->complete_declaration;
+                (new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, node))->ass_token = b;
+                if (++b > ctx->maximum_extent) ctx->maximum_extent = b;
                 *success = true;
                 return b;
             }
@@ -758,16 +1221,16 @@ static range_t sv_template_name(syntax_tree_node *parent, range_t b, range_t e,
 }
 
 
-static range_t sv_right_shift(syntax_tree_node *parent, range_t b, range_t e, bool *success)
+static range_t sv_right_shift(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
 {
     range_t m = b;
 
-    if ((m != e) && ((*m)->type == token::OPERATOR) && !strcmp(reinterpret_cast<operator_token *>(*m)->value, ">"))
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_GREATER))
     {
         ++m;
-        if ((m != e) && ((*m)->type == token::OPERATOR) &&
-            ((*m)->line == (*b)->line) && ((*m)->column == (*b)->column + 1) &&
-            !strcmp(reinterpret_cast<operator_token *>(*m)->value, ">"))
+        if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) &&
+            (ctx->tokens->offsets[m] == ctx->tokens->offsets[b] + 1) &&
+            (token_atom_at(ctx, m) == ATOM_GREATER))
         {
             // XXX: This is evil. All code normally assumes that every SV
             // matching function only adds a single child node to the parent.
@@ -775,9 +1238,9 @@ static range_t sv_right_shift(syntax_tree_node *parent, range_t b, range_t e, bo
             // matched children after a loop. However, this SV's parent
             // (shift-operator) is never part of a loop. Therefore, this is
             // safe.
-            (new syntax_tree_node(syntax_tree_node::TOKEN, parent))->ass_token = *b;
-            (new syntax_tree_node(syntax_tree_node::TOKEN, parent))->ass_token = *m;
-            if (++m > maximum_extent) maximum_extent = m;
+            (new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, parent))->ass_token = b;
+            (new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, parent))->ass_token = m;
+            if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
             *success = true;
             return m;
         }
@@ -788,21 +1251,21 @@ static range_t sv_right_shift(syntax_tree_node *parent, range_t b, range_t e, bo
 }
 
 
-static range_t sv_right_shift_assignment(syntax_tree_node *parent, range_t b, range_t e, bool *success)
+static range_t sv_right_shift_assignment(parser_context *ctx, syntax_tree_node *parent, range_t b, bool *success)
 {
     range_t m = b;
 
-    if ((m != e) && ((*m)->type == token::OPERATOR) && !strcmp(reinterpret_cast<operator_token *>(*m)->value, ">"))
+    if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) && (token_atom_at(ctx, m) == ATOM_GREATER))
     {
         ++m;
-        if ((m != e) && ((*m)->type == token::OPERATOR) &&
-            ((*m)->line == (*b)->line) && ((*m)->column == (*b)->column + 1) &&
-            !strcmp(reinterpret_cast<operator_token *>(*m)->value, ">="))
+        if (token_available(ctx, m) && (token_type_at(ctx, m) == token::OPERATOR) &&
+            (ctx->tokens->offsets[m] == ctx->tokens->offsets[b] + 1) &&
+            (token_atom_at(ctx, m) == ATOM_GE))
         {
             // XXX: See above.
-            (new syntax_tree_node(syntax_tree_node::TOKEN, parent))->ass_token = *b;
-            (new syntax_tree_node(syntax_tree_node::TOKEN, parent))->ass_token = *m;
-            if (++m > maximum_extent) maximum_extent = m;
+            (new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, parent))->ass_token = b;
+            (new (ctx->node_arena) syntax_tree_node(syntax_tree_node::TOKEN, parent))->ass_token = m;
+            if (++m > ctx->maximum_extent) ctx->maximum_extent = m;
             *success = true;
             return m;
         }
@@ -814,9 +1277,8 @@ static range_t sv_right_shift_assignment(syntax_tree_node *parent, range_t b, ra
 
 
 // God I hate this fucking syntax
-static range_t repair_noptr_declarator(syntax_tree_node *node, range_t b, range_t e, bool *success)
+static range_t repair_noptr_declarator(parser_context *ctx, syntax_tree_node *node, range_t b, bool *success)
 {
-    (void)e;
     (void)success;
 
     if (node->parent->type != syntax_tree_node::DECLARATOR)
@@ -831,15 +1293,12 @@ static range_t repair_noptr_declarator(syntax_tree_node *node, range_t b, range_
 
     // I HATE IT
 
-    token *tok = c->first_token();
+    token_index tok = c->first_token();
 
-    delete c;
     node->children.pop_back();
+    discard_node(ctx, c);
 
-    while (*b != tok)
-        --b;
-
-    return b;
+    return tok;
 
     /* Explanation: If noptr-declarator appears directly inside of declarator,
      * it is followed by a mandatory parameters-and-qualifiers. However,
@@ -850,7 +1309,7 @@ static range_t repair_noptr_declarator(syntax_tree_node *node, range_t b, range_
 }
 
 
-static void nested_name_specifier_start_done(syntax_tree_node *node)
+static void nested_name_specifier_start_done(parser_context *ctx, syntax_tree_node *node)
 {
     auto ci = node->children.begin();
 
@@ -865,16 +1324,16 @@ static void nested_name_specifier_start_done(syntax_tree_node *node)
         n = n->children.front(); // template-name
 
     syntax_tree_node *ns_scope = n->supplemental.declaration ? n->supplemental.declaration->scope_below() : nullptr;
-    namespace_scope_stack.push({ns_scope, node->parent->parent});
-    namespace_scope = ns_scope;
+    ctx->namespace_scope_stack.push({ns_scope, node->parent->parent});
+    ctx->namespace_scope = ns_scope;
 }
 
 
-static void nested_name_specifier_repeatable_done(syntax_tree_node *node)
+static void nested_name_specifier_repeatable_done(parser_context *ctx, syntax_tree_node *node)
 {
     auto ci = node->children.begin();
 
-    if (((*ci)->type == syntax_tree_node::TOKEN) && !strcmp((*ci)->ass_token->content, "template"))
+    if (((*ci)->type == syntax_tree_node::TOKEN) && (token_atom_at(ctx, (*ci)->ass_token) == ATOM_TEMPLATE))
         ++ci;
 
     syntax_tree_node *n = (*ci)->children.front();
@@ -885,95 +1344,421 @@ static void nested_name_specifier_repeatable_done(syntax_tree_node *node)
     if (ns_scope && (ns_scope->type != syntax_tree_node::CLASS_SPECIFIER))
         ns_scope = ns_scope->scope_below();
 
-    namespace_scope_stack.pop();
-    namespace_scope_stack.push({ns_scope, node->parent->parent});
-    namespace_scope = ns_scope;
+    ctx->namespace_scope_stack.pop();
+    ctx->namespace_scope_stack.push({ns_scope, node->parent->parent});
+    ctx->namespace_scope = ns_scope;
 }
 
 
-static void clear_nested_name_specifier(syntax_tree_node *node)
+static void clear_nested_name_specifier(parser_context *ctx, syntax_tree_node *node)
 {
-    if (namespace_scope_stack.empty())
+    if (ctx->namespace_scope_stack.empty())
         return;
 
-    if (node == namespace_scope_stack.top().related)
+    if (node == ctx->namespace_scope_stack.top().related)
     {
-        namespace_scope_stack.pop();
+        ctx->namespace_scope_stack.pop();
 
-        if (!namespace_scope_stack.empty())
-            namespace_scope = namespace_scope_stack.top().scope;
+        if (!ctx->namespace_scope_stack.empty())
+            ctx->namespace_scope = ctx->namespace_scope_stack.top().scope;
         else
-            namespace_scope = nullptr;
+            ctx->namespace_scope = nullptr;
     }
 }
 
 
-static void push_null_namespace(syntax_tree_node *node)
+static void push_null_namespace(parser_context *ctx, syntax_tree_node *node)
 {
-    if ((node->parent->type == syntax_tree_node::QUALIFIED_ID) || !namespace_scope)
+    if ((node->parent->type == syntax_tree_node::QUALIFIED_ID) || !ctx->namespace_scope)
         return;
 
-    namespace_scope_stack.push({nullptr, node});
-    namespace_scope = nullptr;
+    ctx->namespace_scope_stack.push({nullptr, node});
+    ctx->namespace_scope = nullptr;
+}
+
+
+#ifdef PACKRAT_PARSER
+static void park_subtree(parser_context *ctx, syntax_tree_node *node)
+{
+    // This subtree is not part of the syntax tree anymore, so its names must
+    // vanish; memo_replay_hooks() registers them again on reuse.
+    std::vector<const syntax_tree_node *> pending = {node};
+    while (!pending.empty())
+    {
+        const syntax_tree_node *n = pending.back();
+        pending.pop_back();
+
+        unregister_names(ctx, n);
+        for (const syntax_tree_node *c: n->children)
+            pending.push_back(c);
+    }
+
+    node->parent = nullptr;
+    ctx->parked_trees.push_back(node);
+}
+
+
+static const syntax_tree_node *scope_anchor(const syntax_tree_node *node)
+{
+    for (; node; node = node->parent)
+        if ((node->type == syntax_tree_node::COMPOUND_STATEMENT) || (node->type == syntax_tree_node::CLASS_SPECIFIER) ||
+            (node->type == syntax_tree_node::DECLARATION_SEQ) || (node->type == syntax_tree_node::TEMPLATE_DECLARATION))
+            return node;
+
+    return nullptr;
+}
+
+
+/**
+ * Returns the memo entry for the given syntactic variable being matched at b.
+ * If its outcome is not PENDING, it can be used as the result of the match
+ * through memo_recall(). Otherwise, the result has to be stored through
+ * memo_store_success() or memo_store_failure(). Returns nullptr if this
+ * variable is already being matched at this position.
+ */
+static memo_entry *memo_fetch(parser_context *ctx, syntax_tree_node::sv_type type, syntax_tree_node *parent, range_t b)
+{
+    memo_entry &me = ctx->memo_table[(static_cast<uint64_t>(b) << 16) | type];
+    const syntax_tree_node *anchor = scope_anchor(parent);
+
+    if (me.outcome == memo_entry::PENDING)
+        return nullptr;
+
+    if ((me.outcome != memo_entry::UNKNOWN) &&
+        (me.names == ctx->name_state) && (me.ns_scope == ctx->namespace_scope) &&
+        (me.anchor == anchor) && (me.parent_type == parent->type) &&
+        ((me.outcome == memo_entry::FAILED) || me.tree))
+    {
+        return &me;
+    }
+
+    if (me.tree)
+        me.tree->memo = nullptr;
+
+    me.outcome = memo_entry::PENDING;
+    me.names = ctx->name_state;
+    me.ns_scope = ctx->namespace_scope;
+    me.anchor = anchor;
+    me.parent_type = parent->type;
+    me.tree = nullptr;
+
+    return &me;
+}
+
+
+static void memo_store_success(memo_entry *me, syntax_tree_node *node, range_t m)
+{
+    me->outcome = memo_entry::SUCCEEDED;
+    me->end = m;
+    me->tree = node;
+    node->memo = me;
+}
+
+
+static void memo_store_failure(memo_entry *me)
+{
+    me->outcome = memo_entry::FAILED;
+}
+
+
+static syntax_tree_node *clone_subtree(parser_context *ctx, const syntax_tree_node *node, syntax_tree_node *parent, std::unordered_map<const syntax_tree_node *, syntax_tree_node *> *clones)
+{
+    syntax_tree_node *copy = new (ctx->node_arena) syntax_tree_node(node->type, parent, node->intermediate);
+    copy->ass_token = node->ass_token;
+    copy->supplemental = node->supplemental;
+    (*clones)[node] = copy;
+
+    for (const syntax_tree_node *c: node->children)
+        clone_subtree(ctx, c, copy, clones);
+
+    return copy;
+}
+
+
+static range_t memo_recall(parser_context *ctx, memo_entry *me, syntax_tree_node *parent, range_t b, bool *success)
+{
+    if (me->outcome == memo_entry::FAILED)
+    {
+        *success = false;
+        return b;
+    }
+
+    std::unordered_map<const syntax_tree_node *, syntax_tree_node *> clones;
+    clone_subtree(ctx, me->tree, parent, &clones);
+
+    for (auto &clone: clones)
+    {
+        syntax_tree_node *copy = clone.second;
+
+        switch (copy->type)
+        {
+            case syntax_tree_node::TYPEDEF_NAME:
+            case syntax_tree_node::CLASS_NAME:
+            case syntax_tree_node::TEMPLATE_NAME:
+            case syntax_tree_node::ORIGINAL_NAMESPACE_NAME:
+                break;
+
+            default:
+                continue;
+        }
+
+        if ((copy->type == syntax_tree_node::CLASS_NAME) && (copy->parent->type == syntax_tree_node::CLASS_HEAD_NAME) &&
+            (copy->children.front()->type == syntax_tree_node::TOKEN))
+        {
+            // Newly introduced class-name, refers to its own class-specifier
+            // (see sv_class_name())
+            copy->supplemental.declaration = copy->parent->parent->parent;
+        }
+        else
+        {
+            auto declaration = clones.find(copy->supplemental.declaration);
+            if (declaration != clones.end())
+                copy->supplemental.declaration = declaration->second;
+        }
+    }
+
+    memo_replay_hooks(ctx, clones[me->tree]);
+
+    *success = true;
+    return me->end;
+}
+
+
+static void memo_reset(parser_context *ctx)
+{
+    for (auto &me: ctx->memo_table)
+        if (me.second.tree)
+            me.second.tree->memo = nullptr;
+
+    ctx->memo_table.clear();
+
+    // Parked trees' names have already been unregistered, and their memory
+    // belongs to the arena
+    ctx->parked_trees.clear();
 }
+#endif
 
 
 #include "parser-sv-handlers.cxx"
 
 
-syntax_tree_node *build_syntax_tree(const std::vector<token *> &token_list)
+/**
+ * Parses the declarations starting at b into the translation unit root (which
+ * may already have some, from a prefix), just as the declaration-seq of
+ * sv_translation_unit() would have had they all been parsed at once. Returns
+ * where the last one ends.
+ */
+static range_t continue_translation_unit(parser_context *ctx, syntax_tree_node *root, range_t b)
 {
-    maximum_extent = token_list.begin();
+    bool could_parse;
+    range_t m = b;
 
-    for (std::list<keyword_entry> *kwl: {&keywords, &typedef_names, &class_names, &template_names, &original_namespace_names})
+    if (root->children.empty())
+        m = sv_declaration_seq(ctx, root, m, &could_parse);
+    else
     {
-        for (const keyword_entry &kw: *kwl)
-            free(const_cast<char *>(kw.identifier));
+        syntax_tree_node *seq = root->children.front();
+
+        for (;;)
+        {
+            parse_mark lm = mark_parse(ctx);
+            range_t l = m;
+
+            m = sv_declaration(ctx, seq, m, &could_parse);
+            if (!could_parse)
+            {
+                m = l;
+                break;
+            }
 
-        kwl->clear();
+            if (m == l)
+            {
+                seq->children.pop_back();
+                rollback_parse(ctx, lm);
+                break;
+            }
+        }
     }
 
-    // new and delete are operators; false, nullptr and true are literals.
-    for (auto kw: { "alignas", "alignof", "asm", "auto", "bool", "break",
-                    "case", "catch", "char", "char16_t", "char32_t", "class",
-                    "const", "constexpr", "const_cast", "continue", "decltype",
-                    "default", "do", "double", "dynamic_cast", "else", "enum",
-                    "explicit", "export", "extern", "float", "for", "friend",
-                    "goto", "if", "inline", "int", "long", "mutable",
-                    "namespace", "noexcept", "operator", "private", "protected",
-                    "public", "register", "reinterpret_cast", "return", "short",
-                    "signed", "sizeof", "static", "static_assert",
-                    "static_cast", "struct", "switch", "template", "this",
-                    "thread_local", "throw", "try", "typedef", "typeid",
-                    "typename", "union", "unsigned", "using", "virtual", "void",
-                    "volatile", "wchar_t", "while" })
+    if (m > ctx->maximum_extent) ctx->maximum_extent = m;
+    return m;
+}
+
+
+/**
+ * Parses token_list, continuing after (and consuming) prefix_in if given. If
+ * prefix_out is given, the tree is left as it is and the parser's state is
+ * stored there.
+ */
+static syntax_tree_node *parse(token_stream &token_list, token_source *source, arena *nodes,
+                               parse_prefix *prefix_in, parse_prefix *prefix_out)
+{
+    parser_context context(&token_list, source, nodes);
+    parser_context *ctx = &context;
+
+#ifdef PARSER_PROFILE
+    for (unsigned rule = 0; rule < sizeof(rule_alternatives) / sizeof(rule_alternatives[0]); rule++)
     {
-        keywords.push_back({strdup(kw), nullptr, nullptr});
+        rule_profile rp = {static_cast<syntax_tree_node::sv_type>(rule), 0, 0, 0, 0, 0, 0, 0, 0, {}, {}};
+        rp.attempts.resize(rule_alternatives[rule]);
+        rp.matches.resize(rule_alternatives[rule]);
+        ctx->profile.push_back(rp);
     }
+#endif
 
-    while (!namespace_scope_stack.empty())
-        namespace_scope_stack.pop();
+    if (prefix_in)
+    {
+        for (const prefix_name &pn: prefix_in->names)
+            add_name(ctx, pn.name, pn.kinds, pn.declaration, pn.complete_declaration);
 
-    namespace_scope = nullptr;
+        ctx->maximum_extent = prefix_in->end;
+    }
+    else
+    {
+        // new and delete are operators; false, nullptr and true are literals.
+        for (auto kw: { "alignas", "alignof", "asm", "auto", "bool", "break",
+                        "case", "catch", "char", "char16_t", "char32_t", "class",
+                        "const", "constexpr", "const_cast", "continue", "decltype",
+                        "default", "do", "double", "dynamic_cast", "else", "enum",
+                        "explicit", "export", "extern", "float", "for", "friend",
+                        "goto", "if", "inline", "int", "long", "mutable",
+                        "namespace", "noexcept", "operator", "private", "protected",
+                        "public", "register", "reinterpret_cast", "return", "short",
+                        "signed", "sizeof", "static", "static_assert",
+                        "static_cast", "struct", "switch", "template", "this",
+                        "thread_local", "throw", "try", "typedef", "typeid",
+                        "typename", "union", "unsigned", "using", "virtual", "void",
+                        "volatile", "wchar_t", "while" })
+        {
+            add_name(ctx, intern(kw, strlen(kw)), name_entry::KEYWORD, nullptr, nullptr);
+        }
+    }
 
     syntax_tree_node *root = nullptr;
     try
     {
-        bool success;
-        root = sv_translation_unit(token_list.begin(), token_list.end(), &success);
-        root->contract();
-        root->fix_right_shifts();
+        bool success = true;
+        range_t end = 0;
+
+        if (prefix_in)
+        {
+            root = prefix_in->root;
+            end = continue_translation_unit(ctx, root, prefix_in->end);
+        }
+        else if (prefix_out)
+        {
+            root = new (nodes) syntax_tree_node(syntax_tree_node::TRANSLATION_UNIT);
+            end = continue_translation_unit(ctx, root, 0);
+        }
+        else
+            root = sv_translation_unit(ctx, 0, &success);
+
+#ifdef PACKRAT_PARSER
+        // Memoized subtrees must not be touched by contract()
+        memo_reset(ctx);
+#endif
 
-        if (!success || (maximum_extent != token_list.end()))
-            throw format("Could not match token %s", (*maximum_extent)->content);
+        if (!prefix_out)
+        {
+            root->contract();
+            root->fix_right_shifts(token_list);
+        }
+
+        if (!success || token_available(ctx, ctx->maximum_extent))
+        {
+            source_text spelling = token_list.spelling(ctx->maximum_extent);
+            throw format("Could not match token %.*s", static_cast<int>(spelling.length), spelling.start);
+        }
+
+        // The state in the middle of a declaration cannot be continued from
+        if (prefix_out && token_available(ctx, end))
+        {
+            ctx->maximum_extent = end;
+            source_text spelling = token_list.spelling(end);
+            throw format("Prefix ends within the declaration starting at %.*s", static_cast<int>(spelling.length), spelling.start);
+        }
+
+        if (prefix_out)
+        {
+            prefix_out->root = root;
+            prefix_out->end = end;
+            prefix_out->names.clear();
+
+            for (const name_entry *ne = ctx->oldest_name; ne; ne = ne->newer)
+                prefix_out->names.push_back({ne->name, ne->kinds, ne->declaration, ne->complete_declaration});
+        }
     }
     catch (char *msg)
     {
-        if (maximum_extent == token_list.end())
+        // Had the tokens been produced up front, an invalid one anywhere
+        // would have been reported instead
+        if (source)
+        {
+            try
+            {
+                source->drain();
+            }
+            catch (error *)
+            {
+                delete msg;
+                throw;
+            }
+        }
+
+        if (ctx->maximum_extent == token_list.size())
             throw new error(msg);
-        else
-            throw new error((*maximum_extent)->line, (*maximum_extent)->column, msg);
+
+        throw error_at(token_list, ctx->maximum_extent, msg);
     }
 
     return root;
 }
+
+
+syntax_tree_node *build_syntax_tree(token_stream &token_list, arena *nodes)
+{
+    return parse(token_list, nullptr, nodes, nullptr, nullptr);
+}
+
+
+syntax_tree_node *build_syntax_tree(token_source &source, arena *nodes)
+{
+    return parse(source.tokens, &source, nodes, nullptr, nullptr);
+}
+
+
+syntax_tree_node *build_syntax_tree(token_stream &token_list, arena *nodes, parse_prefix *prefix)
+{
+    return parse(token_list, nullptr, nodes, prefix, nullptr);
+}
+
+
+void build_prefix(token_stream &token_list, arena *nodes, parse_prefix *prefix)
+{
+    parse(token_list, nullptr, nodes, nullptr, prefix);
+}
+
+
+bool parser_profiling(void)
+{
+#ifdef PARSER_PROFILE
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+std::vector<rule_profile> parse_profile(void)
+{
+    std::vector<rule_profile> rules;
+
+#ifdef PARSER_PROFILE
+    std::lock_guard<std::mutex> guard(profile_lock);
+    for (const rule_profile &rp: profile_totals)
+        if (rp.entries)
+            rules.push_back(rp);
+#endif
+
+    return rules;
+}
@@ -0,0 +1,476 @@
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <sys/mman.h>
+#include <unordered_map>
+#include <vector>
+
+#include "ast_file.hpp"
+#include "prefix_file.hpp"
+
+
+static_assert(sizeof(prefix_file_header) == 176, "prefix_file_header layout changed");
+static_assert(sizeof(prefix_file_node) == 16, "prefix_file_node layout changed");
+static_assert(sizeof(prefix_file_name) == 16, "prefix_file_name layout changed");
+static_assert(sizeof(prefix_file_file) == 16, "prefix_file_file layout changed");
+static_assert(sizeof(int) == sizeof(int32_t), "line numbers are written as they are");
+
+// Number of node kinds (and of parser_type_names entries)
+static const uint32_t KIND_COUNT = syntax_tree_node::ORIGINAL_NAMESPACE_NAME + 1;
+
+static const char MAGIC[8] = "PEGIPFX";
+
+
+/**
+ * FNV-1a hash of the names of all node kinds: changes whenever the grammar
+ * the parser has been generated from does (in any way that matters here).
+ */
+static uint32_t grammar_hash(void)
+{
+    uint32_t h = 2166136261u;
+
+    for (uint32_t k = 0; k < KIND_COUNT; k++)
+        for (const char *c = parser_type_names[k]; ; c++)
+        {
+            h = (h ^ static_cast<uint8_t>(*c)) * 16777619u;
+            if (!*c)
+                break;
+        }
+
+    return h;
+}
+
+
+static bool has_declaration(syntax_tree_node::sv_type type)
+{
+    switch (type)
+    {
+        case syntax_tree_node::TYPEDEF_NAME:
+        case syntax_tree_node::CLASS_NAME:
+        case syntax_tree_node::TEMPLATE_NAME:
+        case syntax_tree_node::ORIGINAL_NAMESPACE_NAME:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+
+struct prefix_numbering
+{
+    std::vector<prefix_file_node> nodes;
+    // Tree node of every entry in nodes
+    std::vector<const syntax_tree_node *> order;
+    std::unordered_map<const syntax_tree_node *, uint32_t> index;
+
+    uint32_t find(const syntax_tree_node *node) const
+    {
+        auto i = index.find(node);
+        return (i != index.end()) ? i->second : PREFIX_NONE;
+    }
+};
+
+
+// Stores node and everything below it in depth-first order
+static void number_nodes(const syntax_tree_node *node, uint32_t parent, prefix_numbering *pn)
+{
+    uint32_t i = pn->nodes.size();
+
+    pn->nodes.push_back({static_cast<uint16_t>(node->type), node->intermediate, parent, node->ass_token, PREFIX_NONE});
+    pn->order.push_back(node);
+    pn->index.emplace(node, i);
+
+    for (const syntax_tree_node *c: node->children)
+        number_nodes(c, i, pn);
+}
+
+
+// Atoms used by a prefix, numbered in order of their first use
+struct atom_numbering
+{
+    std::vector<uint32_t> local;
+    std::vector<uint32_t> table;
+    std::string *strings;
+
+    uint32_t find(atom_t a)
+    {
+        if (a >= local.size())
+            local.resize(atom_count(), PREFIX_NONE);
+
+        if (local[a] == PREFIX_NONE)
+        {
+            local[a] = table.size();
+            table.push_back(strings->length());
+
+            const char *spelling = atom_spelling(a);
+            strings->append(spelling, strlen(spelling) + 1);
+        }
+
+        return local[a];
+    }
+};
+
+
+bool write_prefix_file(int fd, const char *name, const token_stream &tokens, const parse_prefix &prefix,
+                       const std::string &definitions)
+{
+    prefix_numbering pn;
+    number_nodes(prefix.root, PREFIX_NONE, &pn);
+
+    for (size_t i = 0; i < pn.nodes.size(); i++)
+        if (has_declaration(pn.order[i]->type) && pn.order[i]->supplemental.declaration)
+            pn.nodes[i].declaration = pn.find(pn.order[i]->supplemental.declaration);
+
+    std::string strings;
+    atom_numbering an;
+    an.strings = &strings;
+
+    // Names declared by nodes which are not part of the tree anymore cannot
+    // be seen from anywhere after the prefix
+    std::vector<prefix_file_name> names;
+    for (const prefix_name &n: prefix.names)
+    {
+        uint32_t decl = n.declaration ? pn.find(n.declaration) : PREFIX_NONE;
+        uint32_t complete = n.complete_declaration ? pn.find(n.complete_declaration) : PREFIX_NONE;
+
+        if ((n.declaration && (decl == PREFIX_NONE)) || (n.complete_declaration && (complete == PREFIX_NONE)))
+            continue;
+
+        names.push_back({an.find(n.name), n.kinds, decl, complete});
+    }
+
+    std::vector<uint32_t> token_atoms(prefix.end);
+    for (token_index i = 0; i < prefix.end; i++)
+    {
+        atom_t a = tokens.atom(i);
+
+        if (a == ATOM_NONE)
+            token_atoms[i] = PREFIX_NONE;
+        else if ((tokens.type(i) == token::LIT_INTEGER) || (tokens.type(i) == token::LIT_FLOAT))
+            token_atoms[i] = a;
+        else
+            token_atoms[i] = an.find(a);
+    }
+
+    std::vector<uint8_t> float_types;
+    for (const lit_float &lf: tokens.floats)
+        float_types.push_back(lf.subtype);
+
+    std::vector<prefix_file_file> files;
+    auto add_file = [&](uint32_t offset, uint32_t text_offset, const char *file_name) {
+        files.push_back({offset, text_offset, static_cast<uint32_t>(strings.length()), 0});
+        strings.append(file_name, strlen(file_name) + 1);
+    };
+
+    if (tokens.files.empty())
+        add_file(0, 0, name);
+    for (const token_file &tf: tokens.files)
+        add_file(tf.offset, tf.text_offset, tf.name);
+
+    size_t source_length = strlen(tokens.source);
+
+    prefix_file_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = PREFIX_FILE_VERSION;
+    header.grammar = grammar_hash();
+    header.node_count = pn.nodes.size();
+    header.name_count = names.size();
+    header.atom_count = an.table.size();
+    header.token_count = prefix.end;
+    header.integer_count = tokens.integers.size();
+    header.float_count = float_types.size();
+    header.line_count = tokens.line_numbers.size();
+    header.file_count = files.size();
+    header.source_length = source_length;
+    header.definitions_length = definitions.length();
+
+    const file_section sections[] = {
+        {&header, sizeof(header), nullptr},
+        {pn.nodes.data(), pn.nodes.size() * sizeof(prefix_file_node), &header.nodes_offset},
+        {names.data(), names.size() * sizeof(prefix_file_name), &header.names_offset},
+        {an.table.data(), an.table.size() * sizeof(uint32_t), &header.atoms_offset},
+        {tokens.types.data(), prefix.end, &header.types_offset},
+        {token_atoms.data(), prefix.end * sizeof(uint32_t), &header.token_atoms_offset},
+        {tokens.offsets.data(), prefix.end * sizeof(uint32_t), &header.token_offsets_offset},
+        {tokens.lengths.data(), prefix.end * sizeof(uint32_t), &header.token_lengths_offset},
+        {float_types.data(), float_types.size(), &header.float_types_offset},
+        {tokens.line_numbers.data(), tokens.line_numbers.size() * sizeof(int32_t), &header.line_numbers_offset},
+        {tokens.line_offsets.data(), tokens.line_offsets.size() * sizeof(uint32_t), &header.line_offsets_offset},
+        {files.data(), files.size() * sizeof(prefix_file_file), &header.files_offset},
+        {strings.data(), strings.length(), &header.strings_offset},
+        {tokens.source, source_length + 1, &header.source_offset},
+        {definitions.c_str(), definitions.length() + 1, &header.definitions_offset},
+    };
+
+    return write_sections(fd, sections, sizeof(sections) / sizeof(sections[0]));
+}
+
+
+prefix_file::~prefix_file(void)
+{
+    release();
+}
+
+
+void prefix_file::release(void)
+{
+    if (data)
+        munmap(const_cast<char *>(data), size);
+
+    data = nullptr;
+    size = 0;
+    atoms.clear();
+}
+
+
+/**
+ * Checks that the header is ours and all sections lie within the file, and
+ * that everything refers to something that exists (so that start_unit() can
+ * take the contents as they are).
+ */
+bool prefix_file::valid(void) const
+{
+    if (size < sizeof(prefix_file_header))
+        return false;
+
+    const prefix_file_header &h = header();
+    if (memcmp(h.magic, MAGIC, sizeof(MAGIC)) || (h.version != PREFIX_FILE_VERSION) || (h.grammar != grammar_hash()))
+        return false;
+
+    auto fits = [this](uint64_t offset, uint64_t count, uint64_t element) {
+        return !(offset % 8) && (offset <= size) && (count <= (size - offset) / element);
+    };
+
+    if (!fits(h.nodes_offset, h.node_count, sizeof(prefix_file_node)) ||
+        !fits(h.names_offset, h.name_count, sizeof(prefix_file_name)) ||
+        !fits(h.atoms_offset, h.atom_count, sizeof(uint32_t)) ||
+        !fits(h.types_offset, h.token_count, 1) ||
+        !fits(h.token_atoms_offset, h.token_count, sizeof(uint32_t)) ||
+        !fits(h.token_offsets_offset, h.token_count, sizeof(uint32_t)) ||
+        !fits(h.token_lengths_offset, h.token_count, sizeof(uint32_t)) ||
+        !fits(h.float_types_offset, h.float_count, 1) ||
+        !fits(h.line_numbers_offset, h.line_count, sizeof(int32_t)) ||
+        !fits(h.line_offsets_offset, h.line_count, sizeof(uint32_t)) ||
+        !fits(h.files_offset, h.file_count, sizeof(prefix_file_file)) ||
+        !fits(h.source_offset, h.source_length + 1, 1) ||
+        !fits(h.definitions_offset, h.definitions_length + 1, 1) ||
+        (h.strings_offset > h.source_offset) || !h.node_count || !h.file_count ||
+        source()[h.source_length] || definitions()[h.definitions_length])
+    {
+        return false;
+    }
+
+    // Strings must be null-terminated within the string section
+    const char *strings = section<char>(h.strings_offset);
+    size_t strings_length = h.source_offset - h.strings_offset;
+    auto is_string = [&](uint32_t offset) {
+        return (offset < strings_length) && memchr(strings + offset, 0, strings_length - offset);
+    };
+
+    const uint32_t *atom_table = section<uint32_t>(h.atoms_offset);
+    for (uint32_t i = 0; i < h.atom_count; i++)
+        if (!is_string(atom_table[i]))
+            return false;
+
+    // The file table covers all of the source, in order
+    const prefix_file_file *files = section<prefix_file_file>(h.files_offset);
+    if (files[0].offset)
+        return false;
+
+    for (uint32_t i = 0; i < h.file_count; i++)
+    {
+        if (!is_string(files[i].name) || (files[i].offset > h.source_length) || (files[i].text_offset > h.source_length) ||
+            (i && (files[i].offset < files[i - 1].offset)))
+        {
+            return false;
+        }
+    }
+
+    const uint8_t *types = section<uint8_t>(h.types_offset);
+    const uint32_t *token_atoms = section<uint32_t>(h.token_atoms_offset);
+    const uint32_t *offsets = section<uint32_t>(h.token_offsets_offset);
+    const uint32_t *lengths = section<uint32_t>(h.token_lengths_offset);
+
+    for (uint32_t i = 0; i < h.token_count; i++)
+    {
+        uint32_t a = token_atoms[i];
+
+        if ((types[i] > token::OPERATOR) || (offsets[i] > h.source_length) || (lengths[i] > h.source_length - offsets[i]))
+            return false;
+
+        if (a == PREFIX_NONE)
+            continue;
+        else if (types[i] == token::LIT_INTEGER)
+        {
+            if ((a & ~token_stream::LITERAL_VALUE) >= h.integer_count)
+                return false;
+        }
+        else if (types[i] == token::LIT_FLOAT)
+        {
+            if ((a & ~token_stream::LITERAL_VALUE) >= h.float_count)
+                return false;
+        }
+        else if (a >= h.atom_count)
+            return false;
+    }
+
+    const prefix_file_node *nodes = section<prefix_file_node>(h.nodes_offset);
+    for (uint32_t i = 0; i < h.node_count; i++)
+    {
+        if ((nodes[i].kind >= KIND_COUNT) || (i ? (nodes[i].parent >= i) : (nodes[i].parent != PREFIX_NONE)) ||
+            ((nodes[i].token != PREFIX_NONE) && (nodes[i].token >= h.token_count)) ||
+            ((nodes[i].declaration != PREFIX_NONE) && (nodes[i].declaration >= h.node_count)))
+        {
+            return false;
+        }
+    }
+
+    const prefix_file_name *names = section<prefix_file_name>(h.names_offset);
+    for (uint32_t i = 0; i < h.name_count; i++)
+    {
+        if ((names[i].atom >= h.atom_count) ||
+            ((names[i].declaration != PREFIX_NONE) && (names[i].declaration >= h.node_count)) ||
+            ((names[i].complete_declaration != PREFIX_NONE) && (names[i].complete_declaration >= h.node_count)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+bool prefix_file::load(const char *path)
+{
+    release();
+
+    data = map_file(path, &size);
+    if (!data)
+        return false;
+
+    if (!valid())
+    {
+        release();
+        errno = EINVAL;
+        return false;
+    }
+
+    // Every spelling is only interned once, however many units use it
+    const uint32_t *atom_table = section<uint32_t>(header().atoms_offset);
+    for (uint32_t i = 0; i < header().atom_count; i++)
+    {
+        const char *spelling = string(atom_table[i]);
+        atoms.push_back(intern(spelling, strlen(spelling)));
+    }
+
+    return true;
+}
+
+
+void prefix_file::start_unit(const char *name, const token_stream &tokens, arena *node_arena, prefixed_unit *unit) const
+{
+    const prefix_file_header &h = header();
+
+    // The unit's text follows the prefix's on a line of its own
+    uint32_t base = h.source_length + 1;
+    size_t length = strlen(tokens.source);
+
+    unit->text.resize(base + length + 1);
+    memcpy(unit->text.data(), source(), h.source_length);
+    unit->text[h.source_length] = '\n';
+    memcpy(unit->text.data() + base, tokens.source, length + 1);
+
+    token_stream &ts = unit->tokens;
+    ts = token_stream(unit->text.data());
+
+    const uint8_t *types = section<uint8_t>(h.types_offset);
+    const uint32_t *token_atoms = section<uint32_t>(h.token_atoms_offset);
+    const uint32_t *offsets = section<uint32_t>(h.token_offsets_offset);
+    const uint32_t *lengths = section<uint32_t>(h.token_lengths_offset);
+    const uint8_t *float_types = section<uint8_t>(h.float_types_offset);
+    const int32_t *line_numbers = section<int32_t>(h.line_numbers_offset);
+    const uint32_t *line_offsets = section<uint32_t>(h.line_offsets_offset);
+    const prefix_file_file *files = section<prefix_file_file>(h.files_offset);
+
+    size_t count = h.token_count + tokens.size();
+    ts.types.reserve(count);
+    ts.atoms.reserve(count);
+    ts.offsets.reserve(count);
+    ts.lengths.reserve(count);
+
+    ts.types.assign(types, types + h.token_count);
+    ts.offsets.assign(offsets, offsets + h.token_count);
+    ts.lengths.assign(lengths, lengths + h.token_count);
+    for (uint32_t i = 0; i < h.token_count; i++)
+    {
+        uint32_t a = token_atoms[i];
+
+        if (a == PREFIX_NONE)
+            ts.atoms.push_back(ATOM_NONE);
+        else if ((types[i] == token::LIT_INTEGER) || (types[i] == token::LIT_FLOAT))
+            ts.atoms.push_back(a);
+        else
+            ts.atoms.push_back(atoms[a]);
+    }
+
+    ts.types.insert(ts.types.end(), tokens.types.begin(), tokens.types.end());
+    ts.lengths.insert(ts.lengths.end(), tokens.lengths.begin(), tokens.lengths.end());
+    for (token_index i = 0; i < tokens.size(); i++)
+    {
+        atom_t a = tokens.atom(i);
+        if (tokens.type(i) == token::LIT_INTEGER)
+            a += h.integer_count;
+        else if (tokens.type(i) == token::LIT_FLOAT)
+            a += h.float_count;
+
+        ts.atoms.push_back(a);
+        ts.offsets.push_back(tokens.offsets[i] + base);
+    }
+
+    ts.integers.resize(h.integer_count);
+    ts.integers.insert(ts.integers.end(), tokens.integers.begin(), tokens.integers.end());
+    for (uint32_t i = 0; i < h.float_count; i++)
+        ts.floats.push_back(lit_float(static_cast<lit_float::float_type>(float_types[i])));
+    ts.floats.insert(ts.floats.end(), tokens.floats.begin(), tokens.floats.end());
+
+    ts.line_numbers.assign(line_numbers, line_numbers + h.line_count);
+    ts.line_offsets.assign(line_offsets, line_offsets + h.line_count);
+    ts.line_numbers.insert(ts.line_numbers.end(), tokens.line_numbers.begin(), tokens.line_numbers.end());
+    for (uint32_t lo: tokens.line_offsets)
+        ts.line_offsets.push_back(lo + base);
+
+    for (uint32_t i = 0; i < h.file_count; i++)
+        ts.files.push_back({files[i].offset, files[i].text_offset, string(files[i].name)});
+    if (tokens.files.empty())
+        ts.files.push_back({base, base, name});
+    for (const token_file &tf: tokens.files)
+        ts.files.push_back({tf.offset + base, tf.text_offset + base, tf.name});
+
+    // Parents come before their children, and siblings in order
+    const prefix_file_node *nodes = section<prefix_file_node>(h.nodes_offset);
+    std::vector<syntax_tree_node *> made(h.node_count);
+
+    for (uint32_t i = 0; i < h.node_count; i++)
+    {
+        syntax_tree_node *parent = (nodes[i].parent != PREFIX_NONE) ? made[nodes[i].parent] : nullptr;
+        made[i] = new (node_arena) syntax_tree_node(static_cast<syntax_tree_node::sv_type>(nodes[i].kind), parent,
+                                                    nodes[i].intermediate);
+        made[i]->ass_token = (nodes[i].token != PREFIX_NONE) ? nodes[i].token : NO_TOKEN;
+    }
+
+    for (uint32_t i = 0; i < h.node_count; i++)
+        if (nodes[i].declaration != PREFIX_NONE)
+            made[i]->supplemental.declaration = made[nodes[i].declaration];
+
+    const prefix_file_name *names = section<prefix_file_name>(h.names_offset);
+    auto node = [&made](uint32_t n) { return (n != PREFIX_NONE) ? made[n] : nullptr; };
+
+    unit->prefix.root = made[0];
+    unit->prefix.end = h.token_count;
+    unit->prefix.names.clear();
+    for (uint32_t i = 0; i < h.name_count; i++)
+        unit->prefix.names.push_back({atoms[names[i].atom], names[i].kinds, node(names[i].declaration),
+                                      node(names[i].complete_declaration)});
+}
@@ -0,0 +1,1751 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <set>
+#include <string>
+#include <sys/stat.h>
+#include <utility>
+#include <vector>
+
+#include "arena.hpp"
+#include "format.hpp"
+#include "preprocess.hpp"
+
+
+// Anything nested deeper is taken to be an include cycle
+static const size_t MAX_INCLUDE_DEPTH = 200;
+
+// Predefined macros (apart from __FILE__, __LINE__, __DATE__ and __TIME__)
+static const char BUILTIN_DEFINITIONS[] =
+    "#define __cplusplus 201103L\n"
+    "#define __STDC__ 1\n"
+    "#define __STDC_HOSTED__ 1\n";
+
+
+pp_file::pp_file(void):
+    text(""), length(0), tokens(nullptr), guard(ATOM_NONE), device(0), inode(0), size(0), modified{0, 0},
+    site(nullptr), site_line(0)
+{}
+
+
+/**
+ * Finds the macro guarding all of the given file, as in
+ *     #ifndef X (or #if !defined X)
+ *     ...
+ *     #endif
+ * with no tokens outside; returns ATOM_NONE if there is none.
+ */
+static atom_t find_guard(const std::vector<directive_range> &directives, const token_stream &tokens)
+{
+    if ((directives.size() < 2) || directives.front().start || (directives.back().end != tokens.size()))
+        return ATOM_NONE;
+
+    auto is = [&](token_index i, token::token_type type, atom_t a) { return (tokens.type(i) == type) && (tokens.atom(i) == a); };
+
+    const directive_range &d = directives.front();
+    token_index s = d.start, length = d.end - d.start;
+    atom_t guard;
+
+    if ((length == 3) && is(s + 1, token::IDENTIFIER, ATOM_IFNDEF) && (tokens.type(s + 2) == token::IDENTIFIER))
+        guard = tokens.atom(s + 2);
+    else if ((length == 5 || length == 7) && is(s + 1, token::IDENTIFIER, ATOM_IF) && is(s + 2, token::OPERATOR, ATOM_EXCLAIM) &&
+             is(s + 3, token::IDENTIFIER, ATOM_DEFINED))
+    {
+        token_index name = (length == 5) ? s + 4 : s + 5;
+        if ((tokens.type(name) != token::IDENTIFIER) ||
+            ((length == 7) && (!is(s + 4, token::OPERATOR, ATOM_LPAREN) || !is(s + 6, token::OPERATOR, ATOM_RPAREN))))
+        {
+            return ATOM_NONE;
+        }
+        guard = tokens.atom(name);
+    }
+    else
+        return ATOM_NONE;
+
+    // The last directive has to be the #endif closing the first one, with
+    // no #else in between
+    int depth = 0;
+    for (size_t i = 0; i < directives.size(); i++)
+    {
+        token_index name = directives[i].start + 1;
+        if ((name == directives[i].end) || (tokens.type(name) != token::IDENTIFIER))
+            continue;
+
+        switch (tokens.atom(name))
+        {
+            case ATOM_IF:
+            case ATOM_IFDEF:
+            case ATOM_IFNDEF:
+                depth++;
+                break;
+
+            case ATOM_ELIF:
+            case ATOM_ELSE:
+                if (depth == 1)
+                    return ATOM_NONE;
+                break;
+
+            case ATOM_ENDIF:
+                if (!--depth)
+                    return (i + 1 == directives.size()) ? guard : ATOM_NONE;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    return ATOM_NONE;
+}
+
+
+void pp_file::tokenize(void)
+{
+    tokens = tokenize_directives(text, &directives, &failures);
+    guard = find_guard(directives, tokens);
+}
+
+
+error *pp_file::failure(size_t i) const
+{
+    const tokenize_failure &tf = failures[i];
+    error *err = new error(tf.line, tf.column, format("%s", tf.message.c_str()));
+    err->file = name.c_str();
+    err->text = text;
+    return err;
+}
+
+
+static bool is_current(const pp_file *f, const struct stat &st)
+{
+    return (f->device == st.st_dev) && (f->inode == st.st_ino) && (f->size == st.st_size) &&
+           (f->modified.tv_sec == st.st_mtim.tv_sec) && (f->modified.tv_nsec == st.st_mtim.tv_nsec);
+}
+
+
+std::shared_ptr<const pp_file> include_cache::get(const std::string &path, const struct stat &st)
+{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        auto f = files.find(path);
+        if ((f != files.end()) && is_current(f->second.get(), st))
+        {
+            hits++;
+            return f->second;
+        }
+    }
+
+    // Read without holding the lock; should two threads both miss, the
+    // second one's copy simply replaces the first one's
+    std::shared_ptr<pp_file> file = std::make_shared<pp_file>();
+    if (!file->contents.load(path.c_str()))
+        return nullptr;
+
+    file->name = path;
+    file->text = file->contents.text();
+    file->length = file->contents.length();
+    file->device = st.st_dev;
+    file->inode = st.st_ino;
+    file->size = st.st_size;
+    file->modified = st.st_mtim;
+    file->tokenize();
+
+    misses++;
+
+    std::lock_guard<std::mutex> guard(lock);
+    files[path] = file;
+    return file;
+}
+
+
+// Names of the macros a token must not be expanded as anymore (because it
+// comes from their expansion), as a list
+struct hideset
+{
+    atom_t name;
+    const hideset *next;
+};
+
+
+// A token of one of the files the preprocessor works on
+struct pp_token
+{
+    // nullptr for the placemarkers standing in for empty macro arguments
+    const pp_file *file;
+    token_index index;
+    const hideset *hidden;
+};
+
+
+struct macro
+{
+    enum macro_kind
+    {
+        OBJECT_LIKE,
+        FUNCTION_LIKE,
+        FILE_NAME,
+        LINE_NUMBER,
+        DATE,
+        TIME
+    } kind;
+
+    // __VA_ARGS__ is the last parameter of variadic macros
+    bool variadic;
+    std::vector<atom_t> parameters;
+
+    std::vector<pp_token> body;
+    // Parameter every token of the body is (-1 for none)
+    std::vector<int> body_parameters;
+};
+
+
+struct conditional
+{
+    // Whether the current group is processed, whether a group has been
+    // already (or none will be, as the enclosing one is skipped) and whether
+    // #else has been seen
+    bool active, taken, seen_else;
+    // The #if, for errors
+    pp_token start;
+};
+
+
+struct include_frame
+{
+    const pp_file *file;
+    token_index position;
+    // Next directive of the file, and next of its failures not passed yet
+    size_t next_directive, next_failure;
+    // Number of conditionals open when the file was entered
+    size_t conditionals;
+};
+
+
+// Tokens to process: the pending ones (last to first), followed by those of
+// the files being processed if from_files is set
+struct pp_input
+{
+    std::vector<pp_token> pending;
+    bool from_files;
+};
+
+
+struct pp_state
+{
+    include_cache *cache;
+    const pp_options *options;
+    token_stream *out;
+    std::vector<std::unique_ptr<error>> *warnings;
+
+    // The output's source buffer, where every file has been copied to in
+    // there, and the last file copied
+    std::vector<char> text;
+    std::unordered_map<const pp_file *, uint32_t> copies;
+    const pp_file *last_copied;
+    uint32_t last_copy;
+
+    // Every file used (including the spellings created), to keep them alive
+    // as long as the output
+    std::vector<std::shared_ptr<const pp_file>> used;
+    // "0 1", to replace defined with
+    const pp_file *numbers;
+
+    // Indexed by atom
+    std::vector<std::unique_ptr<macro>> macros;
+
+    std::vector<include_frame> frames;
+    std::vector<conditional> conditionals;
+    std::set<std::pair<dev_t, ino_t>> once;
+
+    // The file every #include has found so far, by the directory it was
+    // looked for first and its name ("<name" for <...>)
+    std::unordered_map<std::string, const pp_file *> resolved;
+
+    pp_input input;
+    arena hidesets;
+
+    // The last token taken from a file (spellings created belong to its
+    // line), and the token errors are reported at
+    pp_token last, where;
+
+    std::string date, time;
+
+
+    pp_state(include_cache *c, const pp_options *o, token_stream *t, std::vector<std::unique_ptr<error>> *w):
+        cache(c), options(o), out(t), warnings(w), last_copied(nullptr), last_copy(0), numbers(nullptr),
+        hidesets(4096), last{nullptr, 0, nullptr}, where{nullptr, 0, nullptr}
+    {
+        input.from_files = true;
+    }
+};
+
+
+static inline token::token_type type_of(const pp_token &t)
+{
+    return t.file->tokens.type(t.index);
+}
+
+static inline atom_t atom_of(const pp_token &t)
+{
+    return t.file->tokens.atom(t.index);
+}
+
+static inline source_text spelling_of(const pp_token &t)
+{
+    return t.file->tokens.spelling(t.index);
+}
+
+static inline bool is_operator(const pp_token &t, atom_t a)
+{
+    return t.file && (type_of(t) == token::OPERATOR) && (atom_of(t) == a);
+}
+
+static inline bool is_hash(const pp_token &t)
+{
+    return is_operator(t, ATOM_HASH) || is_operator(t, ATOM_DIGRAPH_HASH);
+}
+
+static inline bool is_hash_hash(const pp_token &t)
+{
+    return is_operator(t, ATOM_HASH_HASH) || is_operator(t, ATOM_DIGRAPH_HASH_HASH);
+}
+
+
+/**
+ * Whether there is whitespace between token i of tokens and the one before
+ * it (or the start of the text).
+ */
+static bool space_before(const token_stream &tokens, token_index i)
+{
+    return tokens.offsets[i] != (i ? tokens.offsets[i - 1] + tokens.lengths[i - 1] : 0);
+}
+
+
+static bool is_hidden(const hideset *hs, atom_t name)
+{
+    for (; hs; hs = hs->next)
+        if (hs->name == name)
+            return true;
+    return false;
+}
+
+
+static const hideset *hide(pp_state *st, const hideset *hs, atom_t name)
+{
+    if (is_hidden(hs, name))
+        return hs;
+
+    hideset *n = static_cast<hideset *>(st->hidesets.alloc(sizeof(hideset), alignof(hideset)));
+    n->name = name;
+    n->next = hs;
+    return n;
+}
+
+
+static const hideset *unite(pp_state *st, const hideset *a, const hideset *b)
+{
+    for (; a; a = a->next)
+        b = hide(st, b, a->name);
+    return b;
+}
+
+
+static const hideset *intersect(pp_state *st, const hideset *a, const hideset *b)
+{
+    const hideset *result = nullptr;
+    for (; a; a = a->next)
+        if (is_hidden(b, a->name))
+            result = hide(st, result, a->name);
+    return result;
+}
+
+
+/**
+ * Creates a file for a spelling made up during macro expansion, belonging to
+ * the line of the last token taken from a file.
+ */
+static const pp_file *make_spelling(pp_state *st, const std::string &spelling)
+{
+    std::shared_ptr<pp_file> f = std::make_shared<pp_file>();
+    f->buffer = spelling;
+    f->text = f->buffer.c_str();
+    f->length = f->buffer.length();
+
+    if (st->last.file)
+    {
+        f->site = st->last.file;
+        f->site_line = st->last.file->tokens.line(st->last.index);
+        f->name = f->site->name;
+    }
+
+    f->tokenize();
+    st->used.push_back(f);
+
+    if (!f->failures.empty())
+        throw format("Invalid token %s created during macro expansion", spelling.c_str());
+    return f.get();
+}
+
+
+/**
+ * Returns where the text of f starts in the output's source buffer, copying it
+ * there (and its line table and file entry to the output) first if needed.
+ */
+static uint32_t copy_of(pp_state *st, const pp_file *f)
+{
+    if (f == st->last_copied)
+        return st->last_copy;
+
+    auto c = st->copies.find(f);
+    if (c != st->copies.end())
+    {
+        st->last_copied = f;
+        st->last_copy = c->second;
+        return c->second;
+    }
+
+    // Spellings made up belong to their site
+    uint32_t site_base = f->site ? copy_of(st, f->site) : 0;
+
+    // Separated from what comes before, so tokens never look adjacent across
+    // files
+    if (!st->text.empty())
+        st->text.push_back('\n');
+
+    uint32_t base = st->text.size();
+    st->text.insert(st->text.end(), f->text, f->text + f->length);
+
+    token_stream *out = st->out;
+    if (f->site)
+    {
+        out->line_numbers.push_back(f->site_line);
+        out->line_offsets.push_back(base);
+        out->files.push_back({base, site_base, f->site->name.c_str()});
+    }
+    else
+    {
+        for (size_t l = 0; l < f->tokens.line_numbers.size(); l++)
+        {
+            out->line_numbers.push_back(f->tokens.line_numbers[l]);
+            out->line_offsets.push_back(base + f->tokens.line_offsets[l]);
+        }
+        out->files.push_back({base, base, f->name.c_str()});
+    }
+
+    st->copies.emplace(f, base);
+    st->last_copied = f;
+    st->last_copy = base;
+    return base;
+}
+
+
+static void emit(pp_state *st, const pp_token &t)
+{
+    const token_stream &in = t.file->tokens;
+    token_stream *out = st->out;
+    uint32_t base = copy_of(st, t.file);
+
+    atom_t atom = in.atoms[t.index];
+    // Literal values are copied undecoded (the file's own ones are never
+    // touched, as other threads may share them)
+    if (in.type(t.index) == token::LIT_INTEGER)
+    {
+        atom = out->integers.size() | token_stream::LITERAL_VALUE;
+        out->integers.push_back(in.integers[in.atoms[t.index] & ~token_stream::LITERAL_VALUE]);
+    }
+    else if (in.type(t.index) == token::LIT_FLOAT)
+    {
+        atom = out->floats.size() | token_stream::LITERAL_VALUE;
+        out->floats.push_back(in.floats[in.atoms[t.index] & ~token_stream::LITERAL_VALUE]);
+    }
+
+    out->types.push_back(in.types[t.index]);
+    out->atoms.push_back(atom);
+    out->offsets.push_back(base + in.offsets[t.index]);
+    out->lengths.push_back(in.lengths[t.index]);
+}
+
+
+static void enter_file(pp_state *st, const pp_file *f)
+{
+    if (st->frames.size() >= MAX_INCLUDE_DEPTH)
+        throw format("#include nested too deeply");
+
+    st->frames.push_back({f, 0, 0, 0, st->conditionals.size()});
+}
+
+
+static void leave_file(pp_state *st)
+{
+    if (st->conditionals.size() > st->frames.back().conditionals)
+    {
+        st->where = st->conditionals.back().start;
+        throw format("Unterminated conditional directive");
+    }
+
+    st->frames.pop_back();
+}
+
+
+static bool is_active(const pp_state *st)
+{
+    return st->conditionals.empty() || st->conditionals.back().active;
+}
+
+
+static void directive(pp_state *st, const pp_file *file, const directive_range &d, bool in_arguments);
+
+/**
+ * Takes the next token from the input, carrying out the directives of the
+ * files on the way. Returns false once there are no tokens left; in macro
+ * arguments, the end of a file is the end of the input.
+ */
+static bool next_token(pp_state *st, pp_input *in, pp_token *t, bool in_arguments)
+{
+    if (!in->pending.empty())
+    {
+        *t = in->pending.back();
+        in->pending.pop_back();
+        return true;
+    }
+
+    if (!in->from_files)
+        return false;
+
+    while (!st->frames.empty())
+    {
+        include_frame &f = st->frames.back();
+        const pp_file *file = f.file;
+
+        // Text that could not be tokenized only fails where it is not skipped
+        // (failures in directives are up to directive())
+        while ((f.next_failure < file->failures.size()) && (file->failures[f.next_failure].at <= f.position))
+        {
+            const tokenize_failure &tf = file->failures[f.next_failure];
+            if ((tf.at == f.position) && !tf.in_directive && is_active(st))
+                throw file->failure(f.next_failure);
+            f.next_failure++;
+        }
+
+        if ((f.next_directive < file->directives.size()) && (f.position == file->directives[f.next_directive].start))
+        {
+            const directive_range &d = file->directives[f.next_directive++];
+            f.position = d.end;
+            // May enter another file (invalidating f)
+            directive(st, file, d, in_arguments);
+            continue;
+        }
+
+        if (f.position >= file->tokens.size())
+        {
+            if (in_arguments)
+                return false;
+
+            leave_file(st);
+            continue;
+        }
+
+        if (!is_active(st))
+        {
+            // Skip to the next directive
+            f.position = (f.next_directive < file->directives.size()) ? file->directives[f.next_directive].start : file->tokens.size();
+            continue;
+        }
+
+        *t = {file, f.position++, nullptr};
+        st->last = *t;
+        return true;
+    }
+
+    return false;
+}
+
+
+/**
+ * Whether the next token is a (, without taking it.
+ */
+static bool next_is_lparen(pp_state *st, const pp_input *in)
+{
+    if (!in->pending.empty())
+        return is_operator(in->pending.back(), ATOM_LPAREN);
+
+    if (!in->from_files)
+        return false;
+
+    // Directives and the ends of files are not looked past
+    if (st->frames.empty())
+        return false;
+
+    const include_frame &f = st->frames.back();
+    const pp_file *file = f.file;
+    if ((f.position >= file->tokens.size()) ||
+        ((f.next_directive < file->directives.size()) && (f.position == file->directives[f.next_directive].start)))
+    {
+        return false;
+    }
+
+    return is_operator({file, f.position, nullptr}, ATOM_LPAREN);
+}
+
+
+static bool expand(pp_state *st, pp_input *in, const pp_token &t);
+
+/**
+ * Fully macro-expands a list of tokens on its own.
+ */
+static std::vector<pp_token> expand_list(pp_state *st, const std::vector<pp_token> &list)
+{
+    pp_input in;
+    in.pending.assign(list.rbegin(), list.rend());
+    in.from_files = false;
+
+    std::vector<pp_token> result;
+    pp_token t;
+    while (next_token(st, &in, &t, false))
+        if (!expand(st, &in, t))
+            result.push_back(t);
+
+    return result;
+}
+
+
+/**
+ * Reads the arguments of an invocation of m (the ( being next) into *args;
+ * returns the closing ).
+ */
+static pp_token read_arguments(pp_state *st, pp_input *in, const macro *m, atom_t name, std::vector<std::vector<pp_token>> *args)
+{
+    pp_token t;
+    next_token(st, in, &t, true);
+
+    args->emplace_back();
+    int depth = 0;
+
+    for (;;)
+    {
+        if (!next_token(st, in, &t, true))
+            throw format("Unterminated argument list invoking macro %s", atom_spelling(name));
+
+        if (t.file && (type_of(t) == token::OPERATOR))
+        {
+            atom_t a = atom_of(t);
+
+            if (a == ATOM_LPAREN)
+                depth++;
+            else if (a == ATOM_RPAREN)
+            {
+                if (!depth)
+                    break;
+                depth--;
+            }
+            // The variadic argument takes all remaining commas
+            else if ((a == ATOM_COMMA) && !depth && !(m->variadic && (args->size() == m->parameters.size())))
+            {
+                args->emplace_back();
+                continue;
+            }
+        }
+
+        args->back().push_back(t);
+    }
+
+    size_t expected = m->parameters.size();
+
+    // f() passes a single empty argument, which is none for a macro without
+    // parameters
+    if (!expected && (args->size() == 1) && args->front().empty())
+        args->clear();
+    // The variadic argument may be left out completely
+    if (m->variadic && (args->size() == expected - 1))
+        args->emplace_back();
+
+    if (args->size() != expected)
+        throw format("Macro %s expects %zu arguments, but was given %zu", atom_spelling(name), expected, args->size());
+
+    return t;
+}
+
+
+static pp_token stringize(pp_state *st, const std::vector<pp_token> &arg)
+{
+    std::string s = "\"";
+
+    for (size_t i = 0; i < arg.size(); i++)
+    {
+        if (i && space_before(arg[i].file->tokens, arg[i].index))
+            s += ' ';
+
+        source_text spelling = spelling_of(arg[i]);
+        bool quoted = (type_of(arg[i]) == token::LIT_STRING) || (type_of(arg[i]) == token::LIT_CHAR);
+
+        for (size_t j = 0; j < spelling.length; j++)
+        {
+            if (quoted && ((spelling.start[j] == '"') || (spelling.start[j] == '\\')))
+                s += '\\';
+            s += spelling.start[j];
+        }
+    }
+
+    s += '"';
+    return {make_spelling(st, s), 0, nullptr};
+}
+
+
+/**
+ * Pastes two tokens (either of which may be a placemarker). The result takes
+ * the place of lhs, including the whitespace before it (which matters if it
+ * gets stringized).
+ */
+static pp_token paste(pp_state *st, const pp_token &lhs, const pp_token &rhs)
+{
+    if (!lhs.file)
+        return rhs;
+    if (!rhs.file)
+        return lhs;
+
+    source_text l = spelling_of(lhs), r = spelling_of(rhs);
+    std::string s = space_before(lhs.file->tokens, lhs.index) ? " " : "";
+    s.append(l.start, l.length);
+    s.append(r.start, r.length);
+
+    const pp_file *f = make_spelling(st, s);
+    if (f->tokens.size() != 1)
+        throw format("Pasting %.*s and %.*s does not give a valid token", static_cast<int>(l.length), l.start,
+                     static_cast<int>(r.length), r.start);
+
+    return {f, 0, nullptr};
+}
+
+
+/**
+ * Replaces the parameters in the body of m by the given arguments and applies
+ * the # and ## operators (object-like macros have no arguments and only ##).
+ */
+static void substitute(pp_state *st, const macro *m, const std::vector<std::vector<pp_token>> &args, std::vector<pp_token> *result)
+{
+    static const pp_token placemarker = {nullptr, 0, nullptr};
+
+    // Arguments are only expanded once needed
+    std::vector<std::vector<pp_token>> expanded(args.size());
+    std::vector<bool> is_expanded(args.size(), false);
+
+    const std::vector<pp_token> &body = m->body;
+    for (size_t i = 0; i < body.size(); i++)
+    {
+        const pp_token &t = body[i];
+        int p = m->body_parameters[i];
+
+        if ((m->kind == macro::FUNCTION_LIKE) && is_hash(t))
+        {
+            result->push_back(stringize(st, args[m->body_parameters[++i]]));
+            continue;
+        }
+
+        if (is_hash_hash(t))
+        {
+            pp_token lhs = result->back();
+            result->pop_back();
+
+            int q = m->body_parameters[++i];
+            if (q < 0)
+            {
+                result->push_back(paste(st, lhs, body[i]));
+                continue;
+            }
+
+            const std::vector<pp_token> &arg = args[q];
+
+            // GNU extension: in , ## __VA_ARGS__ the comma disappears if
+            // there are no variable arguments
+            if (m->variadic && (q == static_cast<int>(m->parameters.size()) - 1) && is_operator(lhs, ATOM_COMMA))
+            {
+                if (!arg.empty())
+                {
+                    result->push_back(lhs);
+                    result->insert(result->end(), arg.begin(), arg.end());
+                }
+                continue;
+            }
+
+            if (arg.empty())
+                result->push_back(lhs);
+            else
+            {
+                result->push_back(paste(st, lhs, arg.front()));
+                result->insert(result->end(), arg.begin() + 1, arg.end());
+            }
+            continue;
+        }
+
+        if (p < 0)
+        {
+            result->push_back(t);
+            continue;
+        }
+
+        // Operands of ## are not expanded
+        if ((i + 1 < body.size()) && is_hash_hash(body[i + 1]))
+        {
+            if (args[p].empty())
+                result->push_back(placemarker);
+            else
+                result->insert(result->end(), args[p].begin(), args[p].end());
+            continue;
+        }
+
+        if (!is_expanded[p])
+        {
+            expanded[p] = expand_list(st, args[p]);
+            is_expanded[p] = true;
+        }
+        result->insert(result->end(), expanded[p].begin(), expanded[p].end());
+    }
+
+    result->erase(std::remove_if(result->begin(), result->end(), [](const pp_token &r) { return !r.file; }), result->end());
+}
+
+
+static std::string quote(const std::string &s)
+{
+    std::string q = "\"";
+    for (char c: s)
+    {
+        if ((c == '"') || (c == '\\'))
+            q += '\\';
+        q += c;
+    }
+    return q + "\"";
+}
+
+
+static pp_token builtin(pp_state *st, macro::macro_kind kind)
+{
+    std::string s;
+
+    switch (kind)
+    {
+        case macro::FILE_NAME:   s = quote(st->frames.empty() ? std::string() : st->frames.back().file->name); break;
+        case macro::LINE_NUMBER: s = std::to_string(st->last.file ? st->last.file->tokens.line(st->last.index) : 0); break;
+        case macro::DATE:        s = st->date; break;
+        default:                 s = st->time; break;
+    }
+
+    return {make_spelling(st, s), 0, nullptr};
+}
+
+
+/**
+ * Expands t if it is a macro, putting the result in front of the input.
+ * Returns whether it did.
+ */
+static bool expand(pp_state *st, pp_input *in, const pp_token &t)
+{
+    if (!t.file || (type_of(t) != token::IDENTIFIER))
+        return false;
+
+    atom_t name = atom_of(t);
+    if ((name >= st->macros.size()) || !st->macros[name] || is_hidden(t.hidden, name))
+        return false;
+
+    const macro *m = st->macros[name].get();
+    if ((m->kind == macro::FUNCTION_LIKE) && !next_is_lparen(st, in))
+        return false;
+
+    st->where = st->last;
+
+    std::vector<pp_token> result;
+    const hideset *hs = nullptr;
+
+    switch (m->kind)
+    {
+        case macro::OBJECT_LIKE:
+            hs = hide(st, t.hidden, name);
+            substitute(st, m, {}, &result);
+            break;
+
+        case macro::FUNCTION_LIKE:
+        {
+            std::vector<std::vector<pp_token>> args;
+            pp_token rparen = read_arguments(st, in, m, name, &args);
+            hs = hide(st, intersect(st, t.hidden, rparen.hidden), name);
+            substitute(st, m, args, &result);
+            break;
+        }
+
+        default:
+            result.push_back(builtin(st, m->kind));
+    }
+
+    for (auto r = result.rbegin(); r != result.rend(); r++)
+    {
+        r->hidden = unite(st, r->hidden, hs);
+        in->pending.push_back(*r);
+    }
+
+    return true;
+}
+
+
+/**
+ * Returns the identifier at token i of file (before end) as the name of a
+ * macro for the given directive.
+ */
+static atom_t macro_name(const pp_file *file, token_index i, token_index end, const char *directive_name)
+{
+    if ((i >= end) || (file->tokens.type(i) != token::IDENTIFIER))
+        throw format("%s expects a macro name", directive_name);
+
+    atom_t name = file->tokens.atom(i);
+    if (name == ATOM_DEFINED)
+        throw format("\"defined\" cannot be used as a macro name");
+
+    return name;
+}
+
+
+static void define(pp_state *st, const pp_file *file, token_index first, token_index end)
+{
+    const token_stream &tokens = file->tokens;
+    atom_t name = macro_name(file, first, end, "#define");
+
+    std::unique_ptr<macro> m(new macro);
+    m->kind = macro::OBJECT_LIKE;
+    m->variadic = false;
+
+    token_index i = first + 1;
+    auto is_op = [&](token_index j, atom_t a) { return (j < end) && is_operator({file, j, nullptr}, a); };
+
+    // Only a ( right after the name starts a parameter list
+    if (is_op(i, ATOM_LPAREN) && !space_before(tokens, i))
+    {
+        m->kind = macro::FUNCTION_LIKE;
+        i++;
+
+        if (is_op(i, ATOM_RPAREN))
+            i++;
+        else
+        {
+            for (;;)
+            {
+                if (is_op(i, ATOM_ELLIPSIS))
+                {
+                    m->variadic = true;
+                    m->parameters.push_back(ATOM_VA_ARGS);
+                    i++;
+                }
+                else if ((i < end) && (tokens.type(i) == token::IDENTIFIER) && (tokens.atom(i) != ATOM_VA_ARGS))
+                {
+                    atom_t p = tokens.atom(i++);
+                    if (std::find(m->parameters.begin(), m->parameters.end(), p) != m->parameters.end())
+                        throw format("Duplicate macro parameter %s", atom_spelling(p));
+                    m->parameters.push_back(p);
+                }
+                else
+                    throw format("Expected a parameter name in #define");
+
+                if (is_op(i, ATOM_RPAREN))
+                {
+                    i++;
+                    break;
+                }
+
+                if (m->variadic || !is_op(i, ATOM_COMMA))
+                    throw format("Expected ',' or ')' in the parameter list of #define");
+                i++;
+            }
+        }
+    }
+
+    for (; i < end; i++)
+    {
+        int p = -1;
+        if ((m->kind == macro::FUNCTION_LIKE) && (tokens.type(i) == token::IDENTIFIER))
+        {
+            auto param = std::find(m->parameters.begin(), m->parameters.end(), tokens.atom(i));
+            if (param != m->parameters.end())
+                p = param - m->parameters.begin();
+        }
+
+        m->body.push_back({file, i, nullptr});
+        m->body_parameters.push_back(p);
+    }
+
+    if (!m->body.empty() && (is_hash_hash(m->body.front()) || is_hash_hash(m->body.back())))
+        throw format("'##' cannot appear at either end of a macro expansion");
+
+    if (m->kind == macro::FUNCTION_LIKE)
+        for (size_t j = 0; j < m->body.size(); j++)
+            if (is_hash(m->body[j]) && ((j + 1 == m->body.size()) || (m->body_parameters[j + 1] < 0)))
+                throw format("'#' is not followed by a macro parameter");
+
+    if (name >= st->macros.size())
+        st->macros.resize(name + 1);
+    st->macros[name] = std::move(m);
+}
+
+
+static bool is_defined(const pp_state *st, atom_t name)
+{
+    return (name < st->macros.size()) && st->macros[name];
+}
+
+
+// Value of a #if expression (or a part of it)
+struct pp_value
+{
+    uint64_t v;
+    bool is_unsigned;
+};
+
+
+struct pp_expression
+{
+    const std::vector<pp_token> *tokens;
+    size_t position;
+};
+
+
+// The alternative tokens are just other spellings
+static atom_t operator_of(const pp_token &t)
+{
+    if (type_of(t) == token::IDENTIFIER)
+    {
+        switch (atom_of(t))
+        {
+            case ATOM_AND:    return ATOM_AMP_AMP;
+            case ATOM_OR:     return ATOM_PIPE_PIPE;
+            case ATOM_NOT:    return ATOM_EXCLAIM;
+            case ATOM_BITAND: return ATOM_AMP;
+            case ATOM_BITOR:  return ATOM_PIPE;
+            case ATOM_XOR:    return ATOM_CARET;
+            case ATOM_COMPL:  return ATOM_TILDE;
+            case ATOM_NOT_EQ: return ATOM_NE;
+            default:          return ATOM_NONE;
+        }
+    }
+
+    return (type_of(t) == token::OPERATOR) ? atom_of(t) : ATOM_NONE;
+}
+
+
+static bool at_operator(const pp_expression *e, atom_t op)
+{
+    return (e->position < e->tokens->size()) && (operator_of((*e->tokens)[e->position]) == op);
+}
+
+
+/**
+ * Precedence of the binary operator at the current position (0 if there is
+ * none), which is stored in *op and consists of *length tokens.
+ */
+static int binary_precedence(const pp_expression *e, atom_t *op, size_t *length)
+{
+    if (e->position >= e->tokens->size())
+        return 0;
+
+    const pp_token &t = (*e->tokens)[e->position];
+    *op = operator_of(t);
+    *length = 1;
+
+    // The tokenizer always splits >> (for templates)
+    if ((*op == ATOM_GREATER) && (e->position + 1 < e->tokens->size()))
+    {
+        const pp_token &n = (*e->tokens)[e->position + 1];
+        source_text a = spelling_of(t), b = spelling_of(n);
+        if ((operator_of(n) == ATOM_GREATER) && (a.start + a.length == b.start))
+        {
+            *op = ATOM_RSHIFT;
+            *length = 2;
+        }
+    }
+
+    switch (*op)
+    {
+        case ATOM_STAR: case ATOM_SLASH: case ATOM_PERCENT:    return 10;
+        case ATOM_PLUS: case ATOM_MINUS:                       return 9;
+        case ATOM_LSHIFT: case ATOM_RSHIFT:                    return 8;
+        case ATOM_LESS: case ATOM_GREATER: case ATOM_LE: case ATOM_GE: return 7;
+        case ATOM_EQ: case ATOM_NE:                            return 6;
+        case ATOM_AMP:                                         return 5;
+        case ATOM_CARET:                                       return 4;
+        case ATOM_PIPE:                                        return 3;
+        case ATOM_AMP_AMP:                                     return 2;
+        case ATOM_PIPE_PIPE:                                   return 1;
+        default:                                               return 0;
+    }
+}
+
+
+static pp_value apply(atom_t op, pp_value l, pp_value r, bool evaluated)
+{
+    bool u = l.is_unsigned || r.is_unsigned;
+    int64_t sl = l.v, sr = r.v;
+
+    switch (op)
+    {
+        case ATOM_STAR:  return {l.v * r.v, u};
+        case ATOM_PLUS:  return {l.v + r.v, u};
+        case ATOM_MINUS: return {l.v - r.v, u};
+
+        case ATOM_SLASH:
+        case ATOM_PERCENT:
+            if (!r.v)
+            {
+                if (evaluated)
+                    throw format("Division by zero in #if");
+                return {0, u};
+            }
+            if (u)
+                return {(op == ATOM_SLASH) ? l.v / r.v : l.v % r.v, true};
+            // Avoids overflowing on INT64_MIN / -1
+            if (sr == -1)
+                return {(op == ATOM_SLASH) ? -l.v : 0, false};
+            return {static_cast<uint64_t>((op == ATOM_SLASH) ? sl / sr : sl % sr), false};
+
+        // The result has the type of the left operand
+        case ATOM_LSHIFT:
+            return {(r.v >= 64) ? 0 : l.v << r.v, l.is_unsigned};
+        case ATOM_RSHIFT:
+            if (l.is_unsigned)
+                return {(r.v >= 64) ? 0 : l.v >> r.v, true};
+            return {static_cast<uint64_t>(sl >> std::min<uint64_t>(r.v, 63)), false};
+
+        case ATOM_LESS:    return {u ? (l.v <  r.v) : (sl <  sr), false};
+        case ATOM_GREATER: return {u ? (l.v >  r.v) : (sl >  sr), false};
+        case ATOM_LE:      return {u ? (l.v <= r.v) : (sl <= sr), false};
+        case ATOM_GE:      return {u ? (l.v >= r.v) : (sl >= sr), false};
+        case ATOM_EQ:      return {l.v == r.v, false};
+        case ATOM_NE:      return {l.v != r.v, false};
+
+        case ATOM_AMP:     return {l.v & r.v, u};
+        case ATOM_CARET:   return {l.v ^ r.v, u};
+        case ATOM_PIPE:    return {l.v | r.v, u};
+
+        case ATOM_AMP_AMP:   return {l.v && r.v, false};
+        default:             return {l.v || r.v, false};
+    }
+}
+
+
+static pp_value conditional_expression(pp_expression *e, bool evaluated);
+
+static pp_value unary_expression(pp_expression *e, bool evaluated)
+{
+    if (e->position >= e->tokens->size())
+        throw format("Expected a value in #if");
+
+    const pp_token &t = (*e->tokens)[e->position++];
+    const token_stream &tokens = t.file->tokens;
+
+    switch (type_of(t))
+    {
+        case token::LIT_INTEGER:
+        {
+            // Decoded on a copy, the file's tokens are shared
+            lit_integer li = tokens.integers[atom_of(t) & ~token_stream::LITERAL_VALUE];
+            li.decode(spelling_of(t));
+            return {li.value.u, (li.subtype & lit_integer::UNSIGNED) != 0};
+        }
+
+        case token::LIT_CHAR:    return {tokens.char_value(t.index), false};
+        case token::LIT_BOOL:    return {tokens.bool_value(t.index), false};
+        case token::LIT_POINTER: return {0, false};
+
+        case token::IDENTIFIER:
+        case token::OPERATOR:
+        {
+            pp_value v;
+            switch (operator_of(t))
+            {
+                case ATOM_LPAREN:
+                    v = conditional_expression(e, evaluated);
+                    if (!at_operator(e, ATOM_RPAREN))
+                        throw format("Expected ')' in #if");
+                    e->position++;
+                    return v;
+
+                case ATOM_PLUS:    return unary_expression(e, evaluated);
+                case ATOM_MINUS:   v = unary_expression(e, evaluated); v.v = -v.v; return v;
+                case ATOM_TILDE:   v = unary_expression(e, evaluated); v.v = ~v.v; return v;
+                case ATOM_EXCLAIM: v = unary_expression(e, evaluated); return {!v.v, false};
+
+                default:
+                    // Identifiers that are no macros are 0
+                    if (type_of(t) == token::IDENTIFIER)
+                        return {0, false};
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+
+    source_text spelling = spelling_of(t);
+    throw format("Unexpected %.*s in #if", static_cast<int>(spelling.length), spelling.start);
+}
+
+
+static pp_value binary_expression(pp_expression *e, int min_precedence, bool evaluated)
+{
+    pp_value lhs = unary_expression(e, evaluated);
+
+    atom_t op = ATOM_NONE;
+    size_t length = 0;
+    int precedence;
+
+    while ((precedence = binary_precedence(e, &op, &length)) >= min_precedence)
+    {
+        e->position += length;
+
+        // && and || only evaluate their right operand if needed
+        bool rhs_evaluated = evaluated && !((op == ATOM_AMP_AMP) && !lhs.v) && !((op == ATOM_PIPE_PIPE) && lhs.v);
+        pp_value rhs = binary_expression(e, precedence + 1, rhs_evaluated);
+        lhs = apply(op, lhs, rhs, evaluated);
+    }
+
+    return lhs;
+}
+
+
+static pp_value conditional_expression(pp_expression *e, bool evaluated)
+{
+    pp_value c = binary_expression(e, 1, evaluated);
+    if (!at_operator(e, ATOM_QUESTION))
+        return c;
+
+    e->position++;
+    pp_value a = conditional_expression(e, evaluated && c.v);
+
+    if (!at_operator(e, ATOM_COLON))
+        throw format("Expected ':' in #if");
+
+    e->position++;
+    pp_value b = conditional_expression(e, evaluated && !c.v);
+
+    return {c.v ? a.v : b.v, a.is_unsigned || b.is_unsigned};
+}
+
+
+/**
+ * Evaluates the #if (or #elif) expression from token first of file to end.
+ */
+static bool evaluate(pp_state *st, const pp_file *file, token_index first, token_index end)
+{
+    if (first >= end)
+        throw format("#if with no expression");
+
+    if (!st->numbers)
+    {
+        std::shared_ptr<pp_file> numbers = std::make_shared<pp_file>();
+        numbers->name = "<built-in>";
+        numbers->text = "0 1";
+        numbers->length = 3;
+        numbers->tokenize();
+        st->numbers = numbers.get();
+        st->used.push_back(numbers);
+    }
+
+    // defined goes before macro expansion
+    std::vector<pp_token> list;
+    for (token_index i = first; i < end; i++)
+    {
+        pp_token t = {file, i, nullptr};
+
+        if ((type_of(t) == token::IDENTIFIER) && (atom_of(t) == ATOM_DEFINED))
+        {
+            bool parenthesized = (i + 1 < end) && is_operator({file, i + 1, nullptr}, ATOM_LPAREN);
+            token_index name = i + 1 + parenthesized;
+
+            if ((name >= end) || (file->tokens.type(name) != token::IDENTIFIER))
+                throw format("\"defined\" expects a macro name");
+            if (parenthesized && ((name + 1 >= end) || !is_operator({file, name + 1, nullptr}, ATOM_RPAREN)))
+                throw format("Missing ')' after \"defined\"");
+
+            list.push_back({st->numbers, is_defined(st, file->tokens.atom(name)) ? 1u : 0u, nullptr});
+            i = name + parenthesized;
+            continue;
+        }
+
+        list.push_back(t);
+    }
+
+    std::vector<pp_token> expanded = expand_list(st, list);
+    pp_expression e = {&expanded, 0};
+    pp_value v = conditional_expression(&e, true);
+
+    if (e.position < expanded.size())
+    {
+        source_text spelling = spelling_of(expanded[e.position]);
+        throw format("Unexpected %.*s in #if", static_cast<int>(spelling.length), spelling.start);
+    }
+
+    return v.v;
+}
+
+
+/**
+ * Reads the file name of an #include from token first of file to end.
+ */
+static void header_name(pp_state *st, const pp_file *file, token_index first, token_index end, std::string *name, bool *angled)
+{
+    const token_stream &tokens = file->tokens;
+
+    if ((first + 1 == end) && (tokens.type(first) == token::LIT_STRING) && (*tokens.spelling(first).start == '"'))
+    {
+        source_text s = tokens.spelling(first);
+        *name = std::string(s.start + 1, s.length - 2);
+        *angled = false;
+        return;
+    }
+
+    // The text between < and > (which has been tokenized all the same)
+    if ((first < end) && is_operator({file, first, nullptr}, ATOM_LESS))
+    {
+        for (token_index i = first + 1; i < end; i++)
+        {
+            if (is_operator({file, i, nullptr}, ATOM_GREATER))
+            {
+                const char *start = tokens.spelling(first).start + 1;
+                *name = std::string(start, tokens.spelling(i).start - start);
+                *angled = true;
+                return;
+            }
+        }
+
+        throw format("Missing '>' in #include");
+    }
+
+    // Anything else has to expand to one of those
+    std::vector<pp_token> list;
+    for (token_index i = first; i < end; i++)
+        list.push_back({file, i, nullptr});
+
+    std::string s;
+    for (const pp_token &t: expand_list(st, list))
+    {
+        if (!s.empty() && space_before(t.file->tokens, t.index))
+            s += ' ';
+        source_text spelling = spelling_of(t);
+        s.append(spelling.start, spelling.length);
+    }
+
+    if ((s.length() > 2) && (((s[0] == '"') && (s.back() == '"')) || ((s[0] == '<') && (s.back() == '>'))))
+    {
+        *name = s.substr(1, s.length() - 2);
+        *angled = (s[0] == '<');
+        return;
+    }
+
+    throw format("#include expects \"FILENAME\" or <FILENAME>");
+}
+
+
+static std::string directory_of(const std::string &path)
+{
+    size_t slash = path.rfind('/');
+    return (slash == std::string::npos) ? std::string() : path.substr(0, slash + 1);
+}
+
+
+static void include(pp_state *st, const pp_file *file, token_index first, token_index end)
+{
+    std::string name;
+    bool angled;
+    header_name(st, file, first, end, &name, &angled);
+
+    if (name.empty())
+        throw format("Empty file name in #include");
+
+    std::string key = angled ? "<" + name : directory_of(file->name) + "\"" + name;
+
+    // Files found before need not be looked for again if they are known to
+    // be empty now
+    auto r = st->resolved.find(key);
+    if (r != st->resolved.end())
+    {
+        const pp_file *f = r->second;
+        if (((f->guard != ATOM_NONE) && is_defined(st, f->guard)) || st->once.count(std::make_pair(f->device, f->inode)))
+        {
+            st->cache->elided++;
+            return;
+        }
+    }
+
+    // "..." is looked for next to the including file first
+    std::vector<std::string> candidates;
+    if (name[0] == '/')
+        candidates.push_back(name);
+    else
+    {
+        if (!angled)
+            candidates.push_back(directory_of(file->name) + name);
+        for (const std::string &dir: st->options->include_paths)
+            candidates.push_back(dir + "/" + name);
+    }
+
+    for (const std::string &path: candidates)
+    {
+        struct stat s;
+        if ((stat(path.c_str(), &s) < 0) || !S_ISREG(s.st_mode))
+            continue;
+
+        std::shared_ptr<const pp_file> f = st->cache->get(path, s);
+        if (!f)
+            throw format("Could not read %s: %s", path.c_str(), strerror(errno));
+
+        st->used.push_back(f);
+        st->resolved[key] = f.get();
+        if (!st->once.count(std::make_pair(f->device, f->inode)))
+            enter_file(st, f.get());
+        return;
+    }
+
+    throw format(angled ? "Could not find include file <%s>" : "Could not find include file \"%s\"", name.c_str());
+}
+
+
+/**
+ * The raw text of a directive after its name, up to the end of its (last
+ * continued) line.
+ */
+static std::string directive_text(const pp_file *file, token_index name)
+{
+    source_text s = file->tokens.spelling(name);
+    const char *p = s.start + s.length;
+    while ((*p == ' ') || (*p == '\t'))
+        p++;
+
+    std::string text;
+    for (;;)
+    {
+        const char *end = p;
+        while (*end && (*end != '\n'))
+            end++;
+
+        const char *stop = ((end > p) && (end[-1] == '\r')) ? end - 1 : end;
+        if (!*end || (stop == p) || (stop[-1] != '\\'))
+        {
+            text.append(p, stop);
+            break;
+        }
+
+        text.append(p, stop - 1);
+        p = end + 1;
+    }
+
+    while (!text.empty() && ((text.back() == ' ') || (text.back() == '\t')))
+        text.pop_back();
+    return text;
+}
+
+
+static error *located_error(const pp_state *st, char *msg)
+{
+    const pp_token &w = st->where;
+    if (!w.file)
+        return new error(msg);
+
+    const pp_file *f = w.file->site ? w.file->site : w.file;
+    error *err;
+    if (w.file->site)
+        err = new error(w.file->site_line, 1, msg);
+    else
+        err = new error(f->tokens.line(w.index), f->tokens.column(w.index), msg);
+
+    err->file = f->name.c_str();
+    err->text = f->text;
+    return err;
+}
+
+
+static void directive(pp_state *st, const pp_file *file, const directive_range &d, bool in_arguments)
+{
+    const token_stream &tokens = file->tokens;
+    token_index name = d.start + 1;
+
+    st->last = st->where = {file, d.start, nullptr};
+
+    atom_t a = ((name < d.end) && (tokens.type(name) == token::IDENTIFIER)) ? tokens.atom(name) : ATOM_NONE;
+    bool active = is_active(st);
+
+    // Text of the directive that could not be tokenized fails it unless it
+    // is skipped; #elif, #else and #endif are only skipped along with the
+    // group around their conditional
+    const include_frame &f = st->frames.back();
+    if ((f.next_failure < file->failures.size()) && file->failures[f.next_failure].in_directive &&
+        (file->failures[f.next_failure].at == d.end))
+    {
+        bool skipped = !active;
+        if ((a == ATOM_ELIF) || (a == ATOM_ELSE) || (a == ATOM_ENDIF))
+            skipped = (st->conditionals.size() > 1) && !st->conditionals[st->conditionals.size() - 2].active;
+        if (!skipped)
+            throw file->failure(f.next_failure);
+    }
+
+    // The null directive, and GNU line markers (# 1 "file", as found in
+    // preprocessed files)
+    if ((name == d.end) || (tokens.type(name) == token::LIT_INTEGER))
+        return;
+
+    switch (a)
+    {
+        case ATOM_IF:
+        case ATOM_IFDEF:
+        case ATOM_IFNDEF:
+        {
+            conditional c = {false, true, false, st->where};
+            if (active)
+            {
+                if (a == ATOM_IF)
+                    c.active = evaluate(st, file, name + 1, d.end);
+                else
+                    c.active = is_defined(st, macro_name(file, name + 1, d.end, (a == ATOM_IFDEF) ? "#ifdef" : "#ifndef")) == (a == ATOM_IFDEF);
+                c.taken = c.active;
+            }
+            st->conditionals.push_back(c);
+            return;
+        }
+
+        case ATOM_ELIF:
+        case ATOM_ELSE:
+        case ATOM_ENDIF:
+        {
+            if (st->conditionals.size() <= st->frames.back().conditionals)
+                throw format("#%s without #if", atom_spelling(a));
+
+            conditional &c = st->conditionals.back();
+            if (a == ATOM_ENDIF)
+            {
+                st->conditionals.pop_back();
+                return;
+            }
+
+            if (c.seen_else)
+                throw format("#%s after #else", atom_spelling(a));
+
+            if (c.taken)
+                c.active = false;
+            else if (a == ATOM_ELSE)
+                c.active = c.taken = true;
+            else
+                c.active = c.taken = evaluate(st, file, name + 1, d.end);
+
+            c.seen_else = (a == ATOM_ELSE);
+            return;
+        }
+
+        default:
+            break;
+    }
+
+    if (!active)
+        return;
+
+    switch (a)
+    {
+        case ATOM_DEFINE:
+            define(st, file, name + 1, d.end);
+            return;
+
+        case ATOM_UNDEF:
+        {
+            atom_t m = macro_name(file, name + 1, d.end, "#undef");
+            if (m < st->macros.size())
+                st->macros[m].reset();
+            return;
+        }
+
+        case ATOM_INCLUDE:
+            if (in_arguments)
+                throw format("#include in macro arguments");
+            include(st, file, name + 1, d.end);
+            return;
+
+        case ATOM_ERROR:
+            throw format("#error %s", directive_text(file, name).c_str());
+
+        case ATOM_WARNING:
+            st->warnings->emplace_back(located_error(st, format("warning: #warning %s", directive_text(file, name).c_str())));
+            return;
+
+        case ATOM_PRAGMA:
+            // Other pragmas are none of our business
+            if ((name + 1 < d.end) && (tokens.type(name + 1) == token::IDENTIFIER) && (tokens.atom(name + 1) == ATOM_ONCE) && file->inode)
+                st->once.insert(std::make_pair(file->device, file->inode));
+            return;
+
+        case ATOM_LINE:
+            // Renumbering would have to reach the line tables of the output
+            // and of every file copied there; rather fail than report wrong
+            // positions
+            throw format("#line is not supported");
+
+        default:
+        {
+            source_text s = tokens.spelling(name);
+            throw format("Invalid preprocessing directive #%.*s", static_cast<int>(s.length), s.start);
+        }
+    }
+}
+
+
+static const pp_file *add_file(pp_state *st, const char *name, const char *text)
+{
+    std::shared_ptr<pp_file> f = std::make_shared<pp_file>();
+    f->name = name;
+    f->text = text;
+    f->length = strlen(text);
+    f->tokenize();
+    st->used.push_back(f);
+    return f.get();
+}
+
+
+static void init_macros(pp_state *st)
+{
+    static const std::pair<atom_t, macro::macro_kind> builtins[] = {
+        {ATOM_MACRO_FILE, macro::FILE_NAME},
+        {ATOM_MACRO_LINE, macro::LINE_NUMBER},
+        {ATOM_MACRO_DATE, macro::DATE},
+        {ATOM_MACRO_TIME, macro::TIME},
+    };
+
+    for (const auto &b: builtins)
+    {
+        macro *m = new macro;
+        m->kind = b.second;
+        m->variadic = false;
+
+        if (b.first >= st->macros.size())
+            st->macros.resize(b.first + 1);
+        st->macros[b.first].reset(m);
+    }
+
+    // As in "Jan  1 1970" and "00:00:00"
+    time_t now = time(nullptr);
+    struct tm t;
+    localtime_r(&now, &t);
+
+    char buf[32];
+    strftime(buf, sizeof(buf), "\"%b %e %Y\"", &t);
+    st->date = buf;
+    strftime(buf, sizeof(buf), "\"%H:%M:%S\"", &t);
+    st->time = buf;
+}
+
+
+preprocessor::preprocessor(include_cache *cache, const pp_options *options):
+    tokens(""), files(cache), opts(options), state(nullptr), complete(false)
+{}
+
+
+preprocessor::~preprocessor(void)
+{
+    delete state;
+}
+
+
+void preprocessor::run(const char *name, const char *text)
+{
+    delete state;
+    state = new pp_state(files, opts, &tokens, &warnings);
+    complete = false;
+    tokens = token_stream(nullptr);
+    warnings.clear();
+
+    pp_state *st = state;
+
+    try
+    {
+        const pp_file *main_file = add_file(st, name, text);
+
+        // The unit's own tokens are most of the output usually
+        tokens.types.reserve(main_file->tokens.size());
+        tokens.atoms.reserve(main_file->tokens.size());
+        tokens.offsets.reserve(main_file->tokens.size());
+        tokens.lengths.reserve(main_file->tokens.size());
+        st->text.reserve(main_file->length + 1);
+
+        init_macros(st);
+
+        // Processed from the last one entered
+        enter_file(st, main_file);
+        if (!opts->definitions.empty())
+            enter_file(st, add_file(st, "<command line>", opts->definitions.c_str()));
+        enter_file(st, add_file(st, "<built-in>", BUILTIN_DEFINITIONS));
+
+        pp_token t;
+        while (next_token(st, &st->input, &t, false))
+            if (!expand(st, &st->input, t))
+                emit(st, t);
+    }
+    catch (char *msg)
+    {
+        st->text.push_back(0);
+        tokens.source = st->text.data();
+        throw located_error(st, msg);
+    }
+    catch (error *)
+    {
+        st->text.push_back(0);
+        tokens.source = st->text.data();
+        throw;
+    }
+
+    st->text.push_back(0);
+    tokens.source = st->text.data();
+    complete = true;
+}
+
+
+std::string preprocessor::macro_definitions(void) const
+{
+    std::string defs;
+    if (!state)
+        return defs;
+
+    for (atom_t name = 0; name < state->macros.size(); name++)
+    {
+        const macro *m = state->macros[name].get();
+        if (!m || ((m->kind != macro::OBJECT_LIKE) && (m->kind != macro::FUNCTION_LIKE)))
+            continue;
+
+        defs += "#define ";
+        defs += atom_spelling(name);
+
+        if (m->kind == macro::FUNCTION_LIKE)
+        {
+            defs += '(';
+            for (size_t i = 0; i < m->parameters.size(); i++)
+            {
+                if (i)
+                    defs += ", ";
+                defs += (m->variadic && (i == m->parameters.size() - 1)) ? "..." : atom_spelling(m->parameters[i]);
+            }
+            defs += ')';
+        }
+
+        // Tokens that were adjacent stay so (> > is not >> in #if)
+        const pp_token *prev = nullptr;
+        for (const pp_token &t: m->body)
+        {
+            const token_stream &ts = t.file->tokens;
+
+            if (!prev || (prev->file != t.file) ||
+                (prev->file->tokens.offsets[prev->index] + prev->file->tokens.lengths[prev->index] != ts.offsets[t.index]))
+            {
+                defs += ' ';
+            }
+
+            defs.append(ts.spelling(t.index).start, ts.spelling(t.index).length);
+            prev = &t;
+        }
+
+        defs += '\n';
+    }
+
+    return defs;
+}
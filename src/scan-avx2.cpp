@@ -0,0 +1,29 @@
+// Compiled with -mavx2 (see Makefile); only used if the CPU supports it.
+#if defined(__x86_64__) && defined(__AVX2__)
+
+#include <cstdint>
+#include <immintrin.h>
+
+#include "scan.hpp"
+
+
+typedef __m256i vec;
+static const int VEC_BYTES = 32;
+
+static inline vec vload(const char *p) { return _mm256_loadu_si256(reinterpret_cast<const vec *>(p)); }
+static inline vec vsplat(char c) { return _mm256_set1_epi8(c); }
+static inline vec veq(vec a, vec b) { return _mm256_cmpeq_epi8(a, b); }
+static inline vec vor(vec a, vec b) { return _mm256_or_si256(a, b); }
+static inline uint32_t vmask(vec v) { return static_cast<uint32_t>(_mm256_movemask_epi8(v)); }
+
+#include "scan-kernels.cxx"
+
+
+extern const scan_kernels avx2_scan_kernels = {
+    "avx2",
+    vec_line_end,
+    vec_block_comment_end,
+    vec_string_stop,
+};
+
+#endif
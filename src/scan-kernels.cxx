@@ -0,0 +1,85 @@
+// Vectorized scan kernels; the including file defines vec, VEC_BYTES, vload()
+// (unaligned), vsplat(), veq(), vor() and vmask() (one bit per byte).
+//
+// Vectors are only loaded while they end before the terminating null byte;
+// the rest is scanned a byte at a time, so nothing past the input is read.
+
+
+// Accounts for the newlines in nl (bit mask relative to the vector at v)
+static inline void count_newlines(const char *v, uint32_t nl, int *line, const char **line_start)
+{
+    if (nl)
+    {
+        *line += __builtin_popcount(nl);
+        *line_start = v + (31 - __builtin_clz(nl)) + 1;
+    }
+}
+
+
+static const char *vec_line_end(const char *p, const char *end)
+{
+    for (; end - p >= VEC_BYTES; p += VEC_BYTES)
+    {
+        uint32_t stop = vmask(veq(vload(p), vsplat('\n')));
+        if (stop)
+            return p + __builtin_ctz(stop);
+    }
+
+    while (*p && (*p != '\n'))
+        p++;
+
+    return p;
+}
+
+
+static const char *vec_block_comment_end(const char *p, const char *end, int *line, const char **line_start)
+{
+    // Whether the byte before the current vector is a '*' (p[-1] is the one
+    // of "/*", which the scalar implementation accepts as well)
+    uint32_t star_carry = (p[-1] == '*');
+
+    for (; end - p >= VEC_BYTES; p += VEC_BYTES)
+    {
+        vec v = vload(p);
+        uint32_t star = vmask(veq(v, vsplat('*')));
+        uint32_t stop = vmask(veq(v, vsplat('/'))) & ((star << 1) | star_carry);
+        uint32_t nl = vmask(veq(v, vsplat('\n')));
+
+        if (stop)
+        {
+            count_newlines(p, nl & ((stop & -stop) - 1), line, line_start);
+            return p + __builtin_ctz(stop) + 1;
+        }
+
+        count_newlines(p, nl, line, line_start);
+        star_carry = (star >> (VEC_BYTES - 1)) & 1;
+    }
+
+    while (*p && ((p[-2] != '*') || (p[-1] != '/')))
+    {
+        if (*(p++) == '\n')
+        {
+            (*line)++;
+            *line_start = p;
+        }
+    }
+
+    return p;
+}
+
+
+static const char *vec_string_stop(const char *p, const char *end)
+{
+    for (; end - p >= VEC_BYTES; p += VEC_BYTES)
+    {
+        vec v = vload(p);
+        uint32_t stop = vmask(vor(veq(v, vsplat('"')), veq(v, vsplat('\\'))));
+        if (stop)
+            return p + __builtin_ctz(stop);
+    }
+
+    while (*p && (*p != '"') && (*p != '\\'))
+        p++;
+
+    return p;
+}
@@ -0,0 +1,114 @@
+#include <cctype>
+#include <cstdint>
+
+#include "scan.hpp"
+
+#ifdef __x86_64__
+#include <emmintrin.h>
+#endif
+
+
+static const char *scalar_line_end(const char *p, const char *)
+{
+    while (*p && (*p != '\n'))
+        p++;
+
+    return p;
+}
+
+
+static const char *scalar_block_comment_end(const char *p, const char *, int *line, const char **line_start)
+{
+    while (*p && ((p[-2] != '*') || (p[-1] != '/')))
+    {
+        if (*(p++) == '\n')
+        {
+            (*line)++;
+            *line_start = p;
+        }
+    }
+
+    return p;
+}
+
+
+static const char *scalar_string_stop(const char *p, const char *)
+{
+    while (*p && (*p != '"') && (*p != '\\'))
+        p++;
+
+    return p;
+}
+
+
+static const scan_kernels scalar_scan_kernels = {
+    "scalar",
+    scalar_line_end,
+    scalar_block_comment_end,
+    scalar_string_stop,
+};
+
+
+#ifdef __x86_64__
+// SSE2 is part of x86-64, so these need no check
+namespace sse2
+{
+typedef __m128i vec;
+static const int VEC_BYTES = 16;
+
+static inline vec vload(const char *p) { return _mm_loadu_si128(reinterpret_cast<const vec *>(p)); }
+static inline vec vsplat(char c) { return _mm_set1_epi8(c); }
+static inline vec veq(vec a, vec b) { return _mm_cmpeq_epi8(a, b); }
+static inline vec vor(vec a, vec b) { return _mm_or_si128(a, b); }
+static inline uint32_t vmask(vec v) { return static_cast<uint32_t>(_mm_movemask_epi8(v)); }
+
+#include "scan-kernels.cxx"
+}
+
+static const scan_kernels sse2_scan_kernels = {
+    "sse2",
+    sse2::vec_line_end,
+    sse2::vec_block_comment_end,
+    sse2::vec_string_stop,
+};
+
+#ifdef SCAN_AVX2
+extern const scan_kernels avx2_scan_kernels;
+#endif
+#endif
+
+
+const scan_kernels *const *supported_scan_kernels(void)
+{
+    static const scan_kernels *supported[4];
+
+    if (!supported[0])
+    {
+        int i = 0;
+        supported[i++] = &scalar_scan_kernels;
+#ifdef __x86_64__
+        supported[i++] = &sse2_scan_kernels;
+#ifdef SCAN_AVX2
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            supported[i++] = &avx2_scan_kernels;
+#endif
+#endif
+        supported[i] = nullptr;
+    }
+
+    return supported;
+}
+
+
+static const scan_kernels *best_scan_kernels(void)
+{
+    const scan_kernels *const *supported = supported_scan_kernels();
+    while (supported[1])
+        supported++;
+
+    return *supported;
+}
+
+
+const scan_kernels *scan = best_scan_kernels();
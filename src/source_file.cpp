@@ -0,0 +1,154 @@
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "source_file.hpp"
+
+
+source_file::~source_file(void)
+{
+    release();
+}
+
+
+void source_file::release(void)
+{
+    if (mapped_size)
+        munmap(data, mapped_size);
+    else
+        free(data);
+
+    data = nullptr;
+    size = mapped_size = 0;
+}
+
+
+/**
+ * Maps a regular file. The mapping is followed by at least one page of
+ * zeroes (an anonymous mapping reserved first, into which the file is mapped),
+ * so there is a null byte behind the file even if its size is a multiple of
+ * the page size. Bytes behind the end of the file in its last page are zero
+ * as well.
+ */
+bool source_file::map(int fd, size_t file_size)
+{
+    size_t page_size = sysconf(_SC_PAGESIZE);
+    size_t total = (file_size / page_size + 1) * page_size;
+
+    void *base = mmap(nullptr, total, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED)
+        return false;
+
+    if (file_size)
+    {
+        if (mmap(base, file_size, PROT_READ, MAP_PRIVATE | MAP_FIXED | MAP_POPULATE, fd, 0) == MAP_FAILED)
+        {
+            int err = errno;
+            munmap(base, total);
+            errno = err;
+            return false;
+        }
+
+        // The tokenizer reads the file front to back, exactly once
+        madvise(base, file_size, MADV_SEQUENTIAL);
+    }
+
+    data = static_cast<char *>(base);
+    size = file_size;
+    mapped_size = total;
+
+    return true;
+}
+
+
+/**
+ * Reads everything up to EOF (for files that cannot be mapped, like pipes).
+ */
+bool source_file::read_all(int fd)
+{
+    size_t capacity = 1 << 16, length = 0;
+    char *buffer = static_cast<char *>(malloc(capacity));
+    if (!buffer)
+        return false;
+
+    for (;;)
+    {
+        // Always leave room for the null byte
+        if (length + 1 >= capacity)
+        {
+            char *grown = static_cast<char *>(realloc(buffer, capacity * 2));
+            if (!grown)
+            {
+                free(buffer);
+                errno = ENOMEM;
+                return false;
+            }
+
+            buffer = grown;
+            capacity *= 2;
+        }
+
+        ssize_t got = read(fd, buffer + length, capacity - length - 1);
+        if (got < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            int err = errno;
+            free(buffer);
+            errno = err;
+            return false;
+        }
+
+        if (!got)
+            break;
+
+        length += got;
+    }
+
+    buffer[length] = 0;
+
+    data = buffer;
+    size = length;
+    mapped_size = 0;
+
+    return true;
+}
+
+
+bool source_file::load(int fd)
+{
+    release();
+
+    struct stat st;
+    if (fstat(fd, &st) < 0)
+        return false;
+
+    if (S_ISREG(st.st_mode))
+        return map(fd, st.st_size);
+    else
+        return read_all(fd);
+}
+
+
+bool source_file::load(const char *path)
+{
+    if (!strcmp(path, "-"))
+        return load(STDIN_FILENO);
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    bool success = load(fd);
+
+    int err = errno;
+    close(fd);
+    errno = err;
+
+    return success;
+}
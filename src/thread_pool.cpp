@@ -0,0 +1,68 @@
+#include <thread>
+
+#include "thread_pool.hpp"
+
+
+thread_pool::thread_pool(int w):
+    queues(w > 0 ? w : 1)
+{}
+
+
+/**
+ * Fetches the next task for the given worker: its own lowest one, or else the
+ * highest one of another worker. Returns false if there is nothing left.
+ */
+bool thread_pool::next_task(int worker, size_t *task)
+{
+    {
+        queue &own = queues[worker];
+        std::lock_guard<std::mutex> guard(own.lock);
+
+        if (!own.tasks.empty())
+        {
+            *task = own.tasks.front();
+            own.tasks.pop_front();
+            return true;
+        }
+    }
+
+    // Tasks are never added while running, so if all queues are empty,
+    // everything has been started
+    for (int i = 1; i < workers(); i++)
+    {
+        queue &victim = queues[(worker + i) % workers()];
+        std::lock_guard<std::mutex> guard(victim.lock);
+
+        if (!victim.tasks.empty())
+        {
+            *task = victim.tasks.back();
+            victim.tasks.pop_back();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+void thread_pool::run(size_t tasks, const std::function<void(size_t task, int worker)> &fn)
+{
+    for (size_t t = 0; t < tasks; t++)
+        queues[t % workers()].tasks.push_back(t);
+
+    auto work = [&](int worker) {
+        size_t task;
+        while (next_task(worker, &task))
+            fn(task, worker);
+    };
+
+    // The calling thread is worker 0
+    std::vector<std::thread> threads;
+    for (int w = 1; w < workers(); w++)
+        threads.emplace_back(work, w);
+
+    work(0);
+
+    for (std::thread &t: threads)
+        t.join();
+}
@@ -1,21 +1,25 @@
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <cfloat>
 #include <cmath>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <ctype.h>
+#include <limits>
+#include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "error.hpp"
 #include "format.hpp"
+#include "scan.hpp"
 #include "tokenize.hpp"
 #include "translation_limits.hpp"
 
-#ifdef __MACH__
-#define exp10l(x) __exp10(x)
-#endif
-
 static inline bool isnondigit(char c)
 {
     return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || (c == '_');
@@ -34,61 +38,231 @@ static inline bool isodigit(char c)
 }
 
 
-// preprocessing-op-or-punc (sorted by reverse length)
-static const char *const poops[] = {
-    "delete",
-
-    "and_eq", "bitand", "not_eq", "xor_eq",
+/**
+ * Skips whitespace (as by isspace()); counts the newlines skipped in *line and
+ * points *line_start behind the last one. Runs between tokens are short, so
+ * unlike comments and strings (see scan.hpp) these are not worth vectorizing.
+ */
+static inline const char *skip_whitespace(const char *p, int *line, const char **line_start)
+{
+    while (*p && isspace(*p))
+    {
+        if (*(p++) == '\n')
+        {
+            (*line)++;
+            *line_start = p;
+        }
+    }
 
-    "bitor", "compl", "or_eq",
+    return p;
+}
 
-    "%:%:",
 
-    // Due to the template<foo<bar>> stuff, '>>' may not be part of other
-    // operators
-    "...", "new", /*">>=",*/ "<<=", "->*", "and", "not", "xor",
+/**
+ * Returns the first character which cannot be part of an identifier.
+ */
+static inline const char *identifier_end(const char *p)
+{
+    while (isnondigit(*p) || isdigit(*p))
+        p++;
 
-    "##", "<:", ":>", "<%", "%>", "%:", "::", ".*", "+=", "-=", "*=", "/=",
-    "%=", "^=", "&=", "|=", "<<", /*">>",*/ "==", "!=", "<=", ">=", "&&", "||",
-    "++", "--", "->", "or",
+    return p;
+}
 
-    "{", "}", "[", "]", "#", "(", ")", ";", ":", "?", ".", "+", "-", "*", "/",
-    "%", "^", "&", "|", "~", "!", "=", "<", ">", ","
-};
 
-static inline bool ispoop(const char **c)
+/**
+ * Recognizes the non-alphabetic preprocessing-op-or-punc at c (longest match).
+ * Returns its length (0 if there is none) and stores its atom in *a.
+ *
+ * Due to the template<foo<bar>> stuff, '>>' may not be part of other
+ * operators, so '>>' and '>>=' are never returned (the parser reassembles
+ * them). The alphabetic ones (and, new, ...) are recognized as identifiers
+ * first (see alternative_token()).
+ */
+static inline size_t punctuator(const char *c, atom_t *a)
 {
-    for (const char *poop: poops)
+#define PUNCT(atom, length) do { *a = (atom); return (length); } while (0)
+
+    switch (c[0])
     {
-        if (!strncmp(*c, poop, strlen(poop)))
-        {
-            if (isidentifiernondigit(poop[strlen(poop) - 1]))
+        case '{': PUNCT(ATOM_LBRACE, 1);
+        case '}': PUNCT(ATOM_RBRACE, 1);
+        case '[': PUNCT(ATOM_LBRACKET, 1);
+        case ']': PUNCT(ATOM_RBRACKET, 1);
+        case '(': PUNCT(ATOM_LPAREN, 1);
+        case ')': PUNCT(ATOM_RPAREN, 1);
+        case ';': PUNCT(ATOM_SEMICOLON, 1);
+        case '?': PUNCT(ATOM_QUESTION, 1);
+        case '~': PUNCT(ATOM_TILDE, 1);
+        case ',': PUNCT(ATOM_COMMA, 1);
+
+        case '#':
+            if (c[1] == '#') PUNCT(ATOM_HASH_HASH, 2);
+            PUNCT(ATOM_HASH, 1);
+
+        case '<':
+            if (c[1] == '<')
             {
-                char next = (*c)[strlen(poop)];
-                if (isidentifiernondigit(next) || isdigit(next))
-                    continue;
+                if (c[2] == '=') PUNCT(ATOM_LSHIFT_ASSIGN, 3);
+                PUNCT(ATOM_LSHIFT, 2);
             }
+            if (c[1] == ':') PUNCT(ATOM_DIGRAPH_LBRACKET, 2);
+            if (c[1] == '%') PUNCT(ATOM_DIGRAPH_LBRACE, 2);
+            if (c[1] == '=') PUNCT(ATOM_LE, 2);
+            PUNCT(ATOM_LESS, 1);
+
+        case '>':
+            if (c[1] == '=') PUNCT(ATOM_GE, 2);
+            PUNCT(ATOM_GREATER, 1);
 
-            *c += strlen(poop);
+        case '%':
+            if (c[1] == ':')
+            {
+                if ((c[2] == '%') && (c[3] == ':')) PUNCT(ATOM_DIGRAPH_HASH_HASH, 4);
+                PUNCT(ATOM_DIGRAPH_HASH, 2);
+            }
+            if (c[1] == '>') PUNCT(ATOM_DIGRAPH_RBRACE, 2);
+            if (c[1] == '=') PUNCT(ATOM_PERCENT_ASSIGN, 2);
+            PUNCT(ATOM_PERCENT, 1);
+
+        case ':':
+            if (c[1] == '>') PUNCT(ATOM_DIGRAPH_RBRACKET, 2);
+            if (c[1] == ':') PUNCT(ATOM_SCOPE, 2);
+            PUNCT(ATOM_COLON, 1);
+
+        case '.':
+            if ((c[1] == '.') && (c[2] == '.')) PUNCT(ATOM_ELLIPSIS, 3);
+            if (c[1] == '*') PUNCT(ATOM_DOT_STAR, 2);
+            PUNCT(ATOM_DOT, 1);
+
+        case '-':
+            if (c[1] == '>')
+            {
+                if (c[2] == '*') PUNCT(ATOM_ARROW_STAR, 3);
+                PUNCT(ATOM_ARROW, 2);
+            }
+            if (c[1] == '=') PUNCT(ATOM_MINUS_ASSIGN, 2);
+            if (c[1] == '-') PUNCT(ATOM_MINUS_MINUS, 2);
+            PUNCT(ATOM_MINUS, 1);
+
+        case '+':
+            if (c[1] == '=') PUNCT(ATOM_PLUS_ASSIGN, 2);
+            if (c[1] == '+') PUNCT(ATOM_PLUS_PLUS, 2);
+            PUNCT(ATOM_PLUS, 1);
+
+        case '*':
+            if (c[1] == '=') PUNCT(ATOM_STAR_ASSIGN, 2);
+            PUNCT(ATOM_STAR, 1);
+
+        case '/':
+            if (c[1] == '=') PUNCT(ATOM_SLASH_ASSIGN, 2);
+            PUNCT(ATOM_SLASH, 1);
+
+        case '^':
+            if (c[1] == '=') PUNCT(ATOM_CARET_ASSIGN, 2);
+            PUNCT(ATOM_CARET, 1);
+
+        case '&':
+            if (c[1] == '=') PUNCT(ATOM_AMP_ASSIGN, 2);
+            if (c[1] == '&') PUNCT(ATOM_AMP_AMP, 2);
+            PUNCT(ATOM_AMP, 1);
+
+        case '|':
+            if (c[1] == '=') PUNCT(ATOM_PIPE_ASSIGN, 2);
+            if (c[1] == '|') PUNCT(ATOM_PIPE_PIPE, 2);
+            PUNCT(ATOM_PIPE, 1);
+
+        case '=':
+            if (c[1] == '=') PUNCT(ATOM_EQ, 2);
+            PUNCT(ATOM_ASSIGN, 1);
+
+        case '!':
+            if (c[1] == '=') PUNCT(ATOM_NE, 2);
+            PUNCT(ATOM_EXCLAIM, 1);
+    }
+
+#undef PUNCT
+
+    return 0;
+}
 
+
+/**
+ * Returns whether an identifier is actually an alphabetic
+ * preprocessing-op-or-punc.
+ */
+static inline bool alternative_token(atom_t a)
+{
+    switch (a)
+    {
+        case ATOM_NEW:    case ATOM_DELETE:
+        case ATOM_AND:    case ATOM_AND_EQ: case ATOM_BITAND: case ATOM_BITOR:
+        case ATOM_COMPL:  case ATOM_NOT:    case ATOM_NOT_EQ: case ATOM_OR:
+        case ATOM_OR_EQ:  case ATOM_XOR:    case ATOM_XOR_EQ:
             return true;
-        }
+
+        default:
+            return false;
     }
+}
+
+
+static inline bool isdigit_in(char c, bool hex)
+{
+    return ((c >= '0') && (c <= '9')) || (hex && ((c | 0x20) >= 'a') && ((c | 0x20) <= 'f'));
+}
+
 
-    return false;
+/**
+ * Value of a (hexadecimal) digit: letters are the only digits with bit 6 set,
+ * and their low nibble is 1 for a/A.
+ */
+static inline int digit_value(char c)
+{
+    return (c & 0xf) + 9 * ((c >> 6) & 1);
 }
 
 
-identifier_token::identifier_token(char *c):
-    token(token::IDENTIFIER, c)
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+/**
+ * Returns the value of the eight digits at c in the given base (SWAR: the
+ * digits are loaded into one 64 bit word and adjacent ones are combined
+ * pairwise, so no lane ever exceeds its width).
+ */
+static inline uint64_t eight_digits(const char *c, uint64_t base)
 {
-    value = c;
+    uint64_t x;
+    memcpy(&x, c, 8);
+
+    // Same as digit_value() for all eight bytes
+    x = (x & UINT64_C(0x0f0f0f0f0f0f0f0f)) + ((x >> 6) & UINT64_C(0x0101010101010101)) * 9;
+
+    x = (x * base + (x >> 8)) & UINT64_C(0x00ff00ff00ff00ff);
+    x = (x * (base * base) + (x >> 16)) & UINT64_C(0x0000ffff0000ffff);
+    x = (x * (base * base * base * base) + (x >> 32)) & UINT64_C(0x00000000ffffffff);
+
+    return x;
 }
+#endif
+
 
-lit_integer_token::lit_integer_token(char *c):
-    token(token::LIT_INTEGER, c)
+// Contribution of each suffix character to the integer_type, indexed by its
+// bit 4 (set for u/U, clear for l/L): u adds UNSIGNED, each l one step from
+// INT over LONG to LONG_LONG (tokenize() has already made sure the suffix is
+// valid)
+static const int suffix_type[2] = { lit_integer::LONG, lit_integer::UNSIGNED };
+
+// Greatest value representable in each integer_type (SIGNED_INT through
+// UNSIGNED_LONG_LONG)
+static const unsigned long long integer_type_max[] = {
+    TL_INT_MAX, TL_UINT_MAX, TL_LONG_MAX, TL_ULONG_MAX, TL_LLONG_MAX, TL_ULLONG_MAX
+};
+
+
+void lit_integer::decode(source_text s)
 {
-    int base;
+    const char *c = s.start, *end = s.start + s.length;
+    unsigned base;
 
     if (c[0] != '0')
         base = 10;
@@ -100,200 +274,334 @@ lit_integer_token::lit_integer_token(char *c):
         c += 2;
     }
 
-    char *suffix = c;
-    while (*suffix && (tolower(*suffix) != 'u') && (tolower(*suffix) != 'l'))
+    const char *suffix = c;
+    while ((suffix < end) && isdigit_in(*suffix, base == 0x10))
         suffix++;
 
-    bool is_unsigned = false;
-    int l_counter = 0;
+    int type = SIGNED_INT;
+    for (const char *sc = suffix; sc < end; sc++)
+        type += suffix_type[(*sc >> 4) & 1];
 
-    for (int i = 0; suffix[i]; i++)
-        if (tolower(suffix[i] == 'u'))
-            is_unsigned = true;
-        else
-            l_counter++; // XXX: assert(tolower(suffix[i] == 'l'))
+    unsigned long long v = 0;
+    bool overflow = false;
 
-retry:
-    if (is_unsigned)
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    unsigned long long base_pow8 = base * base * base * base;
+    base_pow8 *= base_pow8;
+
+    for (; suffix - c >= 8; c += 8)
     {
-        value.u = 0;
+        overflow |= __builtin_mul_overflow(v, base_pow8, &v);
+        overflow |= __builtin_add_overflow(v, eight_digits(c, base), &v);
+    }
+#endif
 
-        while (c != suffix)
-        {
-            unsigned long long new_value = value.u * base;
-            if (new_value / base != value.u)
-                throw format("Unsigned integer literal is too big");
-            value.u = new_value;
+    for (; c < suffix; c++)
+    {
+        overflow |= __builtin_mul_overflow(v, base, &v);
+        overflow |= __builtin_add_overflow(v, digit_value(*c), &v);
+    }
 
-            char d = tolower(*(c++));
-            value.u += (d > '9') ? (d - 'a' + 10) : (d - '0');
-        }
+    // Table 6 in 2.14.2: the type is the first one from the suffix's
+    // onwards which can represent the value. Decimal literals keep their
+    // signedness, octal and hexadecimal ones without u try the unsigned
+    // variant of each size as well.
+    bool keep_signedness = (base == 10) || (type & UNSIGNED);
+    int step = keep_signedness ? 2 : 1;
+
+    while ((type <= UNSIGNED_LONG_LONG) && (v > integer_type_max[type]))
+        type += step;
 
-        subtype = UNSIGNED;
+    if (overflow || (type > UNSIGNED_LONG_LONG))
+    {
+        if ((base == 10) && !(type & UNSIGNED))
+            throw format("Signed decimal integer literal is too big");
+        else
+            throw format("Unsigned integer literal is too big");
     }
+
+    subtype = static_cast<integer_type>(type);
+    value.u = v;
+    decoded = true;
+}
+
+
+#include "powers-of-five.cxx"
+
+
+// Parameters of the IEEE 754 formats converted by eisel_lemire()
+template<typename T> struct binary_format;
+
+template<> struct binary_format<float>
+{
+    typedef uint32_t bits_t;
+    static const int mantissa_bits = 23, minimum_exponent = -127, infinite_power = 0xff;
+    static const int smallest_power_of_ten = -65, largest_power_of_ten = 38;
+    static const int min_round_to_even = -17, max_round_to_even = 10;
+};
+
+template<> struct binary_format<double>
+{
+    typedef uint64_t bits_t;
+    static const int mantissa_bits = 52, minimum_exponent = -1023, infinite_power = 0x7ff;
+    static const int smallest_power_of_ten = -342, largest_power_of_ten = 308;
+    static const int min_round_to_even = -4, max_round_to_even = 23;
+};
+
+
+/**
+ * Returns w * 10^q, correctly rounded (Eisel-Lemire algorithm: w is
+ * multiplied by a 128 bit approximation of 5^q, which is always precise
+ * enough to decide the rounding; see Mushtak and Lemire, "Fast number parsing
+ * without fallback").
+ */
+template<typename T> static T eisel_lemire(uint64_t w, int q)
+{
+    typedef binary_format<T> fmt;
+    uint64_t bits;
+
+    if (!w || (q < fmt::smallest_power_of_ten))
+        bits = 0;
+    else if (q > fmt::largest_power_of_ten)
+        bits = static_cast<uint64_t>(fmt::infinite_power) << fmt::mantissa_bits;
     else
     {
-        value.s = 0;
-        char *restart_c = c;
+        int lz = __builtin_clzll(w);
+        w <<= lz;
 
-        while (c != suffix)
+        // The low half of the table entry is only needed if the high half
+        // leaves the bits that matter for rounding undecided
+        unsigned __int128 product = static_cast<unsigned __int128>(w) * powers_of_five[q - smallest_power_of_five].high;
+        uint64_t high = product >> 64, low = product;
+
+        const uint64_t precision_mask = UINT64_MAX >> (fmt::mantissa_bits + 3);
+        if ((high & precision_mask) == precision_mask)
         {
-            long long new_value = value.s * base;
-            if (new_value / base != value.s)
+            uint64_t second = (static_cast<unsigned __int128>(w) * powers_of_five[q - smallest_power_of_five].low) >> 64;
+            low += second;
+            high += (second > low);
+        }
+
+        int upper_bit = high >> 63;
+        int shift = upper_bit + 64 - fmt::mantissa_bits - 3;
+        uint64_t mantissa = high >> shift;
+        // floor(log2(10^q)) + 63 and the bias
+        int power2 = (((152170 + 65536) * q) >> 16) + 63 + upper_bit - lz - fmt::minimum_exponent;
+
+        if (power2 <= 0)
+        {
+            // Subnormal (or zero)
+            if (-power2 + 1 >= 64)
+                bits = 0;
+            else
             {
-                if (base == 10)
-                {
-                    // lol no unsigned for you (see below)
-                    throw format("Signed decimal integer literal is too big");
-                }
+                mantissa >>= -power2 + 1;
+                mantissa += mantissa & 1;
+                mantissa >>= 1;
+                // Rounding may have produced the smallest normal number
+                power2 = (mantissa < (UINT64_C(1) << fmt::mantissa_bits)) ? 0 : 1;
+                bits = mantissa | (static_cast<uint64_t>(power2) << fmt::mantissa_bits);
+            }
+        }
+        else
+        {
+            // Exactly halfway between two values: round to even
+            if ((low <= 1) && (q >= fmt::min_round_to_even) && (q <= fmt::max_round_to_even) &&
+                ((mantissa & 3) == 1) && ((mantissa << shift) == high))
+            {
+                mantissa &= ~UINT64_C(1);
+            }
 
-                is_unsigned = true;
-                c = restart_c;
-                // I'm so very sorry
-                goto retry;
+            mantissa += mantissa & 1;
+            mantissa >>= 1;
+
+            if (mantissa >= (UINT64_C(2) << fmt::mantissa_bits))
+            {
+                mantissa = UINT64_C(1) << fmt::mantissa_bits;
+                power2++;
             }
-            value.s = new_value;
 
-            char d = tolower(*(c++));
-            value.s += (d > '9') ? (d - 'a' + 10) : (d - '0');
-        }
+            mantissa &= ~(UINT64_C(1) << fmt::mantissa_bits);
 
-        subtype = SIGNED;
+            if (power2 >= fmt::infinite_power)
+                bits = static_cast<uint64_t>(fmt::infinite_power) << fmt::mantissa_bits;
+            else
+                bits = mantissa | (static_cast<uint64_t>(power2) << fmt::mantissa_bits);
+        }
     }
 
-    switch (l_counter)
-    {
-        case 0: subtype = static_cast<integer_type>(subtype | INT      ); break;
-        case 1: subtype = static_cast<integer_type>(subtype | LONG     ); break;
-        case 2: subtype = static_cast<integer_type>(subtype | LONG_LONG); break;
-    }
+    typename fmt::bits_t narrow_bits = bits;
+    T result;
+    memcpy(&result, &narrow_bits, sizeof(result));
+    return result;
+}
 
-    // promotions for everynyan! (lol this is crazy see table 6 in 2.14.2 for reference)
-    if (base == 10)
-    {
-        // keep signedness for decimal constants (lol why)
-        if ((subtype == SIGNED_INT) && ((value.s < TL_INT_MIN) || (value.s > TL_INT_MAX)))
-            subtype = SIGNED_LONG;
-        if ((subtype == UNSIGNED_INT) && (value.u > TL_UINT_MAX))
-            subtype = UNSIGNED_LONG;
-        if ((subtype == SIGNED_LONG) && ((value.s < TL_LONG_MIN) || (value.s < TL_LONG_MAX)))
-            subtype = SIGNED_LONG_LONG;
-        if ((subtype == UNSIGNED_LONG) && (value.u > TL_ULONG_MAX))
-            subtype = UNSIGNED_LONG_LONG;
-    }
-    else
+
+// Exact powers of ten (10^27 still fits into a 64 bit mantissa)
+static const long double exact_powers_of_ten[] = {
+    1e0L,  1e1L,  1e2L,  1e3L,  1e4L,  1e5L,  1e6L,  1e7L,  1e8L,  1e9L,
+    1e10L, 1e11L, 1e12L, 1e13L, 1e14L, 1e15L, 1e16L, 1e17L, 1e18L, 1e19L,
+    1e20L, 1e21L, 1e22L, 1e23L, 1e24L, 1e25L, 1e26L, 1e27L
+};
+
+
+/**
+ * Stores w * 10^q, correctly rounded, in *result. This is done exactly
+ * through float and double arithmetic; for long double, only if both w and
+ * the power of ten are exactly representable, so that a single
+ * multiplication or division rounds correctly (Clinger's fast path).
+ * Returns false if the result could not be computed.
+ */
+static inline bool convert_decimal(uint64_t w, int q, float *result)
+{
+    *result = eisel_lemire<float>(w, q);
+    return true;
+}
+
+static inline bool convert_decimal(uint64_t w, int q, double *result)
+{
+    *result = eisel_lemire<double>(w, q);
+    return true;
+}
+
+static inline bool convert_decimal(uint64_t w, int q, long double *result)
+{
+    static const int mant_digits = std::numeric_limits<long double>::digits;
+    // Greatest k for which 5^k (and thus 10^k) is exact: k * log2(5) < digits
+    static const int max_exact_power = (mant_digits * 1000 / 2322 < 27) ? (mant_digits * 1000 / 2322) : 27;
+
+    if (((mant_digits < 64) && (w > (UINT64_C(1) << (mant_digits & 63)))) ||
+        (q < -max_exact_power) || (q > max_exact_power))
     {
-        // this seems more logical (BUT WHY WOULD YOU DO DECIMAL DIFFERENTLY):
-        // if u/U, always unsigned; if signed, make unsigned, if necessary
-        if ((subtype == SIGNED_INT) && (value.s < TL_INT_MIN))
-            subtype = SIGNED_LONG;
-        if ((subtype == SIGNED_INT) && (value.s > TL_INT_MAX))
-            subtype = UNSIGNED_INT;
-        if ((subtype == UNSIGNED_INT) && (value.u > TL_UINT_MAX))
-            subtype = is_unsigned ? UNSIGNED_LONG : SIGNED_LONG;
-        if ((subtype == SIGNED_LONG) && (value.s < TL_LONG_MIN))
-            subtype = SIGNED_LONG_LONG;
-        if ((subtype == SIGNED_LONG) && (value.s > TL_LONG_MAX))
-            subtype = UNSIGNED_LONG;
-        if ((subtype == UNSIGNED_LONG) && (value.u > TL_ULONG_MAX))
-            subtype = is_unsigned ? UNSIGNED_LONG_LONG : SIGNED_LONG_LONG;
-
-        // and whether it's signed or unsigned long long, that's already been decided
+        return false;
     }
+
+    long double power = exact_powers_of_ten[q < 0 ? -q : q];
+    *result = (q < 0) ? w / power : w * power;
+    return true;
 }
 
-lit_float_token::lit_float_token(char *c):
-    token(token::LIT_FLOAT, c)
+
+static inline void convert_slow(const char *str, float *result)       { *result = strtof(str, nullptr); }
+static inline void convert_slow(const char *str, double *result)      { *result = strtod(str, nullptr); }
+static inline void convert_slow(const char *str, long double *result) { *result = strtold(str, nullptr); }
+
+
+/**
+ * Converts a floating point literal to T, correctly rounded.
+ *
+ * Decimal literals go through convert_decimal(). If the significand has more
+ * digits than fit into 64 bit, the result is only taken if truncating and
+ * rounding up the significand give the same value. Hexadecimal literals only
+ * need scaling by a power of two as long as the significand fits into T.
+ * Everything else falls back to the C library's (correctly rounding,
+ * arbitrary precision) conversion.
+ */
+template<typename T> static T convert_float(source_text s)
 {
-    bool is_hex = (c[0] == '0') && (tolower(c[1] == 'x'));
+    const char *c = s.start, *end = s.start + s.length;
+    bool is_hex = (c[0] == '0') && (tolower(c[1]) == 'x');
+    int base = is_hex ? 0x10 : 10;
+    // Significand digits beyond what fits into 64 bit are dropped
+    int max_digits = is_hex ? 16 : 19;
 
     if (is_hex)
         c += 2;
 
-    // The maximum mantissa (80 bit) is 63 bit, so we're fine with 64 bit.
-    uint64_t int_part = 0;
-    int leftover_exponent = 0;
-    int base = is_hex ? 0x10 : 10;
+    uint64_t significand = 0;
+    int digits = 0, exponent = 0;
+    bool truncated = false;
 
-    while (*c != '.')
+    for (; (c < end) && isdigit_in(*c, is_hex); c++)
     {
-        uint64_t mult = int_part * base;
-        if (mult / base != int_part)
+        if (digits < max_digits)
         {
-            // Just leave the rest, we can't store it in the float anyway, so who cares.
-            leftover_exponent++;
-            continue;
+            significand = significand * base + digit_value(*c);
+            digits += (significand != 0);
+        }
+        else
+        {
+            exponent++;
+            truncated |= (*c != '0');
         }
-
-        int_part = mult;
-        int_part += (*c > '9') ? (tolower(*c) - 'a' + 10) : (*c - '0');
-        c++;
     }
 
-    c++;
-
-    uint64_t frac_part = 0;
-    int frac_exponent = 0;
+    if ((c < end) && (*c == '.'))
+        c++;
 
-    while ((is_hex ? isxdigit : isdigit)(*c))
+    for (; (c < end) && isdigit_in(*c, is_hex); c++)
     {
-        uint64_t mult = frac_part * base;
-        if (mult / base != frac_part)
-            continue;
-
-        frac_part = mult;
-        frac_part += (*c > '9') ? (tolower(*c) - 'a' + 10) : (*c - '0');
-        frac_exponent--;
-        c++;
+        if (digits < max_digits)
+        {
+            significand = significand * base + digit_value(*c);
+            digits += (significand != 0);
+            exponent--;
+        }
+        else
+            truncated |= (*c != '0');
     }
 
-    int number_exponent = 0;
+    // Hexadecimal exponents are binary
+    if (is_hex)
+        exponent *= 4;
 
-    if ((is_hex && (tolower(*c) == 'p')) ||
-       (!is_hex && (tolower(*c) == 'e')))
+    if ((c < end) && (tolower(*c) == (is_hex ? 'p' : 'e')))
     {
         bool negative = (*++c == '-');
         if ((*c == '-') || (*c == '+'))
             c++;
 
-        while (isdigit(*c))
-        {
-            number_exponent *= 10;
-            number_exponent += *c - '0';
-            c++;
-        }
+        int number_exponent = 0;
+        for (; (c < end) && isdigit_in(*c, false); c++)
+            if (number_exponent < 100000)
+                number_exponent = number_exponent * 10 + (*c - '0');
 
-        if (negative)
-            number_exponent *= -1;
+        exponent += negative ? -number_exponent : number_exponent;
     }
 
-    // I'm frigging lazy (for hex, it'd probably be relatively easy, but for dec...)
+    if (!significand && !truncated)
+        return 0;
+
+    T result;
+
     if (is_hex)
-        value = (int_part * exp2l(leftover_exponent * 4) + frac_part * exp2l(frac_exponent * 4)) * exp2l(number_exponent /* this exponent is binary */);
-    else
-        value = (int_part * exp10l(leftover_exponent) + frac_part * exp10l(frac_exponent)) * exp10l(number_exponent);
-
-    if (tolower(*c) == 'f')
-        subtype = FLOAT;
-    else if (tolower(*c) == 'l')
-        subtype = LONG_DOUBLE;
-    else if (!*c)
-        subtype = DOUBLE;
+    {
+        if (!truncated && (64 - __builtin_clzll(significand) <= std::numeric_limits<T>::digits))
+            return std::ldexp(static_cast<T>(significand), exponent);
+    }
+    else if (!truncated)
+    {
+        if (convert_decimal(significand, exponent, &result))
+            return result;
+    }
     else
-        throw format("Unknown floating point literal suffix %s", c);
-}
+    {
+        T rounded_up;
+        if (convert_decimal(significand, exponent, &result) &&
+            convert_decimal(significand + 1, exponent, &rounded_up) &&
+            (result == rounded_up))
+        {
+            return result;
+        }
+    }
 
-lit_bool_token::lit_bool_token(char *c):
-    token(token::LIT_BOOL, c)
-{
-    value = !strcmp(c, "true");
+    std::string spelling(s.start, s.length);
+    convert_slow(spelling.c_str(), &result);
+    return result;
 }
 
-lit_pointer_token::lit_pointer_token(char *c):
-    token(token::LIT_POINTER, c)
+
+// The subtype has already been set by tokenize()
+void lit_float::decode(source_text s)
 {
-    assert(!strcmp(c, "nullptr"));
-    value = NULL;
+    switch (subtype)
+    {
+        case FLOAT:       value = convert_float<float>(s);       break;
+        case DOUBLE:      value = convert_float<double>(s);      break;
+        case LONG_DOUBLE: value = convert_float<long double>(s); break;
+    }
+
+    decoded = true;
 }
 
 static inline char eseq(const char **seq)
@@ -344,117 +652,456 @@ static inline char eseq(const char **seq)
     throw format("Invalid escape sequence starting with '%c'", **seq);
 }
 
-lit_string_token::lit_string_token(char *c):
-    token(token::LIT_STRING, c)
+int token_stream::line(token_index i) const
+{
+    size_t l = std::upper_bound(line_offsets.begin(), line_offsets.end(), offsets[i]) - line_offsets.begin();
+    return line_numbers[l - 1];
+}
+
+int token_stream::column(token_index i) const
+{
+    size_t l = std::upper_bound(line_offsets.begin(), line_offsets.end(), offsets[i]) - line_offsets.begin();
+    return offsets[i] - line_offsets[l - 1] + 1;
+}
+
+const token_file *token_stream::file(token_index i) const
+{
+    if (files.empty())
+        return nullptr;
+
+    auto f = std::upper_bound(files.begin(), files.end(), offsets[i],
+                              [](uint32_t offset, const token_file &tf) { return offset < tf.offset; });
+    return &f[-1];
+}
+
+// The escape sequences have already been checked by tokenize()
+size_t token_stream::string_length(token_index i) const
 {
-    char *tmp = ++c;
-    length = 0;
+    const char *c = source + offsets[i] + 1;
+    size_t len = 0;
 
-    while (*tmp != '"')
+    while (*c != '"')
     {
-        if (*(tmp++) == '\\')
-            eseq(const_cast<const char **>(&tmp));
+        if (*(c++) == '\\')
+            eseq(&c);
 
-        length++;
+        len++;
     }
 
-    value = new char[length];
-    char *vp = value;
+    return len;
+}
+
+void token_stream::decode_string(token_index i, char *buffer) const
+{
+    const char *c = source + offsets[i] + 1;
 
     while (*c != '"')
     {
-        if (*(c++) == '\\')
-            *(vp++) = eseq(const_cast<const char **>(&c));
+        if (*c == '\\')
+        {
+            c++;
+            *(buffer++) = eseq(&c);
+        }
+        else
+            *(buffer++) = *(c++);
     }
 }
 
-lit_char_token::lit_char_token(char *c):
-    token(token::LIT_CHAR, c)
+bool token_stream::string_is(token_index i, const char *s) const
 {
+    const char *c = source + offsets[i] + 1;
+
+    while (*c != '"')
+    {
+        char ch;
+        if (*c == '\\')
+        {
+            c++;
+            ch = eseq(&c);
+        }
+        else
+            ch = *(c++);
+
+        if (!*s || (ch != *(s++)))
+            return false;
+    }
+
+    return !*s;
+}
+
+const lit_integer &token_stream::integer_value(token_index i) const
+{
+    lit_integer &li = integers[atoms[i] & ~LITERAL_VALUE];
+    if (!li.decoded)
+        li.decode(spelling(i));
+    return li;
+}
+
+const lit_float &token_stream::float_value(token_index i) const
+{
+    lit_float &lf = floats[atoms[i] & ~LITERAL_VALUE];
+    if (!lf.decoded)
+        lf.decode(spelling(i));
+    return lf;
+}
+
+// Cheap enough to not be worth caching
+unsigned token_stream::char_value(token_index i) const
+{
+    const char *c = source + offsets[i];
+
     if (*++c != '\\')
-        value = *c;
-    else
+        return *c;
+
+    c++;
+    return eseq(&c);
+}
+
+void token_stream::push(token::token_type t, atom_t a, const char *start, size_t length)
+{
+    types.push_back(t);
+    atoms.push_back(a);
+    offsets.push_back(start - source);
+    lengths.push_back(length);
+}
+
+void token_stream::append(const token_stream &next)
+{
+    size_t first = size();
+    atom_t integer_base = integers.size(), float_base = floats.size();
+
+    types.insert(types.end(), next.types.begin(), next.types.end());
+    atoms.insert(atoms.end(), next.atoms.begin(), next.atoms.end());
+    offsets.insert(offsets.end(), next.offsets.begin(), next.offsets.end());
+    lengths.insert(lengths.end(), next.lengths.begin(), next.lengths.end());
+
+    // Literals refer to next's value tables, which go after ours
+    if (!next.integers.empty() || !next.floats.empty())
     {
-        c++;
-        value = eseq(const_cast<const char **>(&c));
+        integers.insert(integers.end(), next.integers.begin(), next.integers.end());
+        floats.insert(floats.end(), next.floats.begin(), next.floats.end());
+
+        for (size_t i = first; i < types.size(); i++)
+        {
+            if (types[i] == token::LIT_INTEGER)
+                atoms[i] += integer_base;
+            else if (types[i] == token::LIT_FLOAT)
+                atoms[i] += float_base;
+        }
+    }
+
+    // next may start in the line we end in
+    size_t l = (!line_numbers.empty() && !next.line_numbers.empty() && (next.line_numbers[0] == line_numbers.back())) ? 1 : 0;
+    line_numbers.insert(line_numbers.end(), next.line_numbers.begin() + l, next.line_numbers.end());
+    line_offsets.insert(line_offsets.end(), next.line_offsets.begin() + l, next.line_offsets.end());
+}
+
+size_t token_stream::bytes_used(void) const
+{
+    return types.capacity() * sizeof(types[0]) + atoms.capacity() * sizeof(atoms[0]) +
+           offsets.capacity() * sizeof(offsets[0]) + lengths.capacity() * sizeof(lengths[0]) +
+           line_numbers.capacity() * sizeof(line_numbers[0]) + line_offsets.capacity() * sizeof(line_offsets[0]) +
+           integers.capacity() * sizeof(integers[0]) + floats.capacity() * sizeof(floats[0]);
+}
+
+
+token_source::token_source(const char *src):
+    tokens(src), position(src), position_line_start(src), end(src + strlen(src)), position_line(1)
+{
+    // Rough guess to avoid most reallocations
+    size_t expected = (end - src) / 4;
+    tokens.types.reserve(expected);
+    tokens.atoms.reserve(expected);
+    tokens.offsets.reserve(expected);
+    tokens.lengths.reserve(expected);
+
+    pipeline = nullptr;
+    directives = nullptr;
+    failures = nullptr;
+    in_directive = false;
+    directive_line = 0;
+}
+
+
+token_source::token_source(const char *src, std::vector<directive_range> *directive_list,
+                           std::vector<tokenize_failure> *failure_list):
+    token_source(src)
+{
+    directives = directive_list;
+    failures = failure_list;
+}
+
+
+// Tokens per batch handed over by a pipelined token_source's producer
+static const token_index PIPELINE_BATCH = 4096;
+
+
+/**
+ * Lock-free single-producer/single-consumer queue of token batches between a
+ * pipelined token_source's thread and its consumer. Either side only waits
+ * (yielding the CPU) if the queue is empty or full, respectively.
+ */
+struct token_pipeline
+{
+    static const size_t SLOTS = 16;
+
+    token_stream *slots[SLOTS];
+    // Slots are filled at tail and emptied at head (both only ever grow)
+    std::atomic<size_t> head, tail;
+
+    // Set by the producer once it has queued its last batch; failure is the
+    // error it stopped at (if any)
+    std::atomic<bool> done;
+    error *failure;
+
+    // Set by the consumer to make the producer give up
+    std::atomic<bool> stop;
+
+    std::thread producer;
+
+
+    token_pipeline(void): head(0), tail(0), done(false), failure(nullptr), stop(false) {}
+
+    bool push(token_stream *batch);
+    token_stream *pop(void);
+};
+
+
+/**
+ * Queues a batch. Returns false (without taking it) if the consumer has
+ * given up.
+ */
+bool token_pipeline::push(token_stream *batch)
+{
+    size_t t = tail.load(std::memory_order_relaxed);
+
+    while (t - head.load(std::memory_order_acquire) == SLOTS)
+    {
+        if (stop.load(std::memory_order_relaxed))
+            return false;
+        std::this_thread::yield();
     }
+
+    slots[t % SLOTS] = batch;
+    tail.store(t + 1, std::memory_order_release);
+
+    return true;
 }
 
-operator_token::operator_token(char *c):
-    token(token::OPERATOR, c)
+
+/**
+ * Takes the next batch, waiting for it if necessary. Returns nullptr once
+ * the producer is done and all batches have been taken.
+ */
+token_stream *token_pipeline::pop(void)
 {
-    value = c;
+    size_t h = head.load(std::memory_order_relaxed);
+
+    while (tail.load(std::memory_order_acquire) == h)
+    {
+        // All batches are queued before done is set
+        if (done.load(std::memory_order_acquire) && (tail.load(std::memory_order_acquire) == h))
+            return nullptr;
+        std::this_thread::yield();
+    }
+
+    token_stream *batch = slots[h % SLOTS];
+    head.store(h + 1, std::memory_order_release);
+
+    return batch;
 }
 
 
-std::vector<token *> tokenize(const char *str)
+void token_source::run_pipelined(void)
 {
-    std::vector<token *> ret;
-    const char *line_start = str;
-    int line = 1;
+    pipeline = new token_pipeline;
+    pipeline->producer = std::thread(&token_source::run_producer, this);
+}
+
+
+/**
+ * Producer thread: tokenizes everything after what the consumer already has
+ * (the tokenizer position is only touched here from now on).
+ */
+void token_source::run_producer(void)
+{
+    for (;;)
+    {
+        token_stream *batch = new token_stream(tokens.source);
+        batch->types.reserve(PIPELINE_BATCH);
+        batch->atoms.reserve(PIPELINE_BATCH);
+        batch->offsets.reserve(PIPELINE_BATCH);
+        batch->lengths.reserve(PIPELINE_BATCH);
+
+        try
+        {
+            tokenize_into(*batch, PIPELINE_BATCH - 1);
+        }
+        catch (error *err)
+        {
+            // The tokens before the error are still valid
+            pipeline->failure = err;
+        }
+
+        if (!batch->size())
+            delete batch;
+        else if (!pipeline->push(batch))
+        {
+            delete batch;
+            break;
+        }
+
+        if (pipeline->failure || !*position)
+            break;
+    }
+
+    pipeline->done.store(true, std::memory_order_release);
+}
+
+
+/**
+ * Appends batches from the producer until token i exists or the producer is
+ * done.
+ */
+bool token_source::receive(token_index i)
+{
+    while (tokens.size() <= i)
+    {
+        token_stream *batch = pipeline->pop();
+
+        if (!batch)
+        {
+            // Throw a copy, so that asking again fails again
+            if (pipeline->failure)
+                throw new error(pipeline->failure->line, pipeline->failure->column, format("%s", pipeline->failure->msg));
+            return false;
+        }
+
+        tokens.append(*batch);
+        delete batch;
+    }
+
+    return true;
+}
+
+
+bool token_source::exhausted(void) const
+{
+    if (!pipeline)
+        return !*position;
+
+    // Not everything may have been handed over yet
+    return pipeline->done.load(std::memory_order_acquire) && !pipeline->failure &&
+           (pipeline->head.load(std::memory_order_relaxed) == pipeline->tail.load(std::memory_order_acquire));
+}
+
+
+token_source::~token_source(void)
+{
+    if (!pipeline)
+        return;
+
+    pipeline->stop.store(true, std::memory_order_relaxed);
+    pipeline->producer.join();
+
+    for (size_t h = pipeline->head; h != pipeline->tail; h++)
+        delete pipeline->slots[h % token_pipeline::SLOTS];
+
+    delete pipeline->failure;
+    delete pipeline;
+}
+
+
+/**
+ * Skips from p to the end of its line, and of the lines it is continued on by
+ * a backslash at their end.
+ */
+static const char *continued_line_end(const char *p, const char *end, int *line, const char **line_start)
+{
+    for (;;)
+    {
+        p = scan->line_end(p, end);
+        const char *e = ((p > *line_start) && (p[-1] == '\r')) ? p - 1 : p;
+        if (!*p || (e == *line_start) || (e[-1] != '\\'))
+            return p;
+
+        *line_start = ++p;
+        (*line)++;
+    }
+}
+
+
+/**
+ * Appends tokens to ret until token i exists there or the input is exhausted.
+ * Returns false if it has skipped the rest of a line it could not tokenize
+ * instead (only if failures are recorded), and has to be called again.
+ */
+bool token_source::tokenize_into(token_stream &ret, token_index i)
+{
+    const char *str = position, *line_start = position_line_start;
+    const char *start = str;
+    int line = position_line;
 
     try
     {
-        while (*str)
+        while (*str && (ret.size() <= i))
         {
-            while (*str && isspace(*str))
+            str = skip_whitespace(str, &line, &line_start);
+
+            // A directive ends with its line
+            if (in_directive && (line != directive_line))
             {
-                if (*(str++) == '\n')
-                {
-                    line++;
-                    line_start = str;
-                }
+                directives->back().end = ret.size();
+                in_directive = false;
             }
 
             if (!*str)
                 break;
 
-            token *t = NULL;
-            const char *start = str, *tmp = str;
-            int column = str - line_start + 1;
+            start = str;
+            token::token_type type;
+            atom_t atom;
+            size_t length;
 
 
             if ((str[0] == '/') && (str[1] == '/'))
-                while (*str && (*str != '\n'))
-                    str++;
+            {
+                str = scan->line_end(str, end);
+                continue;
+            }
             else if ((str[0] == '/') && (str[1] == '*'))
             {
-                str += 2;
-                while (*str && ((str[-2] != '*') || (str[-1] != '/')))
-                {
-                    if (*(str++) == '\n')
-                    {
-                        line++;
-                        line_start = str;
-                    }
-                }
+                str = scan->block_comment_end(str + 2, end, &line, &line_start);
+                // Comments are just whitespace, even in directives
+                if (in_directive)
+                    directive_line = line;
+                continue;
             }
-            else if (ispoop(&tmp))
+            else if ((length = punctuator(str, &atom)) > 0)
             {
-                str = tmp;
-
-                char *content = new char[str - start + 1];
-                memcpy(content, start, str - start);
-                content[str - start] = 0;
-
-                t = new operator_token(content);
+                str += length;
+                type = token::OPERATOR;
             }
             else if (isidentifiernondigit(*str))
             {
-                do
-                    str++;
-                while (isidentifiernondigit(*str) || isdigit(*str));
+                str = identifier_end(str + 1);
 
-                char *content = new char[str - start + 1];
-                memcpy(content, start, str - start);
-                content[str - start] = 0;
+                atom = intern(start, str - start);
 
-                if (!strcmp(content, "false") || !strcmp(content, "true"))
-                    t = new lit_bool_token(content);
-                else if (!strcmp(content, "nullptr"))
-                    t = new lit_pointer_token(content);
+                if ((atom == ATOM_FALSE) || (atom == ATOM_TRUE))
+                {
+                    type = token::LIT_BOOL;
+                    atom = ATOM_NONE;
+                }
+                else if (atom == ATOM_NULLPTR)
+                {
+                    type = token::LIT_POINTER;
+                    atom = ATOM_NONE;
+                }
+                else if (alternative_token(atom))
+                    type = token::OPERATOR;
                 else
-                    t = new identifier_token(content);
+                    type = token::IDENTIFIER;
             }
             else if (isdigit(*str) || ((str[0] == '.') && isdigit(str[1])))
             {
@@ -478,10 +1125,12 @@ std::vector<token *> tokenize(const char *str)
                     while ((is_hex ? isxdigit : isdigit)(*++str));
                 }
 
-                if (is_float &&
-                    ((is_hex && (tolower(*str) == 'p')) ||
-                    (!is_hex && (tolower(*str) == 'e'))))
+                // An exponent alone makes a floating point literal as well
+                // (1e23, 0x1p4)
+                if ((is_hex && (tolower(*str) == 'p')) ||
+                    (!is_hex && (tolower(*str) == 'e')))
                 {
+                    is_float = true;
                     str++;
                     if ((*str == '-') || (*str == '+'))
                         str++;
@@ -493,10 +1142,20 @@ std::vector<token *> tokenize(const char *str)
                         str++;
                 }
 
+                lit_float::float_type float_subtype = lit_float::DOUBLE;
+
                 if (is_float)
                 {
-                    if ((tolower(*str) == 'f') || (tolower(*str) == 'l'))
+                    if (tolower(*str) == 'f')
+                    {
+                        float_subtype = lit_float::FLOAT;
                         str++;
+                    }
+                    else if (tolower(*str) == 'l')
+                    {
+                        float_subtype = lit_float::LONG_DOUBLE;
+                        str++;
+                    }
                 }
                 else
                 {
@@ -516,47 +1175,60 @@ std::vector<token *> tokenize(const char *str)
                         str++;
                 }
 
-                char *content = new char[str - start + 1];
-                memcpy(content, start, str - start);
-                content[str - start] = 0;
-
+                // Values are decoded on first access; only integer literals
+                // with more than 16 characters can be too big, so those are
+                // decoded (and checked) right away.
                 if (is_float)
-                    t = new lit_float_token(content);
+                {
+                    type = token::LIT_FLOAT;
+                    atom = ret.floats.size() | token_stream::LITERAL_VALUE;
+                    ret.floats.emplace_back(float_subtype);
+                }
                 else
-                    t = new lit_integer_token(content);
+                {
+                    type = token::LIT_INTEGER;
+                    atom = ret.integers.size() | token_stream::LITERAL_VALUE;
+                    ret.integers.emplace_back();
+
+                    if (str - start > 16)
+                        ret.integers.back().decode({start, static_cast<size_t>(str - start)});
+                }
             }
             else if (*str == '"')
             {
                 str++;
-                while (*str && (*str != '"'))
+                while (*(str = scan->string_stop(str, end)) == '\\')
                 {
-                    if ((*(str++) == '\\'))
+                    str++;
+                    try
+                    {
+                        eseq(&str);
+                    }
+                    catch (char *msg)
                     {
-                        try
-                        {
-                            eseq(&str);
-                        }
-                        catch (char *msg)
-                        {
-                            char *reformatted = format("Invalid escape sequence: %s", msg);
-                            delete msg;
-                            throw reformatted;
-                        }
+                        char *reformatted = format("Invalid escape sequence: %s", msg);
+                        delete msg;
+                        throw reformatted;
                     }
                 }
-                str++;
 
-                char *content = new char[str - start + 1];
-                memcpy(content, start, str - start);
-                content[str - start] = 0;
+                // In files for the preprocessor, a string must not swallow
+                // the directives on the following lines
+                if (!*str || (directives && memchr(start, '\n', str - start)))
+                    throw format("Unterminated string literal");
+
+                str++;
 
-                t = new lit_string_token(content);
+                type = token::LIT_STRING;
+                atom = ATOM_NONE;
             }
             else if (*str == '\'')
             {
                 try
                 {
                     str++;
+                    if (!*str || (*str == '\n'))
+                        throw format("End of character sequence expected");
                     if (*(str++) == '\\')
                         eseq(&str);
                 }
@@ -572,28 +1244,125 @@ std::vector<token *> tokenize(const char *str)
 
                 str++;
 
-                char *content = new char[str - start + 1];
-                memcpy(content, start, str - start);
-                content[str - start] = 0;
-
-                t = new lit_char_token(content);
+                type = token::LIT_CHAR;
+                atom = ATOM_NONE;
+            }
+            else if (directives && (*str == '\\'))
+            {
+                // A backslash at the end of a line splices it with the next
+                const char *c = str + 1;
+                while ((*c == ' ') || (*c == '\t') || (*c == '\r'))
+                    c++;
+
+                if (*c != '\n')
+                    throw format("Could not parse character");
+
+                str = line_start = c + 1;
+                line++;
+                if (in_directive)
+                    directive_line = line;
+                continue;
             }
             else
                 throw format("Could not parse character");
 
-            if (t)
+            bool first_in_line = ret.line_numbers.empty() || (ret.line_numbers.back() != line);
+
+            if (directives && !in_directive && first_in_line && (type == token::OPERATOR) &&
+                ((atom == ATOM_HASH) || (atom == ATOM_DIGRAPH_HASH)))
+            {
+                directives->push_back({static_cast<token_index>(ret.size()), 0});
+                in_directive = true;
+                directive_line = line;
+            }
+
+            if (first_in_line)
             {
-                t->line = line;
-                t->column = column;
-                ret.push_back(t);
+                ret.line_numbers.push_back(line);
+                ret.line_offsets.push_back(line_start - ret.source);
             }
+
+            ret.push(type, atom, start, str - start);
+
+            // The text of #error and #warning may be anything (and continued
+            // by backslashes as well)
+            if (in_directive && (ret.size() == directives->back().start + 2) &&
+                ((atom == ATOM_ERROR) || (atom == ATOM_WARNING)))
+            {
+                str = continued_line_end(str, end, &line, &line_start);
+                directive_line = line;
+            }
+
+            // Continue after the last complete token (so asking again after
+            // an error fails the same way)
+            position = str;
+            position_line_start = line_start;
+            position_line = line;
         }
     }
     catch (char *msg)
     {
-        for (token *_: ret) { delete _; }
-        throw new error(line, str - line_start + 1, msg);
+        // What has been scanned of the failed token may extend past its line
+        const char *eol = scan->line_end(start, end);
+        if (str > eol)
+            str = eol;
+
+        if (!failures)
+            throw new error(line, str - line_start + 1, msg);
+
+        // The preprocessor decides whether the text matters (it does not in
+        // groups skipped by #if), so only record the failure here
+        failures->push_back({static_cast<token_index>(ret.size()), in_directive, line,
+                             static_cast<int>(str - line_start + 1), msg});
+        delete msg;
+
+        str = continued_line_end(eol, end, &line, &line_start);
+        if (in_directive)
+            directive_line = line;
+
+        position = str;
+        position_line_start = line_start;
+        position_line = line;
+        return false;
     }
 
-    return ret;
+    position = str;
+    position_line_start = line_start;
+    position_line = line;
+
+    if (in_directive && !*str)
+    {
+        directives->back().end = ret.size();
+        in_directive = false;
+    }
+
+    return true;
+}
+
+
+bool token_source::produce(token_index i)
+{
+    if (pipeline)
+        return receive(i);
+
+    // Starts over after every line that could not be tokenized
+    while (!tokenize_into(tokens, i));
+    return i < tokens.size();
+}
+
+
+token_stream tokenize(const char *str)
+{
+    token_source source(str);
+    source.drain();
+    return std::move(source.tokens);
+}
+
+
+token_stream tokenize_directives(const char *str, std::vector<directive_range> *directives,
+                                 std::vector<tokenize_failure> *failures)
+{
+    token_source source(str, directives, failures);
+    source.drain();
+    return std::move(source.tokens);
 }